@@ -27,6 +27,7 @@
 
 #include "mpi.hpp"
 #include "Particle.hpp"
+#include <algorithm>
 #include <vector>
 #include <stdexcept>
 
@@ -82,22 +83,22 @@ protected:
 
     boost::scoped_array<char> dynBuf;  //!< dynamic buffer, auto freed
 
-    int capacity;  //!< allocated size of the buffer
-    int usedSize;  //!< used size of the buffer
-    int pos;       //!< current buffer position
+    size_t capacity;  //!< allocated size of the buffer
+    size_t usedSize;  //!< used size of the buffer
+    size_t pos;       //!< current buffer position
 
-    void allocate(int size)
+    void allocate(size_t size)
     {
         // fprintf(stderr, "realloc buffer from %d to capacity %d, used size = %d\n", capacity,
         // size, usedSize);
         capacity = size;
         char* newBuf = new char[capacity];
-        for (int i = 0; i < usedSize; i++) newBuf[i] = buf[i];
+        for (size_t i = 0; i < usedSize; i++) newBuf[i] = buf[i];
         dynBuf.reset(newBuf);
         buf = dynBuf.get();
     }
 
-    void extend(int size)
+    void extend(size_t size)
     {
         if (size <= capacity) return;
         if (size < 1024)
@@ -120,7 +121,7 @@ public:
         // std::cout << comm.rank() << ": read pos: " << pos << ", usedSize: " << usedSize << "\n";
         if (pos > usedSize)
         {
-            fprintf(stderr, "%d: read at pos %d: size %d insufficient\n", comm.rank(), pos,
+            fprintf(stderr, "%d: read at pos %zu: size %zu insufficient\n", comm.rank(), pos,
                     usedSize);
             exit(-1);
             return;
@@ -177,13 +178,13 @@ public:
 
         // make sure that buffer will be suffient for receiving
 
-        if (msgSize > capacity)
+        if (size_t(msgSize) > capacity)
         {
             // reallocation necessary
             allocate(msgSize);
         }
 
-        stat = comm.recv(sender, tag, buf, capacity);
+        stat = comm.recv(sender, tag, buf, msgSize);
 
         // incoming message might be smaller than allocated size
 
@@ -194,6 +195,15 @@ public:
         // printf("%d: received size = %d from %d\n", comm.rank(), size, sender);
     }
 
+    /** Fill the buffer with \p size bytes from \p data, e.g. read from a file. */
+    void assign(const char* data, size_t size)
+    {
+        reset();
+        if (size > capacity) allocate(size);
+        std::copy(data, data + size, buf);
+        usedSize = size;
+    }
+
     mpi::request irecv(longint sender, int tag)
     {
         // blocking test for the incomming message
@@ -201,13 +211,13 @@ public:
         int msgSize = *stat.count<char>();
 
         // make sure that buffer will be suffient for receiving
-        if (msgSize > capacity)
+        if (size_t(msgSize) > capacity)
         {
             // reallocation necessary
             allocate(msgSize);
         }
 
-        mpi::request req = comm.irecv(sender, tag, buf, capacity);
+        mpi::request req = comm.irecv(sender, tag, buf, msgSize);
         // incoming message might be smaller than allocated size
         // usedSize = req->count<char>();
         usedSize = msgSize;
@@ -224,7 +234,7 @@ public:
     template <class T>
     void writeAll(T const& val)
     {
-        int size = sizeof(T);  // needed size to write the data
+        size_t size = sizeof(T);  // needed size to write the data
         extend(pos + size);    // make sure that buffer will be sufficient
         T* tbuf = (T*)(buf + pos);
         *tbuf = val;
@@ -284,6 +294,10 @@ public:
         }
     }
 
+    /** Written bytes, e.g. to store the buffer in a file. */
+    const char* getData() const { return buf; }
+    size_t getSize() const { return usedSize; }
+
     void send(longint receiver, int tag)
     {
         comm.send(receiver, tag, buf, pos);
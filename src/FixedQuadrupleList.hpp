@@ -39,10 +39,12 @@ namespace espressopp
 {
 class FixedQuadrupleList : public QuadrupleList
 {
+public:
+    typedef boost::unordered_multimap<longint, Triple<longint, longint, longint> > GlobalQuadruples;
+
 protected:
     boost::signals2::connection sigBeforeSend, sigAfterRecv, sigOnParticlesChanged;
     std::shared_ptr<storage::Storage> storage;
-    typedef boost::unordered_multimap<longint, Triple<longint, longint, longint> > GlobalQuadruples;
     GlobalQuadruples globalQuadruples;
     using QuadrupleList::add;
 
@@ -63,6 +65,7 @@ public:
     virtual void onParticlesChanged();
     virtual std::vector<longint> getQuadrupleList();
     python::list getQuadruples();
+    GlobalQuadruples* getGlobalQuadruples() { return &globalQuadruples; }
 
     /** Get the number of quadruples in the GlobalQuadruples list */
     int size() { return globalQuadruples.size(); }
@@ -39,10 +39,12 @@ namespace espressopp
 {
 class FixedTripleList : public TripleList
 {
+public:
+    typedef boost::unordered_multimap<longint, std::pair<longint, longint> > GlobalTriples;
+
 protected:
     boost::signals2::connection sigAfterRecv, sigOnParticleChanged, sigBeforeSend;
     std::shared_ptr<storage::Storage> storage;
-    typedef boost::unordered_multimap<longint, std::pair<longint, longint> > GlobalTriples;
     GlobalTriples globalTriples;
     using TripleList::add;
 
@@ -64,6 +66,7 @@ public:
     virtual void onParticlesChanged();
     virtual std::vector<longint> getTripleList();
     python::list getTriples();
+    GlobalTriples* getGlobalTriples() { return &globalTriples; }
 
     /** Get the number of triples in the GlobalTriples list */
     int size() { return globalTriples.size(); }
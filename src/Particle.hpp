@@ -175,7 +175,7 @@ struct ParticleLocal
     // the image of the particle
     Int3D i;
     bool ghost;
-    bool dummy1;
+    bool adrZone;  // in the AdResS zone, set by VerletListAdress::rebuild
     bool dummy2;
     bool dummy3;
 
@@ -219,6 +219,7 @@ struct Particle
         p.fm = 0.0;
         m.vradius = 0.0;
         l.ghost = false;
+        l.adrZone = false;
         p.lambda = 0.0;
         p.varmass = 0.0;
         p.drift = 0.0;
@@ -338,6 +339,10 @@ struct Particle
     bool getGhostStatus() const { return l.ghost; }
     void setGhostStatus(const bool& gs) { l.ghost = gs; }
 
+    // AdResS zone membership
+    bool& adrZone() { return l.adrZone; }
+    const bool& adrZone() const { return l.adrZone; }
+
     // weight/lambda (used in H-Adress)
     real& lambda() { return p.lambda; }
     const real& lambda() const { return p.lambda; }
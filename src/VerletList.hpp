@@ -86,6 +86,15 @@ public:
     /** Add pairs to exclusion list */
     bool exclude(longint pid1, longint pid2);
 
+    /** Get the exclusion list, pairs of particle ids in the order they were excluded */
+    const boost::unordered_set<std::pair<longint, longint> >& getExcludeList() const
+    {
+        return exList;
+    }
+
+    /** Remove all pairs from the exclusion list */
+    void clearExcludeList() { exList.clear(); }
+
     /** Get the number of times the Verlet list has been rebuilt */
     int getBuilds() const { return builds; }
 
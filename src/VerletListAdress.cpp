@@ -71,6 +71,29 @@ VerletListAdress::VerletListAdress(
 
 /*-------------------------------------------------------------*/
 
+bool VerletListAdress::isInAdrZone(const Particle& p, const bc::BC& bc) const
+{
+    // if adrCenter is not set, the center of adress zone moves along with some particles
+    int ncenters = adrCenterSet ? 1 : adrPositions.size();
+    for (int i = 0; i < ncenters; i++)
+    {
+        Real3D dist;
+        real distsq;
+        bc.getMinimumImageVectorBox(dist, p.getPos(), adrCenterSet ? adrCenter : *adrPositions[i]);
+
+        if (sphereAdr)
+        {  // spherical adress region
+            distsq = dist.sqr();
+        }
+        else
+        {  // slab-type adress region
+            distsq = dist[0] * dist[0];
+        }
+        if (distsq <= adrsq) return true;
+    }
+    return false;
+}
+
 void VerletListAdress::rebuild()
 {
     vlPairs.clear();
@@ -82,69 +105,19 @@ void VerletListAdress::rebuild()
     // get local cells
     CellList localcells = getSystem()->storage->getLocalCells();
 
-    // if adrCenter is not set, the center of adress zone moves along with some particles
-    if (!adrCenterSet)
+    // classify all particles (reals and ghosts) on node in one sweep, the zone is stored in the
+    // particle so that checkPair does not need a lookup
+    for (CellListIterator it(localcells); it.isValid(); ++it)
     {
-        // loop over all VP particles (reals and ghosts) on node
-        for (CellListIterator it(localcells); it.isValid(); ++it)
+        Particle& p = *it;
+        p.adrZone() = isInAdrZone(p, bc);
+        if (p.adrZone())
         {
-            // loop over positions
-            for (std::vector<Real3D*>::iterator it2 = adrPositions.begin();
-                 it2 != adrPositions.end(); ++it2)
-            {
-                Real3D dist;
-                real distsq;
-                bc.getMinimumImageVectorBox(dist, it->getPos(), **it2);
-
-                if (getAdrRegionType())
-                {  // spherical adress region
-                    distsq = dist.sqr();
-                }
-                else
-                {  // slab-type adress region
-                    distsq = dist[0] * dist[0];
-                }
-                if (distsq <= adrsq)
-                {
-                    adrZone.insert(&(*it));
-                    break;  // do not need to loop further
-                }
-            }
-            // if not near enough to any adrPositions, put in cgZone
-            if (adrZone.count(&(*it)) == 0)
-            {
-                cgZone.insert(&(*it));
-            }
+            adrZone.push_back(&p);
         }
-    }
-    // center of adress zone is fixed
-    else
-    {
-        for (CellListIterator it(localcells); it.isValid(); ++it)
+        else
         {
-            Real3D dist;
-            real distsq;
-            bc.getMinimumImageVectorBox(dist, it->getPos(), adrCenter);
-            // Real3D dist = it->getPos() - adrCenter;
-            // // CHANGE FOR X SPLIT VS SPHERE real dist = it->getPos()[0] - adrCenter[0];
-            // // CHANGE FOR X SPLIT VS SPHERE real distsq = dist.sqr(); // CHANGE FOR X SPLIT VS
-            // SPHERE real distsq = dist*dist; // CHANGE FOR X SPLIT VS SPHERE
-            if (getAdrRegionType())
-            {  // spherical adress region
-                distsq = dist.sqr();
-            }
-            else
-            {  // slab-type adress region
-                distsq = dist[0] * dist[0];
-            }
-            if (distsq <= adrsq)
-            {
-                adrZone.insert(&(*it));
-            }
-            else
-            {
-                cgZone.insert(&(*it));
-            }
+            cgZone.push_back(&p);
         }
     }
 
@@ -177,7 +150,7 @@ void VerletListAdress::checkPair(Particle& pt1, Particle& pt2)
     if (exList.count(std::make_pair(pt1.id(), pt2.id())) == 1) return;
     if (exList.count(std::make_pair(pt2.id(), pt1.id())) == 1) return;
     // see if it's in the adress zone
-    if (adrZone.count(&pt1) == 1 || adrZone.count(&pt2) == 1)
+    if (pt1.adrZone() || pt2.adrZone())
     {
         if (distsq > adrcutsq) return;
         adrPairs.add(pt1, pt2);  // add to adress pairs
@@ -207,6 +180,26 @@ bool VerletListAdress::exclude(longint pid1, longint pid2)
     return true;
 }
 
+static python::list pairIds(const PairList& pairs)
+{
+    python::list ids;
+    for (size_t i = 0; i < pairs.size(); i++)
+        ids.append(python::make_tuple(pairs[i].first->id(), pairs[i].second->id()));
+    return ids;
+}
+
+python::list VerletListAdress::getPairsPy() { return pairIds(vlPairs); }
+
+python::list VerletListAdress::getAdrPairsPy() { return pairIds(adrPairs); }
+
+python::list VerletListAdress::getAdrZonePy()
+{
+    python::list ids;
+    for (size_t i = 0; i < adrZone.size(); i++)
+        if (!adrZone[i]->ghost()) ids.append(adrZone[i]->id());
+    return ids;
+}
+
 void VerletListAdress::addAdrParticle(longint pid) { adrList.insert(pid); }
 
 void VerletListAdress::setAdrCenter(real x, real y, real z)
@@ -261,7 +254,10 @@ void VerletListAdress::registerPython()
         .def("addAdrParticle", pyAddAdrParticle)
         .def("setAdrCenter", pySetAdrCenter)
         .def("setAdrRegionType", pySetAdrRegionType)
-        .def("rebuild", &VerletListAdress::rebuild);
+        .def("rebuild", &VerletListAdress::rebuild)
+        .def("getAllPairs", &VerletListAdress::getPairsPy)
+        .def("getAllAdrPairs", &VerletListAdress::getAdrPairsPy)
+        .def("getAdrZone", &VerletListAdress::getAdrZonePy);
 }
 
 }  // namespace espressopp
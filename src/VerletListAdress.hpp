@@ -26,6 +26,7 @@
 
 #include "log4espp.hpp"
 #include "types.hpp"
+#include "python.hpp"
 #include "Particle.hpp"
 #include "SystemAccess.hpp"
 #include "boost/signals2.hpp"
@@ -33,6 +34,7 @@
 #include "Real3D.hpp"
 
 #include <set>
+#include <vector>
 
 namespace espressopp
 {
@@ -61,8 +63,8 @@ public:
     PairList& getPairs() { return vlPairs; }
     PairList& getAdrPairs() { return adrPairs; }
     std::set<longint>& getAdrList() { return adrList; }
-    std::set<Particle*>& getAdrZone() { return adrZone; }
-    std::set<Particle*>& getCGZone() { return cgZone; }
+    std::vector<Particle*>& getAdrZone() { return adrZone; }
+    std::vector<Particle*>& getCGZone() { return cgZone; }
     std::vector<Real3D*>& getAdrPositions() { return adrPositions; }
     real getHy() { return dHy; }
     real getEx() { return dEx; }
@@ -89,6 +91,11 @@ public:
     /** Add pairs to exclusion list */
     bool exclude(longint pid1, longint pid2);
 
+    /** Pids of the local pairs and of the real particles in the AdResS zone */
+    python::list getPairsPy();
+    python::list getAdrPairsPy();
+    python::list getAdrZonePy();
+
     /** Get the number of times the Verlet list has been rebuilt */
     int getBuilds() const { return builds; }
 
@@ -100,8 +107,10 @@ public:
 
 private:
     std::set<longint> adrList;    // pids of particles defining center of adress zone, if set
-    std::set<Particle*> adrZone;  // particles that are in the AdResS zone
-    std::set<Particle*> cgZone;   // particles not in adress zone (same as in vlPairs)
+    // particles that are in the AdResS zone and the others (same as in vlPairs), in the order of
+    // the local cells; the membership itself is the adrZone flag of the particle
+    std::vector<Particle*> adrZone;
+    std::vector<Particle*> cgZone;
     PairList adrPairs;            // pairs that are in AdResS zone
     real dEx, dHy;                // size of the expicit and hybrid zone
     real adrsq, adrcutsq, adrCutverlet, cutverlet;
@@ -114,6 +123,7 @@ private:
     // size_t atType; // types above this number are considered atomistic
     // void isPairInAdrZone(Particle &pt1, Particle &pt2); // not used anymore
 
+    bool isInAdrZone(const Particle& p, const bc::BC& bc) const;
     void checkPair(Particle& pt1, Particle& pt2);
     PairList vlPairs;
     boost::unordered_set<std::pair<longint, longint> > exList;  // exclusion list
@@ -107,6 +107,21 @@ Example - creating the VerletListAdress for a adress region based on the overlap
 
                 :rtype:
 
+.. function:: espressopp.VerletListAdress.getAllPairs()
+
+                :return: The pairs of vlPairs as (pid1, pid2), one list per CPU.
+                :rtype: list of lists
+
+.. function:: espressopp.VerletListAdress.getAllAdrPairs()
+
+                :return: The pairs of adrPairs as (pid1, pid2), one list per CPU.
+                :rtype: list of lists
+
+.. function:: espressopp.VerletListAdress.getAdrZone()
+
+                :return: The pids of the real particles in adrZone, one list per CPU.
+                :rtype: list of lists
+
 .. function:: espressopp.VerletListAdress.totalSize()
 
                 :rtype:
@@ -180,10 +195,23 @@ class VerletListAdressLocal(_espressopp.VerletListAdress):
         if pmi.workerIsActive():
             self.cxxclass.rebuild(self)
 
+    def getAllPairs(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.getAllPairs(self)
+
+    def getAllAdrPairs(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.getAllAdrPairs(self)
+
+    def getAdrZone(self):
+        if pmi.workerIsActive():
+            return self.cxxclass.getAdrZone(self)
+
 if pmi.isController:
     class VerletListAdress(metaclass=pmi.Proxy):
         pmiproxydefs = dict(
             cls = 'espressopp.VerletListAdressLocal',
             pmiproperty = [ 'builds' ],
-            pmicall = [ 'totalSize', 'exclude', 'addAdrParticles', 'rebuild' ]
+            pmicall = [ 'totalSize', 'exclude', 'addAdrParticles', 'rebuild' ],
+            pmiinvoke = [ 'getAllPairs', 'getAllAdrPairs', 'getAdrZone' ]
             )
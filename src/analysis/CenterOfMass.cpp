@@ -25,6 +25,7 @@
 #include "CenterOfMass.hpp"
 #include "storage/DomainDecomposition.hpp"
 #include "iterator/CellListIterator.hpp"
+#include "esutil/Collectives.hpp"
 
 using namespace espressopp;
 using namespace iterator;
@@ -43,10 +44,6 @@ Real3D CenterOfMass::computeVector() const
     real ycom = 0.0;
     real zcom = 0.0;
     real mass = 0.0;
-    real xcom_sum = 0.0;
-    real ycom_sum = 0.0;
-    real zcom_sum = 0.0;
-    real mass_sum = 0.0;
 
     CellList realCells = system.storage->getRealCells();
     for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
@@ -59,13 +56,12 @@ Real3D CenterOfMass::computeVector() const
     }
 
     // it was reduce, but we need it for all cpus
-    boost::mpi::all_reduce(*mpiWorld, xcom, xcom_sum, std::plus<real>());
-    boost::mpi::all_reduce(*mpiWorld, ycom, ycom_sum, std::plus<real>());
-    boost::mpi::all_reduce(*mpiWorld, zcom, zcom_sum, std::plus<real>());
-    boost::mpi::all_reduce(*mpiWorld, mass, mass_sum, std::plus<real>());
+    esutil::ReductionBatch reduction(mpiWorld);
+    esutil::ReductionBatch::Handle hCom = reduction.addSum(Real3D(xcom, ycom, zcom));
+    esutil::ReductionBatch::Handle hMass = reduction.addSum(mass);
 
     // Real3D force(0.0, 0.0, 0.0);
-    return Real3D(xcom_sum / mass_sum, ycom_sum / mass_sum, zcom_sum / mass_sum);
+    return reduction.sumReal3D(hCom) / reduction.sum(hMass);
 }
 
 // TODO: this dummy routine is still needed as we have not yet ObservableVector
@@ -29,6 +29,7 @@
 
 #include "ConfigsParticleDecomp.hpp"
 #include "bc/BC.hpp"
+#include "io/TrajectoryReader.hpp"
 #include <boost/serialization/map.hpp>
 
 using namespace std;
@@ -205,6 +206,39 @@ void ConfigsParticleDecomp::gatherFromFile(string filename)
     pushConfig(config);
 }
 
+void ConfigsParticleDecomp::gatherFromTrajectory(std::shared_ptr<io::TrajectoryReader> reader,
+                                                 int frame)
+{
+    System& system = getSystemRef();
+    esutil::Error err(system.comm);
+
+    int myrank = system.comm->rank();
+
+    reader->readFrame(frame);
+    if (reader->getNumParticles() != num_of_part)
+    {
+        stringstream msg;
+        msg << "Number of particles in frame " << reader->getFrame() << " ("
+            << reader->getNumParticles()
+            << ") does not match the number of particles of the system (which is " << num_of_part
+            << ")";
+        err.setException(msg.str());
+    }
+    err.checkException();
+
+    ConfigurationPtr config = std::make_shared<Configuration>();
+    const longint* ids = reader->getIds();
+    const real* x = reader->getX();
+    const real* y = reader->getY();
+    const real* z = reader->getZ();
+    for (int64_t i = 0; i < reader->getNumParticles(); i++)
+    {
+        map<size_t, int>::const_iterator itr = idToCpu.find(ids[i]);
+        if (itr != idToCpu.end() && itr->second == myrank) config->set(ids[i], x[i], y[i], z[i]);
+    }
+    pushConfig(config);
+}
+
 // Python wrapping
 void ConfigsParticleDecomp::registerPython()
 {
@@ -217,6 +251,7 @@ void ConfigsParticleDecomp::registerPython()
 
         .def("gather", &ConfigsParticleDecomp::gather)
         .def("gatherFromFile", &ConfigsParticleDecomp::gatherFromFile)
+        .def("gatherFromTrajectory", &ConfigsParticleDecomp::gatherFromTrajectory)
         .def("__getitem__", &ConfigsParticleDecomp::getConf)
         .def("all", &ConfigsParticleDecomp::all)
         .def("clear", &ConfigsParticleDecomp::clear)
@@ -40,6 +40,10 @@ using namespace std;
 
 namespace espressopp
 {
+namespace io
+{
+class TrajectoryReader;
+}
 namespace analysis
 {
 using namespace iterator;
@@ -290,6 +294,9 @@ public:
     // Read in a snapshot from a xyz-file
     void gatherFromFile(string filename);
 
+    // Take a snapshot from a frame of a trajectory; every cpu reads its particles itself
+    void gatherFromTrajectory(std::shared_ptr<io::TrajectoryReader> reader, int frame);
+
     // Get a configuration from ConfigurationList
     ConfigurationPtr getConf(int position) const;
 
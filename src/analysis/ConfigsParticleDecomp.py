@@ -56,6 +56,15 @@ espressopp.analysis.ConfigsParticleDecomp
                 :param filename:
                 :type filename:
                 :rtype:
+
+.. function:: espressopp.analysis.ConfigsParticleDecomp.gatherFromTrajectory(reader, frame)
+
+                Take the snapshot from a frame of a trajectory. Every CPU reads its
+                own particles from the memory-mapped file, nothing is broadcast.
+
+                :param reader: trajectory opened with :py:class:`espressopp.io.TrajectoryReader`
+                :param int frame: frame number, negative numbers count from the end
+                :rtype:
 """
 #from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -71,6 +80,8 @@ class ConfigsParticleDecompLocal(analysis_ConfigsParticleDecomp):
         return self.cxxclass.gather(self)
     def gatherFromFile(self, filename):
         return self.cxxclass.gatherFromFile(self, filename)
+    def gatherFromTrajectory(self, reader, frame):
+        return self.cxxclass.gatherFromTrajectory(self, reader, frame)
     def clear(self):
         return self.cxxclass.clear(self)
     def __iter__(self):
@@ -84,7 +95,7 @@ if pmi.isController:
 
         pmiproxydefs = dict(
           #cls =  'espressopp.analysis.ConfigsParticleDecompLocal',
-          pmicall = [ "gather", "gatherFromFile", "clear", "compute" ],
+          pmicall = [ "gather", "gatherFromFile", "gatherFromTrajectory", "clear", "compute" ],
           localcall = ["__getitem__", "all"],
           pmiproperty = ["size"]
         )
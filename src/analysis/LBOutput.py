@@ -24,6 +24,7 @@ Abstract output class for LB simulations. The implemented realisations are:
 * :class:`espressopp.analysis.LBOutputScreen` to output simulation progress and control flux conservation when using MD to LB coupling.
 * :class:`espressopp.analysis.LBOutputVzInTime` to output velocity component :math:`v_z` on the lattice site with an index :math:`(0.25*N_i, 0, 0)` in time.
 * :class:`espressopp.analysis.LBOutputVzOfX` to output local density :math:`\rho` and :math:`v_z` component of the velocity as a function of the coordinate :math:`x`.
+* :class:`espressopp.analysis.LBOutputFields` to stream planar averages, slices and coarse-grained fields of density and velocity into an HDF5 file.
 
 .. Note::
 
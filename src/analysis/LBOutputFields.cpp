@@ -0,0 +1,264 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LBOutputFields.hpp"
+#include "io/hdf5.hpp"
+#include <boost/mpi/collectives/reduce.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace espressopp
+{
+namespace analysis
+{
+namespace
+{
+const char* dimName = "xyz";
+}  // namespace
+
+LBOutputFields::LBOutputFields(std::shared_ptr<System> system,
+                               std::shared_ptr<integrator::LatticeBoltzmann> latticeboltzmann,
+                               std::string _filename)
+    : LBOutput(system, latticeboltzmann), filename(_filename), compression(0), fileCreated(false)
+{
+}
+
+/*******************************************************************************************/
+
+/* REGISTRATION OF FIELDS */
+void LBOutputFields::addPlanarAverage(int _dim)
+{
+    if (_dim < 0 || _dim > 2)
+        throw std::runtime_error("LBOutputFields: direction has to be 0, 1 or 2");
+
+    Field _field;
+    _field.kind = FIELD_PLANAR;
+    _field.dim = _dim;
+    _field.index = 0;
+    _field.factor = 1;
+    _field.name = std::string("planar_") + dimName[_dim];
+    _field.bins.push_back(latticeboltzmann->getNi()[_dim]);
+    addField(_field);
+}
+
+void LBOutputFields::addSlice(int _dim, int _index)
+{
+    Int3D _Ni = latticeboltzmann->getNi();
+    if (_dim < 0 || _dim > 2)
+        throw std::runtime_error("LBOutputFields: direction has to be 0, 1 or 2");
+    if (_index < 0 || _index >= _Ni[_dim])
+        throw std::runtime_error("LBOutputFields: slice index is outside of the lattice");
+
+    Field _field;
+    _field.kind = FIELD_SLICE;
+    _field.dim = _dim;
+    _field.index = _index;
+    _field.factor = 1;
+    _field.name = std::string("slice_") + dimName[_dim] + "_" + std::to_string(_index);
+    for (int _d = 0; _d < 3; _d++)
+        if (_d != _dim) _field.bins.push_back(_Ni[_d]);
+    addField(_field);
+}
+
+void LBOutputFields::addCoarseGrained(int _factor)
+{
+    if (_factor < 1) throw std::runtime_error("LBOutputFields: factor has to be positive");
+
+    Int3D _Ni = latticeboltzmann->getNi();
+    Field _field;
+    _field.kind = FIELD_COARSE;
+    _field.dim = 0;
+    _field.index = 0;
+    _field.factor = _factor;
+    _field.name = "coarse_" + std::to_string(_factor);
+    for (int _d = 0; _d < 3; _d++) _field.bins.push_back((_Ni[_d] + _factor - 1) / _factor);
+    addField(_field);
+}
+
+void LBOutputFields::addField(Field _field)
+{
+    if (fileCreated)
+        throw std::runtime_error("LBOutputFields: fields have to be added before the first output");
+    for (auto& _other : fields)
+        if (_other.name == _field.name)
+            throw std::runtime_error("LBOutputFields: field " + _field.name + " already exists");
+
+    size_t _size = numComps;
+    for (int _n : _field.bins) _size *= _n;
+    _field.offset = sendBuf.size();
+    fields.push_back(_field);
+    sendBuf.resize(sendBuf.size() + _size);
+}
+
+/* NORMALISATION OF A BIN: 1 / NUMBER OF LB SITES IT COLLECTS */
+real LBOutputFields::binWeight(const Field& _field, int _bin)
+{
+    Int3D _Ni = latticeboltzmann->getNi();
+    switch (_field.kind)
+    {
+        case FIELD_PLANAR:
+            return real(_Ni[_field.dim]) / (_Ni[0] * _Ni[1] * _Ni[2]);
+        case FIELD_SLICE:
+            return 1.;
+        case FIELD_COARSE:
+        {
+            int _count = 1;
+            for (int _d = 2; _d >= 0; _d--)
+            {
+                int _b = _bin % _field.bins[_d];
+                _bin /= _field.bins[_d];
+                _count *= std::min(_field.factor, _Ni[_d] - _b * _field.factor);
+            }
+            return 1. / _count;
+        }
+    }
+    return 0.;
+}
+
+void LBOutputFields::setCompression(int _compression)
+{
+    if (_compression < 0 || _compression > 9)
+        throw std::runtime_error("LBOutputFields: compression level has to be within [0,9]");
+    compression = _compression;
+}
+int LBOutputFields::getCompression() { return compression; }
+
+/*******************************************************************************************/
+
+/* ACCUMULATE LOCAL SITES, REDUCE ON RANK 0 AND APPEND A FRAME */
+void LBOutputFields::writeOutput()
+{
+    if (fields.empty()) return;
+
+    int _offset = latticeboltzmann->getHaloSkin();
+    Int3D _Ni = latticeboltzmann->getNi();
+    Int3D _myNi = latticeboltzmann->getMyNi();
+    Int3D _globIdx = latticeboltzmann->findGlobIdx();  // first lb site global index
+
+    std::fill(sendBuf.begin(), sendBuf.end(), 0.);
+
+    for (int i = _offset; i < _myNi[0] - _offset; i++)
+    {
+        for (int j = _offset; j < _myNi[1] - _offset; j++)
+        {
+            for (int k = _offset; k < _myNi[2] - _offset; k++)
+            {
+                Int3D _site(i, j, k);
+                Int3D _glob(_globIdx[0] + i - _offset, _globIdx[1] + j - _offset,
+                            _globIdx[2] + k - _offset);
+
+                real _den = latticeboltzmann->getLBMom(_site, 0);
+                real _invDen = (_den > 0.) ? 1. / _den : 0.;
+                real _val[numComps] = {_den, latticeboltzmann->getLBMom(_site, 1) * _invDen,
+                                       latticeboltzmann->getLBMom(_site, 2) * _invDen,
+                                       latticeboltzmann->getLBMom(_site, 3) * _invDen};
+
+                for (auto& _field : fields)
+                {
+                    int _bin = 0;
+                    switch (_field.kind)
+                    {
+                        case FIELD_PLANAR:
+                            _bin = _glob[_field.dim];
+                            break;
+                        case FIELD_SLICE:
+                            if (_glob[_field.dim] != _field.index) continue;
+                            for (int _d = 0; _d < 3; _d++)
+                                if (_d != _field.dim) _bin = _bin * _Ni[_d] + _glob[_d];
+                            break;
+                        case FIELD_COARSE:
+                            for (int _d = 0; _d < 3; _d++)
+                                _bin = _bin * _field.bins[_d] + _glob[_d] / _field.factor;
+                            break;
+                    }
+
+                    real* _dst = &sendBuf[_field.offset + size_t(_bin) * numComps];
+                    for (int _c = 0; _c < numComps; _c++) _dst[_c] += _val[_c];
+                }
+            }
+        }
+    }
+
+    // all fields travel in one reduction
+    mpi::communicator& _comm = *getSystem()->comm;
+    if (_comm.rank() != 0)
+    {
+        boost::mpi::reduce(_comm, sendBuf.data(), int(sendBuf.size()), std::plus<real>(), 0);
+        fileCreated = true;
+        return;
+    }
+    recvBuf.resize(sendBuf.size());
+    boost::mpi::reduce(_comm, sendBuf.data(), int(sendBuf.size()), recvBuf.data(),
+                       std::plus<real>(), 0);
+
+    hid_t _fileId;
+    if (fileCreated)
+    {
+        _fileId = io::CHECK_HDF5(H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT));
+    }
+    else
+    {
+        _fileId = io::CHECK_HDF5(
+            H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT));
+        fileCreated = true;
+    }
+
+    std::vector<int64_t> _step(1, latticeboltzmann->getStepNum());
+    io::appendFrame(_fileId, "step", {}, _step);
+
+    std::vector<real> _frame;
+    for (auto& _field : fields)
+    {
+        std::vector<hsize_t> _frameDims(_field.bins.begin(), _field.bins.end());
+        _frameDims.push_back(numComps);
+        int _numBins = 1;
+        for (int _n : _field.bins) _numBins *= _n;
+
+        _frame.assign(recvBuf.begin() + _field.offset,
+                      recvBuf.begin() + _field.offset + size_t(_numBins) * numComps);
+        for (int _bin = 0; _bin < _numBins; _bin++)
+        {
+            real _weight = binWeight(_field, _bin);
+            for (int _c = 0; _c < numComps; _c++) _frame[size_t(_bin) * numComps + _c] *= _weight;
+        }
+        io::appendFrame(_fileId, _field.name, _frameDims, _frame, compression);
+    }
+
+    io::CHECK_HDF5(H5Fclose(_fileId));
+}
+
+void LBOutputFields::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<LBOutputFields, bases<LBOutput> >(
+        "analysis_LBOutput_Fields",
+        init<std::shared_ptr<System>, std::shared_ptr<integrator::LatticeBoltzmann>,
+             std::string>())
+
+        .add_property("compression", &LBOutputFields::getCompression,
+                      &LBOutputFields::setCompression)
+        .def("addPlanarAverage", &LBOutputFields::addPlanarAverage)
+        .def("addSlice", &LBOutputFields::addSlice)
+        .def("addCoarseGrained", &LBOutputFields::addCoarseGrained)
+        .def("writeOutput", &LBOutputFields::writeOutput);
+}
+}  // namespace analysis
+}  // namespace espressopp
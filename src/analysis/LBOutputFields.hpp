@@ -0,0 +1,88 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _ANALYSIS_LBOUTPUT_FIELDS_HPP
+#define _ANALYSIS_LBOUTPUT_FIELDS_HPP
+
+#include "LBOutput.hpp"
+#include <string>
+#include <vector>
+
+namespace espressopp
+{
+namespace analysis
+{
+/** Streaming output of LB fields. Every registered field (planar averages, slices and
+    coarse-grained blocks of density and velocity) is accumulated from the local lattice,
+    all fields are summed on rank 0 by a single reduction, and rank 0 appends them as a new
+    frame to extendible datasets of one HDF5 file. */
+class LBOutputFields : public LBOutput
+{
+public:
+    LBOutputFields(std::shared_ptr<System> _system,
+                   std::shared_ptr<integrator::LatticeBoltzmann> _latticeboltzmann,
+                   std::string _filename);
+
+    void addPlanarAverage(int _dim);
+    void addSlice(int _dim, int _index);
+    void addCoarseGrained(int _factor);
+
+    void setCompression(int _compression);
+    int getCompression();
+
+    void writeOutput();
+
+    static void registerPython();
+
+private:
+    enum FieldKind
+    {
+        FIELD_PLANAR,
+        FIELD_SLICE,
+        FIELD_COARSE
+    };
+
+    struct Field
+    {
+        FieldKind kind;
+        int dim;                // averaging direction or slice normal
+        int index;              // global slice index
+        int factor;             // coarse-graining factor
+        std::string name;       // dataset name
+        std::vector<int> bins;  // number of bins per direction
+        size_t offset;          // start of the field in the reduction buffer
+    };
+
+    static const int numComps = 4;  // rho, u_x, u_y, u_z
+
+    void addField(Field _field);
+    real binWeight(const Field& _field, int _bin);
+
+    std::string filename;
+    int compression;
+    bool fileCreated;
+    std::vector<Field> fields;
+    std::vector<real> sendBuf, recvBuf;
+};
+}  // namespace analysis
+}  // namespace espressopp
+
+#endif
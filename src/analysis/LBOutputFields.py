@@ -0,0 +1,93 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+
+Streams lattice-Boltzmann fields into one HDF5 file while the simulation runs.
+Every call of :py:meth:`writeOutput` appends a frame to each registered field.
+The fields are accumulated in parallel, summed on rank 0 in a single reduction
+and appended there to extendible datasets, so the cost is one collective per
+output independent of the number of fields.
+
+Each field stores ``(rho, u_x, u_y, u_z)`` per bin along its last axis and has
+an unlimited leading (frame) axis. The dataset ``step`` holds the LB step of
+each frame. The available fields are
+
+* ``planar_<d>``: average over planes normal to direction ``d``, shape
+  ``(frames, N_d, 4)``,
+* ``slice_<d>_<i>``: plane ``i`` normal to ``d``, shape ``(frames, N_a, N_b, 4)``
+  with ``a < b`` the remaining directions,
+* ``coarse_<f>``: averages over blocks of ``f`` x ``f`` x ``f`` sites, shape
+  ``(frames, ceil(N_x/f), ceil(N_y/f), ceil(N_z/f), 4)``.
+
+Fields have to be registered before the first output.
+
+.. py:class:: espressopp.analysis.LBOutputFields(system,lb,filename)
+
+    :param std::shared_ptr system: system object defined earlier in the python-script
+    :param lb_object lb: lattice boltzmann object defined earlier in the python-script
+    :param str filename: name of the HDF5 file, overwritten by the first output
+
+.. py:method:: addPlanarAverage(dim)
+
+    :param int dim: direction normal to the averaging planes (0, 1 or 2)
+
+.. py:method:: addSlice(dim,index)
+
+    :param int dim: direction normal to the slice (0, 1 or 2)
+    :param int index: global lattice index of the slice
+
+.. py:method:: addCoarseGrained(factor)
+
+    :param int factor: edge length of the averaging blocks in lattice sites
+
+.. py:attribute:: compression
+
+    deflate level (0-9) of the datasets, 0 stores them uncompressed (default)
+
+Example:
+
+>>> # stream a v(x) profile and the mid-plane z = 8 every 100 steps
+>>> fields = espressopp.analysis.LBOutputFields(system,lb,"lbFields.h5")
+>>> fields.addPlanarAverage(0)
+>>> fields.addSlice(2,8)
+>>> fields.compression = 4
+>>>
+>>> extAnalysis = espressopp.integrator.ExtAnalyze(fields,100)
+>>> integrator.addExtension( extAnalysis )
+
+"""
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.analysis.LBOutput import *
+from _espressopp import analysis_LBOutput_Fields
+
+class LBOutputFieldsLocal(LBOutputLocal, analysis_LBOutput_Fields):
+    def __init__(self, system, latticeboltzmann, filename):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, analysis_LBOutput_Fields, system, latticeboltzmann, filename)
+
+if pmi.isController :
+    class LBOutputFields(LBOutput, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.analysis.LBOutputFieldsLocal',
+            pmicall = ["addPlanarAverage", "addSlice", "addCoarseGrained", "writeOutput"],
+            pmiproperty = ["compression"]
+            )
@@ -27,6 +27,7 @@
 #include "RadialDistrF.hpp"
 #include "esutil/Error.hpp"
 #include "bc/BC.hpp"
+#include "io/TrajectoryReader.hpp"
 
 #include <boost/serialization/map.hpp>
 
@@ -158,6 +159,78 @@ python::list RadialDistrF::computeArray(int rdfN) const
     return pyli;
 }
 
+python::list RadialDistrF::computeTrajectory(std::shared_ptr<io::TrajectoryReader> reader,
+                                             int rdfN,
+                                             int first,
+                                             int last) const
+{
+    System& system = getSystemRef();
+    if (last < 0 || last > reader->getNumFrames()) last = reader->getNumFrames();
+    if (first >= last) return python::list();
+    int begin, end;
+    io::TrajectoryReader::splitFrames(first, last, system.comm->rank(), system.comm->size(),
+                                      begin, end);
+
+    real dr = reader->getBoxL(first)[1] / 2. / (real)rdfN;
+    vector<real> rdf(rdfN, 0.0), histogram(rdfN);
+    for (int n = begin; n < end; n++)
+    {
+        reader->readFrame(n);
+        const real* x = reader->getX();
+        const real* y = reader->getY();
+        const real* z = reader->getZ();
+        const int64_t num_part = reader->getNumParticles();
+        Real3D Li = reader->getBoxL();
+
+        std::fill(histogram.begin(), histogram.end(), 0.0);
+        for (int64_t i = 0; i < num_part; i++)
+        {
+            for (int64_t j = i + 1; j < num_part; j++)
+            {
+                Real3D distVector(x[i] - x[j], y[i] - y[j], z[i] - z[j]);
+
+                // minimize the distance, the frame may be unfolded
+                for (int ii = 0; ii < 3; ii++)
+                {
+                    distVector[ii] -= Li[ii] * std::round(distVector[ii] / Li[ii]);
+                }
+
+                int bin = (int)(distVector.abs() / dr);
+                if (bin < rdfN)
+                {
+                    histogram[bin] += 1.0;
+                }
+            }
+        }
+
+        // normalizing with the density of this frame
+        real rho = (real)num_part / (Li[0] * Li[1] * Li[2]);
+        real factor = 2.0 * M_PIl * dr * rho * (real)num_part;
+        for (int i = 0; i < rdfN; i++)
+        {
+            real radius = (i + 0.5) * dr;
+            rdf[i] += histogram[i] / (factor * (radius * radius + dr * dr / 12.0));
+        }
+
+        if (print_progress && system.comm->rank() == 0)
+        {
+            cout << "calculation progress (radial distr. func.): frame " << n - begin + 1 << " of "
+                 << end - begin << "\r" << flush;
+        }
+    }
+    if (print_progress && system.comm->rank() == 0) cout << endl;
+
+    vector<real> totRdf(rdfN);
+    boost::mpi::all_reduce(*system.comm, rdf.data(), rdfN, totRdf.data(), plus<real>());
+
+    python::list pyli;
+    for (int i = 0; i < rdfN; i++)
+    {
+        pyli.append(totRdf[i] / (real)std::max(last - first, 1));
+    }
+    return pyli;
+}
+
 // TODO: this dummy routine is still needed as we have not yet ObservableVector
 real RadialDistrF::compute() const { return -1.0; }
 
@@ -168,7 +241,8 @@ void RadialDistrF::registerPython()
                                              init<std::shared_ptr<System> >())
         .add_property("print_progress", &RadialDistrF::getPrint_progress,
                       &RadialDistrF::setPrint_progress)
-        .def("compute", &RadialDistrF::computeArray);
+        .def("compute", &RadialDistrF::computeArray)
+        .def("computeTrajectory", &RadialDistrF::computeTrajectory);
 }
 }  // namespace analysis
 }  // namespace espressopp
@@ -31,6 +31,10 @@
 
 namespace espressopp
 {
+namespace io
+{
+class TrajectoryReader;
+}
 namespace analysis
 {
 /** Class to compute the radial distribution function of the system. */
@@ -45,6 +49,12 @@ public:
     ~RadialDistrF() {}
     virtual real compute() const;
     virtual python::list computeArray(int) const;
+    /** Average over frames [first, last) of a trajectory, each rank takes its own frames. A
+        negative last means up to the end. The bins are set up with the box of frame first. */
+    python::list computeTrajectory(std::shared_ptr<io::TrajectoryReader> reader,
+                                   int rdfN,
+                                   int first,
+                                   int last) const;
 
     void setPrint_progress(bool _print_progress) { print_progress = _print_progress; }
     bool getPrint_progress() { return print_progress; }
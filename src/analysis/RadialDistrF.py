@@ -35,6 +35,19 @@ espressopp.analysis.RadialDistrF
                 :param rdfN:
                 :type rdfN:
                 :rtype:
+
+.. function:: espressopp.analysis.RadialDistrF.computeTrajectory(reader, rdfN, first=0, last=-1)
+
+                Average of the rdf over the frames first to last-1 of a trajectory,
+                last=-1 means up to the end. The frames are split over the CPUs, each
+                CPU computes the rdf of its frames alone. Particle numbers and box of
+                the system are not used.
+
+                :param reader: trajectory opened with :py:class:`espressopp.io.TrajectoryReader`
+                :param int rdfN:
+                :param int first:
+                :param int last:
+                :rtype: list
 """
 from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -51,10 +64,13 @@ class RadialDistrFLocal(ObservableLocal, analysis_RadialDistrF):
     def compute(self, rdfN):
         return self.cxxclass.compute(self, rdfN)
 
+    def computeTrajectory(self, reader, rdfN, first=0, last=-1):
+        return self.cxxclass.computeTrajectory(self, reader, rdfN, first, last)
+
 if pmi.isController :
     class RadialDistrF(Observable, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
           pmiproperty = [ 'print_progress' ],
-          pmicall = [ "compute" ],
+          pmicall = [ "compute", "computeTrajectory" ],
           cls = 'espressopp.analysis.RadialDistrFLocal'
         )
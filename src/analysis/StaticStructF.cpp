@@ -27,6 +27,7 @@
 #include "StaticStructF.hpp"
 #include "esutil/Error.hpp"
 #include "bc/BC.hpp"
+#include "io/TrajectoryReader.hpp"
 
 #include <boost/serialization/map.hpp>
 
@@ -401,6 +402,96 @@ python::list StaticStructF::computeArraySingleChain(
     return pyli;
 }
 
+// same q-grid and binning as computeArray, but every frame is handled by one
+// CPU alone and the sums are reduced once at the end
+python::list StaticStructF::computeTrajectory(std::shared_ptr<io::TrajectoryReader> reader,
+                                              int nqx,
+                                              int nqy,
+                                              int nqz,
+                                              real bin_factor,
+                                              int first,
+                                              int last) const
+{
+    System& system = getSystemRef();
+    if (last < 0 || last > reader->getNumFrames()) last = reader->getNumFrames();
+    if (first >= last) return python::list();
+    int begin, end;
+    io::TrajectoryReader::splitFrames(first, last, system.comm->rank(), system.comm->size(),
+                                      begin, end);
+
+    Real3D L0 = reader->getBoxL(first);
+    real bin_size = bin_factor * 2. * M_PIl / std::max(L0[0], std::max(L0[1], L0[2]));
+    real q_sqr_max = 4. * M_PIl * M_PIl *
+                     (nqx * nqx / (L0[0] * L0[0]) + nqy * nqy / (L0[1] * L0[1]) +
+                      nqz * nqz / (L0[2] * L0[2]));
+    int num_bins = (int)ceil(sqrt(q_sqr_max) / bin_size);
+
+    // sq, q and count of every bin, reduced in one go
+    vector<real> bins(3 * num_bins, 0.0);
+    real* sq_bin = &bins[0];
+    real* q_bin = &bins[num_bins];
+    real* count_bin = &bins[2 * num_bins];
+
+    Real3D q;
+    for (int n = begin; n < end; n++)
+    {
+        reader->readFrame(n);
+        const real* x = reader->getX();
+        const real* y = reader->getY();
+        const real* z = reader->getZ();
+        const int64_t num_part = reader->getNumParticles();
+        Real3D Li = reader->getBoxL();
+        real dqs[3];
+        dqs[0] = 2. * M_PIl / Li[0];
+        dqs[1] = 2. * M_PIl / Li[1];
+        dqs[2] = 2. * M_PIl / Li[2];
+
+        for (int hx = -nqx; hx <= nqx; hx++)
+        {
+            for (int hy = -nqy; hy <= nqy; hy++)
+            {
+                for (int hz = 0; hz <= nqz; hz++)
+                {
+                    q[0] = hx * dqs[0];
+                    q[1] = hy * dqs[1];
+                    q[2] = hz * dqs[2];
+                    real q_abs = q.abs();
+
+                    // a frame with a smaller box reaches beyond the last bin
+                    int bin_i = (int)floor(q_abs / bin_size);
+                    if (bin_i >= num_bins) continue;
+
+                    real scos = 0;
+                    real ssin = 0;
+                    for (int64_t k = 0; k < num_part; k++)
+                    {
+                        real qr = q[0] * x[k] + q[1] * y[k] + q[2] * z[k];
+                        scos += cos(qr);
+                        ssin += sin(qr);
+                    }
+                    sq_bin[bin_i] += (scos * scos + ssin * ssin) / num_part;
+                    q_bin[bin_i] += q_abs;
+                    count_bin[bin_i] += 1;
+                }
+            }
+        }
+    }
+
+    vector<real> totBins(bins.size());
+    boost::mpi::all_reduce(*system.comm, bins.data(), 3 * num_bins, totBins.data(),
+                           plus<real>());
+
+    // starting with bin_i = 1 leaves out the value for q=0
+    python::list pyli;
+    for (int bin_i = 1; bin_i < num_bins; bin_i++)
+    {
+        real count = totBins[2 * num_bins + bin_i];
+        real c = (count > 0) ? 1 / count : 0;
+        pyli.append(python::make_tuple(totBins[num_bins + bin_i] * c, totBins[bin_i] * c));
+    }
+    return pyli;
+}
+
 // TODO: this dummy routine is still needed as we have not yet ObservableVector
 // there has to be a function 'compute' because of the used template
 // otherwise a compiling error will occur
@@ -413,7 +504,8 @@ void StaticStructF::registerPython()
     class_<StaticStructF, bases<Observable> >("analysis_StaticStructF",
                                               init<std::shared_ptr<System> >())
         .def("compute", &StaticStructF::computeArray)
-        .def("computeSingleChain", &StaticStructF::computeArraySingleChain);
+        .def("computeSingleChain", &StaticStructF::computeArraySingleChain)
+        .def("computeTrajectory", &StaticStructF::computeTrajectory);
 }
 }  // namespace analysis
 }  // namespace espressopp
@@ -30,6 +30,10 @@
 
 namespace espressopp
 {
+namespace io
+{
+class TrajectoryReader;
+}
 namespace analysis
 {
 /** Class to compute the static structure function of the system. */
@@ -43,6 +47,15 @@ public:
     virtual python::list computeArray(int nqx, int nqy, int nqz, real bin_factor) const;
     virtual python::list computeArraySingleChain(
         int nqx, int nqy, int nqz, real bin_factor, int chainlength) const;
+    /** Average over frames [first, last) of a trajectory, each rank takes its own frames. A
+        negative last means up to the end. The bins are set up with the box of frame first. */
+    python::list computeTrajectory(std::shared_ptr<io::TrajectoryReader> reader,
+                                   int nqx,
+                                   int nqy,
+                                   int nqz,
+                                   real bin_factor,
+                                   int first,
+                                   int last) const;
     static void registerPython();
 };
 }  // namespace analysis
@@ -59,6 +59,21 @@ espressopp.analysis.StaticStructF
                 :type chainlength:
                 :type ofile:
                 :rtype:
+
+.. function:: espressopp.analysis.StaticStructF.computeTrajectory(reader, nqx, nqy, nqz, bin_factor, first=0, last=-1)
+
+                Average of S(q) over the frames first to last-1 of a trajectory,
+                last=-1 means up to the end. The frames are split over the CPUs, each
+                CPU computes S(q) of its frames alone.
+
+                :param reader: trajectory opened with :py:class:`espressopp.io.TrajectoryReader`
+                :param int nqx:
+                :param int nqy:
+                :param int nqz:
+                :param real bin_factor:
+                :param int first:
+                :param int last:
+                :rtype: list of (q, S(q))
 """
 from espressopp.esutil import cxxinit
 from espressopp import pmi
@@ -105,9 +120,12 @@ class StaticStructFLocal(ObservableLocal, analysis_StaticStructF):
                 outfile.close()
             return result
 
+    def computeTrajectory(self, reader, nqx, nqy, nqz, bin_factor, first=0, last=-1):
+        return self.cxxclass.computeTrajectory(self, reader, nqx, nqy, nqz, bin_factor, first, last)
+
 if pmi.isController:
     class StaticStructF(Observable, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
-          pmicall = [ "compute", "computeSingleChain" ],
+          pmicall = [ "compute", "computeSingleChain", "computeTrajectory" ],
           cls = 'espressopp.analysis.StaticStructFLocal'
         )
@@ -68,6 +68,7 @@
 #include "LBOutputScreen.hpp"
 #include "LBOutputVzInTime.hpp"
 #include "LBOutputVzOfX.hpp"
+#include "LBOutputFields.hpp"
 
 #include "SystemMonitor.hpp"
 #include "PotentialEnergy.hpp"
@@ -124,6 +125,7 @@ void registerPython()
     LBOutputScreen::registerPython();
     LBOutputVzInTime::registerPython();
     LBOutputVzOfX::registerPython();
+    LBOutputFields::registerPython();
 
     SystemMonitorOutput::registerPython();
     SystemMonitorOutputDummy::registerPython();
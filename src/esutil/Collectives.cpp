@@ -93,6 +93,104 @@ struct is_commutative<UniqueReduce, int> : mpl::true_
 }  // namespace mpi
 }  // namespace boost
 
+namespace espressopp
+{
+namespace esutil
+{
+ReductionBatch::ReductionBatch(std::shared_ptr<communicator> _comm)
+    : comm(_comm), nrequests(0), started(false), done(false)
+{
+}
+
+ReductionBatch::~ReductionBatch()
+{
+    // a posted reduction must be completed before its buffers go away
+    if (started && !done) wait();
+}
+
+ReductionBatch::Handle ReductionBatch::addSum(const real* v, int n)
+{
+    if (started) throw std::runtime_error("ReductionBatch: values added after start()");
+    Handle h = sumIn.size();
+    sumIn.insert(sumIn.end(), v, v + n);
+    return h;
+}
+
+ReductionBatch::Handle ReductionBatch::addMax(real v)
+{
+    if (started) throw std::runtime_error("ReductionBatch: values added after start()");
+    Handle h = maxIn.size();
+    maxIn.push_back(v);
+    return h;
+}
+
+void ReductionBatch::start()
+{
+    if (started) return;
+    started = true;
+    nrequests = 0;
+
+    MPI_Comm mpiComm = *comm;
+    MPI_Datatype type = get_mpi_datatype<real>();
+    if (!sumIn.empty())
+    {
+        sumOut.resize(sumIn.size());
+        MPI_Iallreduce(sumIn.data(), sumOut.data(), sumIn.size(), type, MPI_SUM, mpiComm,
+                       &requests[nrequests++]);
+    }
+    if (!maxIn.empty())
+    {
+        maxOut.resize(maxIn.size());
+        MPI_Iallreduce(maxIn.data(), maxOut.data(), maxIn.size(), type, MPI_MAX, mpiComm,
+                       &requests[nrequests++]);
+    }
+}
+
+void ReductionBatch::wait()
+{
+    if (!started) start();
+    if (done) return;
+    MPI_Waitall(nrequests, requests, MPI_STATUSES_IGNORE);
+    done = true;
+}
+
+real ReductionBatch::sum(Handle h, int i)
+{
+    wait();
+    return sumOut[h + i];
+}
+
+Real3D ReductionBatch::sumReal3D(Handle h)
+{
+    wait();
+    return Real3D(sumOut[h], sumOut[h + 1], sumOut[h + 2]);
+}
+
+Tensor ReductionBatch::sumTensor(Handle h)
+{
+    wait();
+    return Tensor(sumOut[h], sumOut[h + 1], sumOut[h + 2], sumOut[h + 3], sumOut[h + 4],
+                  sumOut[h + 5]);
+}
+
+real ReductionBatch::max(Handle h)
+{
+    wait();
+    return maxOut[h];
+}
+
+void ReductionBatch::clear()
+{
+    if (started && !done) wait();
+    sumIn.clear();
+    maxIn.clear();
+    started = false;
+    done = false;
+    nrequests = 0;
+}
+}  // namespace esutil
+}  // namespace espressopp
+
 void espressopp::esutil::Collectives::registerPython()
 {
     def("esutil_Collectives_locateItem", pyLocateItem);
@@ -24,7 +24,11 @@
 #ifndef _ESUTIL_COLLECTIVES_HPP
 #define _ESUTIL_COLLECTIVES_HPP
 #include <stdexcept>
+#include <vector>
 #include "mpi.hpp"
+#include "types.hpp"
+#include "Real3D.hpp"
+#include "Tensor.hpp"
 
 namespace espressopp
 {
@@ -58,6 +62,59 @@ int locateItem(bool here, int controller, boost::mpi::communicator world = *mpiW
 
 void registerPython();
 }  // namespace Collectives
+
+/** Aggregates independent global reductions into a single nonblocking
+    all-reduce per operation (sum and max).
+
+    Values are registered during a phase and a handle is returned. The first
+    access to any result posts the fused MPI_Iallreduce (unless start() was
+    called explicitly) and waits for it, so independent work can be done
+    between start() and the first access. Handles stay valid until clear().
+*/
+class ReductionBatch
+{
+public:
+    typedef int Handle;
+
+    explicit ReductionBatch(std::shared_ptr<boost::mpi::communicator> comm = mpiWorld);
+    ~ReductionBatch();
+
+    /** Register values for a global sum. */
+    Handle addSum(real v) { return addSum(&v, 1); }
+    Handle addSum(const Real3D& v) { return addSum(v.get(), 3); }
+    Handle addSum(const Tensor& v) { return addSum(&v[0], 6); }
+    Handle addSum(const real* v, int n);
+
+    /** Register a value for a global maximum. */
+    Handle addMax(real v);
+
+    /** Post the fused all-reduce for everything registered so far. */
+    void start();
+
+    /** Wait for the posted all-reduce. */
+    void wait();
+
+    /** Results, wait if needed. */
+    real sum(Handle h, int i = 0);
+    Real3D sumReal3D(Handle h);
+    Tensor sumTensor(Handle h);
+    real max(Handle h);
+
+    /** Drop all registered values, the batch can be filled again. */
+    void clear();
+
+    bool isStarted() const { return started; }
+
+private:
+    std::shared_ptr<boost::mpi::communicator> comm;
+
+    std::vector<real> sumIn, sumOut;
+    std::vector<real> maxIn, maxOut;
+    MPI_Request requests[2];
+    int nrequests;
+    bool started;
+    bool done;
+};
 }  // namespace esutil
 }  // namespace espressopp
 #endif
@@ -52,7 +52,8 @@ Adress::Adress(std::shared_ptr<System> _system,
       fixedtupleList(_fixedtupleList),
       KTI(_KTI),
       regionupdates(_regionupdates),
-      multistep(_multistep)
+      multistep(_multistep),
+      blocksValid(false)
 {
     LOG4ESPP_INFO(theLogger, "construct Adress");
     type = Extension::Adress;
@@ -86,6 +87,9 @@ void Adress::disconnect()
     _befIntV.disconnect();
     _integrateSlow.disconnect();
     _aftCalcSlow.disconnect();
+    _onParticlesChanged.disconnect();
+    _onTuplesChanged.disconnect();
+    blocksValid = false;
 }
 
 void Adress::connect()
@@ -132,13 +136,23 @@ void Adress::connect()
     // connection to after _befIntV()
     _befIntV =
         integrator->befIntV.connect(std::bind(&Adress::aftCalcF, this), boost::signals2::at_front);
+
+    // the VP -> AT index holds pointers into the storage, drop it whenever they may have moved
+    _onParticlesChanged = getSystem()->storage->onParticlesChanged.connect(
+        std::bind(&Adress::invalidateBlocks, this), boost::signals2::at_front);
+    _onTuplesChanged = getSystem()->storage->onTuplesChanged.connect(
+        std::bind(&Adress::invalidateBlocks, this), boost::signals2::at_front);
 }
 
-void Adress::SetPosVel()
+void Adress::buildBlocks()
 {
     System& system = getSystemRef();
 
-    // Set the positions and velocity of CG particles & update weights.
+    vpBlock.clear();
+    atBlock.clear();
+    atOffset.clear();
+    atOffset.push_back(0);
+
     CellList localCells = system.storage->getLocalCells();
     for (CellListIterator cit(localCells); !cit.isDone(); ++cit)
     {
@@ -147,74 +161,89 @@ void Adress::SetPosVel()
         FixedTupleListAdress::iterator it3;
         it3 = fixedtupleList->find(&vp);
 
-        if (it3 != fixedtupleList->end())
-        {
-            std::vector<Particle*> atList = it3->second;
+        if (it3 == fixedtupleList->end())
+        {  // this should not happen
+            std::cout << " VP particle " << vp.id() << "-" << vp.ghost() << " not found in tuples ";
+            std::cout << " (" << vp.position() << ")\n";
+            exit(1);
+            return;
+        }
 
-            // Compute center of mass
-            Real3D cmp(0.0, 0.0, 0.0);  // center of mass position
-            Real3D cmv(0.0, 0.0, 0.0);  // center of mass velocity
-            for (auto it2 = atList.begin(); it2 != atList.end(); ++it2)
-            {
-                Particle& at = **it2;
-                cmp += at.mass() * at.position();
-                cmv += at.mass() * at.velocity();
-            }
-            cmp /= vp.getMass();
-            cmv /= vp.getMass();
+        vpBlock.push_back(&vp);
+        atBlock.insert(atBlock.end(), it3->second.begin(), it3->second.end());
+        atOffset.push_back(atBlock.size());
+    }
 
-            // update (overwrite) the position and velocity of the VP
-            vp.position() = cmp;
-            vp.velocity() = cmv;
+    blocksValid = true;
+}
 
-            if (KTI == false)
-            {
-                // calculate distance to nearest adress particle or center
-                std::vector<Real3D*>::iterator it2 = verletList->getAdrPositions().begin();
-                Real3D pa = **it2;  // position of adress particle
-                Real3D d1(0.0, 0.0, 0.0);
-                verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
-                real min1sq;
-                if (verletList->getAdrRegionType())
-                {                       // spherical adress region
-                    min1sq = d1.sqr();  // set min1sq before loop
-                    ++it2;
-                    for (; it2 != verletList->getAdrPositions().end(); ++it2)
-                    {
-                        pa = **it2;
-                        verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
-                        real distsq1 = d1.sqr();
-                        if (distsq1 < min1sq) min1sq = distsq1;
-                    }
-                }
-                else
-                {                            // slab-type adress region
-                    min1sq = d1[0] * d1[0];  // set min1sq before loop
-                    ++it2;
-                    for (; it2 != verletList->getAdrPositions().end(); ++it2)
-                    {
-                        pa = **it2;
-                        verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
-                        real distsq1 = d1[0] * d1[0];
-                        if (distsq1 < min1sq) min1sq = distsq1;
-                    }
-                }
+void Adress::updateCenterOfMass(size_t i, bool withPositions)
+{
+    Particle& vp = *vpBlock[i];
+    Particle* const* at = atBlock.data() + atOffset[i];
+    Particle* const* atEnd = atBlock.data() + atOffset[i + 1];
 
-                real w = weight(min1sq);
-                vp.lambda() = w;
+    Real3D cmp(0.0, 0.0, 0.0);  // center of mass position
+    Real3D cmv(0.0, 0.0, 0.0);  // center of mass velocity
+    for (; at != atEnd; ++at)
+    {
+        if (withPositions) cmp += (*at)->mass() * (*at)->position();
+        cmv += (*at)->mass() * (*at)->velocity();
+    }
 
-                real wDeriv = weightderivative(min1sq);
-                vp.lambdaDeriv() = wDeriv;
-            }
+    // update (overwrite) the position and velocity of the VP
+    if (withPositions) vp.position() = cmp / vp.getMass();
+    vp.velocity() = cmv / vp.getMass();
+}
+
+void Adress::updateWeight(Particle& vp)
+{
+    // calculate distance to nearest adress particle or center
+    std::vector<Real3D*>::iterator it2 = verletList->getAdrPositions().begin();
+    Real3D pa = **it2;  // position of adress particle
+    Real3D d1(0.0, 0.0, 0.0);
+    real min1sq;
+    verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
+    if (verletList->getAdrRegionType())
+    {                       // spherical adress region
+        min1sq = d1.sqr();  // set min1sq before loop
+        ++it2;
+        for (; it2 != verletList->getAdrPositions().end(); ++it2)
+        {
+            pa = **it2;
+            verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
+            real distsq1 = d1.sqr();
+            if (distsq1 < min1sq) min1sq = distsq1;
         }
-        else
-        {  // this should not happen
-            std::cout << " VP particle " << vp.id() << "-" << vp.ghost() << " not found in tuples ";
-            std::cout << " (" << vp.position() << ")\n";
-            exit(1);
-            return;
+    }
+    else
+    {                            // slab-type adress region
+        min1sq = d1[0] * d1[0];  // set min1sq before loop
+        ++it2;
+        for (; it2 != verletList->getAdrPositions().end(); ++it2)
+        {
+            pa = **it2;
+            verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
+            real distsq1 = d1[0] * d1[0];
+            if (distsq1 < min1sq) min1sq = distsq1;
         }
     }
+
+    vp.lambda() = weight(min1sq);
+    vp.lambdaDeriv() = weightderivative(min1sq);
+}
+
+void Adress::SetPosVel()
+{
+    // tuples may have been added since the last run, always start from a fresh index
+    buildBlocks();
+
+    // Set the positions and velocity of CG particles & update weights.
+    for (size_t i = 0; i < vpBlock.size(); ++i)
+    {
+        updateCenterOfMass(i, true);
+        if (KTI == false) updateWeight(*vpBlock[i]);
+    }
 }
 
 void Adress::initForces()
@@ -264,41 +293,10 @@ void Adress::integrate1(real& maxSqDist)
     }
 
     // Set the positions and velocity of CG particles
-    CellList localCells = system.storage->getLocalCells();
-    for (CellListIterator cit(localCells); !cit.isDone(); ++cit)
+    ensureBlocks();
+    for (size_t i = 0; i < vpBlock.size(); ++i)
     {
-        Particle& vp = *cit;
-
-        FixedTupleListAdress::iterator it3;
-        it3 = fixedtupleList->find(&vp);
-
-        if (it3 != fixedtupleList->end())
-        {
-            std::vector<Particle*> atList = it3->second;
-
-            // Compute center of mass
-            Real3D cmp(0.0, 0.0, 0.0);  // center of mass position
-            Real3D cmv(0.0, 0.0, 0.0);  // center of mass velocity
-            for (auto it2 = atList.begin(); it2 != atList.end(); ++it2)
-            {
-                Particle& at = **it2;
-                cmp += at.mass() * at.position();
-                cmv += at.mass() * at.velocity();
-            }
-            cmp /= vp.getMass();
-            cmv /= vp.getMass();
-
-            // update (overwrite) the position and velocity of the VP
-            vp.position() = cmp;
-            vp.velocity() = cmv;
-        }
-        else
-        {  // this should not happen
-            std::cout << " VP particle " << vp.id() << "-" << vp.ghost() << " not found in tuples ";
-            std::cout << " (" << vp.position() << ")\n";
-            exit(1);
-            return;
-        }
+        updateCenterOfMass(i, true);
     }
 
     // Communicate new position of region defining particles
@@ -307,69 +305,16 @@ void Adress::integrate1(real& maxSqDist)
     // Update resolution values if KTI == false
     if (KTI == false)
     {
-        CellList localCells2 = system.storage->getLocalCells();
-        for (CellListIterator cit(localCells); !cit.isDone(); ++cit)
+        for (size_t i = 0; i < vpBlock.size(); ++i)
         {
-            Particle& vp = *cit;
-
-            FixedTupleListAdress::iterator it3;
-            it3 = fixedtupleList->find(&vp);
-
-            if (it3 != fixedtupleList->end())
-            {
-                // calculate distance to nearest adress particle or center
-                std::vector<Real3D*>::iterator it2 = verletList->getAdrPositions().begin();
-                Real3D pa = **it2;  // position of adress particle
-                Real3D d1(0.0, 0.0, 0.0);
-                real min1sq;
-                verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
-                if (verletList->getAdrRegionType())
-                {                       // spherical adress region
-                    min1sq = d1.sqr();  // set min1sq before loop
-                    ++it2;
-                    for (; it2 != verletList->getAdrPositions().end(); ++it2)
-                    {
-                        pa = **it2;
-                        verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
-                        real distsq1 = d1.sqr();
-                        if (distsq1 < min1sq) min1sq = distsq1;
-                    }
-                }
-                else
-                {                            // slab-type adress region
-                    min1sq = d1[0] * d1[0];  // set min1sq before loop
-                    ++it2;
-                    for (; it2 != verletList->getAdrPositions().end(); ++it2)
-                    {
-                        pa = **it2;
-                        verletList->getSystem()->bc->getMinimumImageVector(d1, vp.position(), pa);
-                        real distsq1 = d1[0] * d1[0];
-                        if (distsq1 < min1sq) min1sq = distsq1;
-                    }
-                }
-
-                real w = weight(min1sq);
-                vp.lambda() = w;
-
-                real wDeriv = weightderivative(min1sq);
-                vp.lambdaDeriv() = wDeriv;
-
-                // This loop is required when applying routines which use atomistic lambdas.
-                /*for (std::vector<Particle*>::iterator it2 = atList.begin();
-                                 it2 != atList.end(); ++it2) {
-                    Particle &at = **it2;
-                    at.lambda() = vp.lambda();
-                    at.lambdaDeriv() = vp.lambdaDeriv();
-                }*/
-            }
-            else
-            {  // this should not happen
-                std::cout << " VP particle " << vp.id() << "-" << vp.ghost()
-                          << " not found in tuples ";
-                std::cout << " (" << vp.position() << ")\n";
-                exit(1);
-                return;
-            }
+            updateWeight(*vpBlock[i]);
+
+            // This loop is required when applying routines which use atomistic lambdas.
+            /*for (size_t j = atOffset[i]; j < atOffset[i + 1]; ++j) {
+                Particle &at = *atBlock[j];
+                at.lambda() = vpBlock[i]->lambda();
+                at.lambdaDeriv() = vpBlock[i]->lambdaDeriv();
+            }*/
         }
     }
 }
@@ -390,34 +335,10 @@ void Adress::integrate2()
     }
 
     // Update CG velocities
-    CellList localCells = system.storage->getLocalCells();
-    for (CellListIterator cit(localCells); !cit.isDone(); ++cit)
+    ensureBlocks();
+    for (size_t i = 0; i < vpBlock.size(); ++i)
     {
-        Particle& vp = *cit;
-
-        FixedTupleListAdress::iterator it3;
-        it3 = fixedtupleList->find(&vp);
-
-        if (it3 != fixedtupleList->end())
-        {
-            std::vector<Particle*> atList = it3->second;
-
-            Real3D cmv(0.0, 0.0, 0.0);  // center of mass velocity
-            for (auto it2 = atList.begin(); it2 != atList.end(); ++it2)
-            {
-                Particle& at = **it2;
-                cmv += at.mass() * at.velocity();
-            }
-            cmv /= vp.getMass();
-            vp.velocity() = cmv;
-        }
-        else
-        {  // this should not happen
-            std::cout << " VP particle " << vp.id() << "-" << vp.ghost() << " not found in tuples ";
-            std::cout << " (" << vp.position() << ")\n";
-            exit(1);
-            return;
-        }
+        updateCenterOfMass(i, false);
     }
 }
 
@@ -437,34 +358,10 @@ void Adress::integrateSlow()
     }
 
     // Update CG velocities
-    CellList localCells = system.storage->getLocalCells();
-    for (CellListIterator cit(localCells); !cit.isDone(); ++cit)
+    ensureBlocks();
+    for (size_t i = 0; i < vpBlock.size(); ++i)
     {
-        Particle& vp = *cit;
-
-        FixedTupleListAdress::iterator it3;
-        it3 = fixedtupleList->find(&vp);
-
-        if (it3 != fixedtupleList->end())
-        {
-            std::vector<Particle*> atList = it3->second;
-
-            Real3D cmv(0.0, 0.0, 0.0);  // center of mass velocity
-            for (auto it2 = atList.begin(); it2 != atList.end(); ++it2)
-            {
-                Particle& at = **it2;
-                cmv += at.mass() * at.velocity();
-            }
-            cmv /= vp.getMass();
-            vp.velocity() = cmv;
-        }
-        else
-        {  // this should not happen
-            std::cout << " VP particle " << vp.id() << "-" << vp.ghost() << " not found in tuples ";
-            std::cout << " (" << vp.position() << ")\n";
-            exit(1);
-            return;
-        }
+        updateCenterOfMass(i, false);
     }
 }
 
@@ -609,34 +506,17 @@ real Adress::weightderivative(real distanceSqr)
 
 void Adress::aftCalcF()
 {
-    System& system = getSystemRef();
-    CellList localCells = system.storage->getLocalCells();
-    for (CellListIterator cit(localCells); !cit.isDone(); ++cit)
+    ensureBlocks();
+    for (size_t i = 0; i < vpBlock.size(); ++i)
     {
-        Particle& vp = *cit;
+        Particle& vp = *vpBlock[i];
 
-        FixedTupleListAdress::iterator it3;
-        it3 = fixedtupleList->find(&vp);
-
-        if (it3 != fixedtupleList->end())
+        // update force of AT particles belonging to a VP
+        Real3D vpfm = vp.force() / vp.getMass();
+        for (size_t j = atOffset[i]; j < atOffset[i + 1]; ++j)
         {
-            std::vector<Particle*> atList = it3->second;
-
-            // update force of AT particles belonging to a VP
-            Real3D vpfm = vp.force() / vp.getMass();
-            for (auto it2 = atList.begin(); it2 != atList.end(); ++it2)
-            {
-                Particle& at = **it2;
-
-                at.force() += at.mass() * vpfm;
-            }
-        }
-        else
-        {  // this should not happen
-            std::cout << " particle " << vp.id() << "-" << vp.ghost() << " not found in tuples ";
-            std::cout << " (" << vp.position() << ")\n";
-            exit(1);
-            return;
+            Particle& at = *atBlock[j];
+            at.force() += at.mass() * vpfm;
         }
     }
 }
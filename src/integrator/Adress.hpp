@@ -70,6 +70,16 @@ public:
 private:
     boost::signals2::connection _SetPosVel, _initForces, _integrate1, _integrate2, _integrateSlow,
         _aftCalcSlow, _recalc2, _befIntV;  //_aftCalcF;
+    boost::signals2::connection _onParticlesChanged, _onTuplesChanged;
+
+    /** Flat VP -> AT index: the atoms of vpBlock[i] are
+        atBlock[atOffset[i]] ... atBlock[atOffset[i+1]-1]. Rebuilt lazily
+        after the storage has moved particles, so that the per-step
+        sweeps do not need a tuple map lookup per VP. */
+    std::vector<Particle*> vpBlock;
+    std::vector<size_t> atOffset;
+    std::vector<Particle*> atBlock;
+    bool blocksValid;
 
     void integrate1(real&);
     void initForces();
@@ -78,6 +88,14 @@ private:
     void integrateSlow();
     void aftCalcF();
     void communicateAdrPositions();
+    void invalidateBlocks() { blocksValid = false; }
+    void buildBlocks();
+    void ensureBlocks()
+    {
+        if (!blocksValid) buildBlocks();
+    }
+    void updateCenterOfMass(size_t i, bool withPositions);
+    void updateWeight(Particle& vp);
 
     void connect();
     void disconnect();
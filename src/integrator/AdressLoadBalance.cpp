@@ -0,0 +1,188 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "AdressLoadBalance.hpp"
+
+#include "System.hpp"
+#include "MDIntegrator.hpp"
+#include "storage/NodeGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <boost/mpi/collectives.hpp>
+
+namespace espressopp
+{
+namespace integrator
+{
+LOG4ESPP_LOGGER(AdressLoadBalance::theLogger, "AdressLoadBalance");
+
+AdressLoadBalance::AdressLoadBalance(std::shared_ptr<System> _system,
+                                     int _interval,
+                                     int _axis,
+                                     real _tolerance,
+                                     real _damping)
+    : Extension(_system),
+      interval(_interval),
+      axis(_axis),
+      tolerance(_tolerance),
+      damping(_damping),
+      forceTime(0.0),
+      imbalance(1.0),
+      nRebalances(0)
+{
+    LOG4ESPP_INFO(theLogger, "construct AdressLoadBalance");
+    type = Extension::Adress;
+
+    domdec = std::dynamic_pointer_cast<storage::DomainDecompositionAdress>(_system->storage);
+    if (!domdec)
+    {
+        throw std::runtime_error("AdressLoadBalance needs a DomainDecompositionAdress storage");
+    }
+    if (interval < 1 || axis < 0 || axis > 2 || damping <= 0.0 || damping > 1.0)
+    {
+        throw std::invalid_argument(
+            "AdressLoadBalance: need interval >= 1, axis in 0..2 and 0 < damping <= 1");
+    }
+}
+
+AdressLoadBalance::~AdressLoadBalance()
+{
+    LOG4ESPP_INFO(theLogger, "~AdressLoadBalance");
+    disconnect();
+}
+
+void AdressLoadBalance::connect()
+{
+    // time the short range interactions only, the ghost force collection contains the waiting
+    // time on slower neighbours
+    _aftInitF = integrator->aftInitF.connect(std::bind(&AdressLoadBalance::startTimer, this),
+                                             boost::signals2::at_back);
+    _aftCalcFLocal = integrator->aftCalcFLocal.connect(
+        std::bind(&AdressLoadBalance::stopTimer, this), boost::signals2::at_front);
+
+    // after the AdResS velocity update, so that the step is complete
+    _aftIntV = integrator->aftIntV.connect(std::bind(&AdressLoadBalance::onStep, this),
+                                           boost::signals2::at_back);
+}
+
+void AdressLoadBalance::disconnect()
+{
+    _aftInitF.disconnect();
+    _aftCalcFLocal.disconnect();
+    _aftIntV.disconnect();
+}
+
+void AdressLoadBalance::onStep()
+{
+    if (integrator->getStep() % interval == 0) rebalance();
+}
+
+void AdressLoadBalance::rebalance()
+{
+    System& system = getSystemRef();
+    const storage::NodeGrid& nodeGrid = domdec->getNodeGrid();
+    int nSlabs = nodeGrid.getGridSize(axis);
+
+    // cost per slab of nodes along axis
+    std::vector<real> localCost(nSlabs, 0.0), slabCost(nSlabs, 0.0);
+    localCost[nodeGrid.getNodePosition(axis)] = forceTime;
+    boost::mpi::all_reduce(*system.comm, &localCost[0], nSlabs, &slabCost[0], std::plus<real>());
+    forceTime = 0.0;
+
+    real total = 0.0, maxCost = 0.0;
+    for (int k = 0; k < nSlabs; ++k)
+    {
+        total += slabCost[k];
+        maxCost = std::max(maxCost, slabCost[k]);
+    }
+    if (nSlabs < 2 || total <= 0.0) return;
+
+    imbalance = maxCost * nSlabs / total;
+    LOG4ESPP_INFO(theLogger, "load imbalance along " << axis << ": " << imbalance);
+    if (imbalance < 1.0 + tolerance) return;
+
+    std::vector<real> oldBounds = domdec->getNodeBoundaries(axis);
+    std::vector<real> newBounds(oldBounds);
+    real minWidth = system.maxCutoff + system.getSkin();
+
+    // place boundary k where the cumulative cost reaches k / nSlabs of the total
+    real cumCost = 0.0;
+    int slab = 0;
+    for (int k = 1; k < nSlabs; ++k)
+    {
+        real target = total * k / nSlabs;
+        while (slab < nSlabs - 1 && cumCost + slabCost[slab] < target)
+        {
+            cumCost += slabCost[slab];
+            ++slab;
+        }
+        real frac = (slabCost[slab] > 0.0) ? (target - cumCost) / slabCost[slab] : 0.0;
+        frac = std::min(std::max(frac, real(0.0)), real(1.0));
+        real ideal = oldBounds[slab] + frac * (oldBounds[slab + 1] - oldBounds[slab]);
+
+        real b = oldBounds[k] + damping * (ideal - oldBounds[k]);
+        newBounds[k] = std::min(std::max(b, oldBounds[k - 1]), oldBounds[k + 1]);
+    }
+
+    // keep every domain at least one cell wide
+    for (int k = 1; k < nSlabs; ++k)
+    {
+        newBounds[k] = std::max(newBounds[k], newBounds[k - 1] + minWidth);
+    }
+    for (int k = nSlabs - 1; k > 0; --k)
+    {
+        newBounds[k] = std::min(newBounds[k], newBounds[k + 1] - minWidth);
+    }
+
+    real maxShift = 0.0;
+    for (int k = 1; k < nSlabs; ++k)
+    {
+        if (newBounds[k] - newBounds[k - 1] < minWidth) return;  // box too small for nSlabs
+        maxShift = std::max(maxShift, std::fabs(newBounds[k] - oldBounds[k]));
+    }
+    if (maxShift < 0.01 * minWidth) return;
+
+    domdec->setNodeBoundaries(axis, newBounds);
+    ++nRebalances;
+}
+
+/****************************************************
+** REGISTRATION WITH PYTHON
+****************************************************/
+
+void AdressLoadBalance::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<AdressLoadBalance, std::shared_ptr<AdressLoadBalance>, bases<Extension> >(
+        "integrator_AdressLoadBalance", init<std::shared_ptr<System>, int, int, real, real>())
+        .add_property("imbalance", &AdressLoadBalance::getImbalance)
+        .add_property("nrebalances", &AdressLoadBalance::getNumberOfRebalances)
+        .def("rebalance", &AdressLoadBalance::rebalance)
+        .def("connect", &AdressLoadBalance::connect)
+        .def("disconnect", &AdressLoadBalance::disconnect);
+}
+
+}  // namespace integrator
+}  // namespace espressopp
@@ -0,0 +1,96 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTEGRATOR_ADRESSLOADBALANCE_HPP
+#define _INTEGRATOR_ADRESSLOADBALANCE_HPP
+
+#include "types.hpp"
+#include "logging.hpp"
+#include "Extension.hpp"
+#include "esutil/Timer.hpp"
+#include "storage/DomainDecompositionAdress.hpp"
+#include "boost/signals2.hpp"
+
+namespace espressopp
+{
+namespace integrator
+{
+/** Runtime load balancing for AdResS runs on a DomainDecompositionAdress.
+
+    Every rank times its short range interactions (between aftInitF and
+    aftCalcFLocal). Every interval steps the times are summed per slab of
+    nodes along axis, and if the slowest slab exceeds the average by more
+    than tolerance, the node boundaries along axis are moved towards an even
+    split of the measured cost. The cost is assumed to be spread evenly
+    within a slab, and the boundaries move only a fraction damping of the
+    way per rebalance, so that a moving atomistic region is followed over
+    several rebalances. A boundary never moves past the neighbouring old
+    boundaries, so particles migrate to direct neighbours only. */
+class AdressLoadBalance : public Extension
+{
+public:
+    AdressLoadBalance(std::shared_ptr<System> _system,
+                      int _interval,
+                      int _axis,
+                      real _tolerance,
+                      real _damping);
+
+    virtual ~AdressLoadBalance();
+
+    /// measure and, if needed, rebalance right now
+    void rebalance();
+
+    /// slowest slab over average slab cost at the last measurement
+    real getImbalance() const { return imbalance; }
+    /// how often the node boundaries were moved
+    int getNumberOfRebalances() const { return nRebalances; }
+
+    /** Register this class so it can be used from Python. */
+    static void registerPython();
+
+private:
+    boost::signals2::connection _aftInitF, _aftCalcFLocal, _aftIntV;
+
+    std::shared_ptr<storage::DomainDecompositionAdress> domdec;
+    int interval;
+    int axis;
+    real tolerance;
+    real damping;
+
+    esutil::WallTimer timer;
+    real forceTime;  // interaction time since the last rebalance
+    real imbalance;
+    int nRebalances;
+
+    void startTimer() { timer.reset(); }
+    void stopTimer() { forceTime += timer.getElapsedTime(); }
+    void onStep();
+
+    void connect();
+    void disconnect();
+
+    /** Logger */
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+};
+}  // namespace integrator
+}  // namespace espressopp
+
+#endif
@@ -0,0 +1,92 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+***************************************
+espressopp.integrator.AdressLoadBalance
+***************************************
+
+Runtime load balancing for AdResS and H-AdResS simulations on a
+:class:`espressopp.storage.DomainDecompositionAdress`.
+
+The node grid chosen at setup (e.g. with HeSpaDDA in :mod:`espressopp.tools.loadbal`)
+only fits the initial position of the atomistic region. When the region moves, for
+example when it is centered on particles given by adrList, the expensive part of the
+system drifts across the domains. This extension measures on every CPU the time spent
+in the short range interactions and, every interval steps, moves the domain boundaries
+along one axis so that every slab of CPUs gets about the same interaction time.
+
+Particles that change their domain are migrated together with their atomistic particles
+by the usual tuple communication of the storage. A boundary moves at most
+damping times the distance to its ideal position per rebalance, and never past the
+neighbouring boundaries, so the decomposition follows the atomistic region gradually.
+Rebalancing is skipped while the slowest slab is within tolerance of the average.
+
+Example:
+
+>>> lb = espressopp.integrator.AdressLoadBalance(system, interval=500, axis=0)
+>>> integrator.addExtension(lb)
+>>> integrator.run(10000)
+>>> print(lb.imbalance, lb.nrebalances)
+
+.. py:class:: espressopp.integrator.AdressLoadBalance(system, interval, axis, tolerance, damping)
+
+                :param system: system object with a DomainDecompositionAdress storage
+                :param interval: (default: 1000) steps between two load measurements
+                :param axis: (default: 0) axis along which the domain boundaries move
+                :param tolerance: (default: 0.1) accepted relative excess of the slowest slab
+                :param damping: (default: 0.5) fraction of the way to the balanced boundaries moved per rebalance
+                :type system: std::shared_ptr<System>
+                :type interval: int
+                :type axis: int
+                :type tolerance: real
+                :type damping: real
+
+.. py:method:: rebalance()
+
+                Measures the load now and moves the boundaries if needed.
+
+.. py:attribute:: imbalance
+
+                slowest slab over the average slab cost at the last measurement
+
+.. py:attribute:: nrebalances
+
+                number of times the domain boundaries were moved
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.integrator.Extension import *
+from _espressopp import integrator_AdressLoadBalance
+
+class AdressLoadBalanceLocal(ExtensionLocal, integrator_AdressLoadBalance):
+
+    def __init__(self, system, interval=1000, axis=0, tolerance=0.1, damping=0.5):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, integrator_AdressLoadBalance, system, interval, axis, tolerance, damping)
+
+if pmi.isController:
+    class AdressLoadBalance(Extension, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls = 'espressopp.integrator.AdressLoadBalanceLocal',
+            pmicall = ['rebalance'],
+            pmiproperty = ['imbalance', 'nrebalances']
+            )
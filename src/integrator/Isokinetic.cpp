@@ -26,6 +26,7 @@
 #include "storage/Storage.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "esutil/RNG.hpp"
+#include "esutil/Collectives.hpp"
 #include "Isokinetic.hpp"
 
 namespace espressopp
@@ -106,8 +107,12 @@ void Isokinetic::rescaleVelocities()
     }
     EKin_local *= 0.5;
 
-    boost::mpi::all_reduce(*getSystem()->comm, EKin_local, EKin, std::plus<real>());
-    boost::mpi::all_reduce(*getSystem()->comm, NPart_local, NPart, std::plus<int>());
+    // one collective for both sums
+    esutil::ReductionBatch reduction(getSystem()->comm);
+    esutil::ReductionBatch::Handle hEKin = reduction.addSum(EKin_local);
+    esutil::ReductionBatch::Handle hNPart = reduction.addSum(real(NPart_local));
+    EKin = reduction.sum(hEKin);
+    NPart = static_cast<int>(reduction.sum(hNPart) + 0.5);
 
     DegreesOfFreedom = 1.5 * NPart;  // 3.0/2.0
     currentTemperature = EKin / DegreesOfFreedom;
@@ -24,12 +24,14 @@
 #include <iomanip>  // for setprecision output in std
 #include <fstream>
 #include <boost/filesystem.hpp>
+#include <algorithm>
 
 #include "storage/Storage.hpp"
 #include "iterator/CellListIterator.hpp"
 #include "esutil/RNG.hpp"
 #include "esutil/Grid.hpp"
 #include "bc/BC.hpp"
+#include "io/hdf5.hpp"
 
 #define REQ_HALO_SPREAD 501
 #define COMM_DIR_0 700
@@ -88,6 +90,7 @@ LatticeBoltzmann::LatticeBoltzmann(std::shared_ptr<System> _system,
     setNSteps(1);          // # MD steps between LB update
     setPrevDumpStep(0);    // interval between dumping coupl-files
     setProfStep(10000);    // set default time profiling step
+    setCompression(0);     // write LB dumps uncompressed
 
     /* find total number of MD particles*/
     int _Npart = _system->storage->getNRealParticles();
@@ -95,17 +98,11 @@ LatticeBoltzmann::LatticeBoltzmann(std::shared_ptr<System> _system,
     mpi::all_reduce(*getSystem()->comm, _Npart, _totNPart, std::plus<int>());
     setTotNPart(_totNPart);
 
-    /* if coupling is present initialise related flags, coefficients and arrays */
-    fOnPart = std::vector<Real3D>(_totNPart + 1, Real3D(0.));  // +1 as id starts with 1
+    /* if coupling is present initialise related flags and coefficients */
     if (_totNPart != 0)
     {
         setDoCoupling(true);  // make LB to MD coupling
         setFricCoeff(5.);     // friction coeffitient
-
-        for (int _id = 0; _id <= _totNPart; _id++)
-        {
-            setFOnPart(_id, Real3D(0.));
-        }
     }
 
     /* setup domain decompositions for LB */
@@ -119,6 +116,9 @@ LatticeBoltzmann::LatticeBoltzmann(std::shared_ptr<System> _system,
     /* initialize lattice sizes */
     initLatticeSize();
 
+    /* preallocate halo buffers and bind persistent requests to them */
+    initHaloComm();
+
     /* initialise global weights and coefficients from the local ones */
     initLatticeModel();
 
@@ -137,6 +137,10 @@ void LatticeBoltzmann::disconnect()
 {
     _recalc2.disconnect();
     _befIntV.disconnect();
+    _befSendParticles.disconnect();
+    _aftRecvParticles.disconnect();
+
+    freeHaloComm();
 
     delete (lbfluid);
     delete (ghostlat);
@@ -148,6 +152,59 @@ void LatticeBoltzmann::connect()
 {
     _recalc2 = integrator->recalc2.connect(std::bind(&LatticeBoltzmann::zeroMDCMVel, this));
     _befIntV = integrator->befIntV.connect(std::bind(&LatticeBoltzmann::makeLBStep, this));
+
+    // coupling forces travel together with their particles
+    std::shared_ptr<storage::Storage> storage = getSystem()->storage;
+    _befSendParticles = storage->beforeSendParticles.connect(
+        std::bind(&LatticeBoltzmann::beforeSendParticles, this, std::placeholders::_1,
+                  std::placeholders::_2));
+    _aftRecvParticles = storage->afterRecvParticles.connect(
+        std::bind(&LatticeBoltzmann::afterRecvParticles, this, std::placeholders::_1,
+                  std::placeholders::_2));
+}
+
+/*******************************************************************************************/
+
+/* PACK COUPLING FORCES OF PARTICLES LEAVING THIS CPU */
+void LatticeBoltzmann::beforeSendParticles(ParticleList& pl, OutBuffer& buf)
+{
+    std::vector<longint> toSendIds;
+    std::vector<real> toSendForces;
+    toSendIds.reserve(pl.size());
+    toSendForces.reserve(3 * pl.size());
+
+    for (ParticleList::Iterator pit(pl); pit.isValid(); ++pit)
+    {
+        boost::unordered_map<longint, Real3D>::iterator it = fOnPart.find(pit->id());
+        if (it == fOnPart.end()) continue;
+
+        toSendIds.push_back(it->first);
+        for (int _dir = 0; _dir < 3; ++_dir)
+        {
+            toSendForces.push_back(it->second[_dir]);
+        }
+        fOnPart.erase(it);
+    }
+
+    buf.write(toSendIds);
+    buf.write(toSendForces);
+}
+
+/*******************************************************************************************/
+
+/* UNPACK COUPLING FORCES OF PARTICLES ARRIVING AT THIS CPU */
+void LatticeBoltzmann::afterRecvParticles(ParticleList& pl, InBuffer& buf)
+{
+    std::vector<longint> receivedIds;
+    std::vector<real> receivedForces;
+    buf.read(receivedIds);
+    buf.read(receivedForces);
+
+    for (size_t _n = 0; _n < receivedIds.size(); ++_n)
+    {
+        fOnPart[receivedIds[_n]] = Real3D(receivedForces[3 * _n], receivedForces[3 * _n + 1],
+                                          receivedForces[3 * _n + 2]);
+    }
 }
 
 /*******************************************************************************************/
@@ -305,9 +362,13 @@ int LatticeBoltzmann::getPrevDumpStep() { return saveStep; }
 void LatticeBoltzmann::setTotNPart(int _totNPart) { totNPart = _totNPart; }
 int LatticeBoltzmann::getTotNPart() { return totNPart; }
 
-void LatticeBoltzmann::setFOnPart(int _id, Real3D _fOnPart) { fOnPart[_id] = _fOnPart; }
-Real3D LatticeBoltzmann::getFOnPart(int _id) { return fOnPart[_id]; }
-void LatticeBoltzmann::addFOnPart(int _id, Real3D _fOnPart) { fOnPart[_id] += _fOnPart; }
+void LatticeBoltzmann::setFOnPart(longint _id, Real3D _fOnPart) { fOnPart[_id] = _fOnPart; }
+Real3D LatticeBoltzmann::getFOnPart(longint _id)
+{
+    boost::unordered_map<longint, Real3D>::const_iterator it = fOnPart.find(_id);
+    return (it != fOnPart.end()) ? it->second : Real3D(0.);
+}
+void LatticeBoltzmann::addFOnPart(longint _id, Real3D _fOnPart) { fOnPart[_id] += _fOnPart; }
 
 void LatticeBoltzmann::keepLBDump() { setPrevDumpStep(0); }
 
@@ -359,6 +420,10 @@ real LatticeBoltzmann::getCopyTimestep() { return copyTimestep; }
 void LatticeBoltzmann::setDoRestart(bool _restart) { restart = _restart; }
 bool LatticeBoltzmann::doRestart() { return restart; }
 
+/* Deflate level of the dumped LB configuration, 0 - no compression */
+void LatticeBoltzmann::setCompression(int _compression) { compression = _compression; }
+int LatticeBoltzmann::getCompression() { return compression; }
+
 /*******************************************************************************************/
 
 /* INITIALIZATION OF THE LATTICE */
@@ -616,8 +681,6 @@ void LatticeBoltzmann::makeDecompose()
 void LatticeBoltzmann::collideStream()
 {
     int _offset = getHaloSkin();
-    bool _extForce = doExtForce();
-    bool _fluct = doFluct();
     bool _coupling = doCoupling();
     Int3D _myNi = getMyNi();
 
@@ -627,27 +690,31 @@ void LatticeBoltzmann::collideStream()
         copyForcesFromHalo();
     }
 
-    // collision-streaming //
+    // collision-streaming of the boundary slabs, they fill the x-halo planes //
+    int _iFirst = _offset;
+    int _iLast = _myNi[0] - _offset - 1;
     real timer = colstream.getElapsedTime();
-    for (int i = _offset; i < _myNi[0] - _offset; i++)
-    {
-        for (int j = _offset; j < _myNi[1] - _offset; j++)
-        {
-            for (int k = _offset; k < _myNi[2] - _offset; k++)
-            {
-                Real3D _f =
-                    (*lbfor)[i][j][k].getExtForceLoc() + (*lbfor)[i][j][k].getCouplForceLoc();
+    collideStreamSlab(_iFirst, _iFirst + 1);
+    if (_iLast > _iFirst) collideStreamSlab(_iLast, _iLast + 1);
+    time_colstr += (colstream.getElapsedTime() - timer);
 
-                (*lbfluid)[i][j][k].collision(_fluct, _extForce, _coupling, _f, gamma);
-                streaming(i, j, k);
-            }
-        }
-    }
+    // ship the x-halo while the interior is being processed //
+    timer = comm.getElapsedTime();
+    postHaloPops(0);
+    time_comm += (comm.getElapsedTime() - timer);
+
+    timer = colstream.getElapsedTime();
+    collideStreamSlab(_iFirst + 1, _iLast);
     time_colstr += (colstream.getElapsedTime() - timer);
 
-    // halo communication //
+    // halo communication: finish x, then y and z carrying the edges filled by x //
     timer = comm.getElapsedTime();
-    commHalo();
+    completeHaloPops(0);
+    for (int _dim = 1; _dim < 3; ++_dim)
+    {
+        postHaloPops(_dim);
+        completeHaloPops(_dim);
+    }
     time_comm += (comm.getElapsedTime() - timer);
 
     /* swapping of the pointers to the lattices */
@@ -681,6 +748,33 @@ void LatticeBoltzmann::collideStream()
 
 /*******************************************************************************************/
 
+/* COLLIDE-STREAM REAL SITES WITH X-INDEX IN [_iBegin, _iEnd) */
+void LatticeBoltzmann::collideStreamSlab(int _iBegin, int _iEnd)
+{
+    int _offset = getHaloSkin();
+    bool _extForce = doExtForce();
+    bool _fluct = doFluct();
+    bool _coupling = doCoupling();
+    Int3D _myNi = getMyNi();
+
+    for (int i = _iBegin; i < _iEnd; i++)
+    {
+        for (int j = _offset; j < _myNi[1] - _offset; j++)
+        {
+            for (int k = _offset; k < _myNi[2] - _offset; k++)
+            {
+                Real3D _f =
+                    (*lbfor)[i][j][k].getExtForceLoc() + (*lbfor)[i][j][k].getCouplForceLoc();
+
+                (*lbfluid)[i][j][k].collision(_fluct, _extForce, _coupling, _f, gamma);
+                streaming(i, j, k);
+            }
+        }
+    }
+}
+
+/*******************************************************************************************/
+
 /* STREAMING ALONG THE VELOCITY VECTORS. SERIAL */
 // periodic boundaries are handled separately in commHalo() //
 void LatticeBoltzmann::streaming(int _i, int _j, int _k)
@@ -721,81 +815,75 @@ void LatticeBoltzmann::streaming(int _i, int _j, int _k)
 
 /*******************************************************************************************/
 
+namespace
+{
+/* WEIGHT OF CELL CORNER _c (BITS i,j,k) FOR A PARTICLE AT _delta INSIDE THE CELL */
+inline real couplWeight(const Real3D& _delta, real _a, int _c)
+{
+    real _wx = (_c & 4) ? _a - _delta[0] : _delta[0];
+    real _wy = (_c & 2) ? _a - _delta[1] : _delta[1];
+    real _wz = (_c & 1) ? _a - _delta[2] : _delta[2];
+    return _wx * _wy * _wz;
+}
+}  // namespace
+
 /* SCHEME OF MD TO LB COUPLING */
+// All local particles are coupled as one batch sorted by lattice cell. Every particle sees
+// the fluid as it was before this step's coupling forces, particles sharing a cell reuse the
+// corner velocities and pool the momentum they hand back to the corners.
 void LatticeBoltzmann::coupleLBtoMD()
 {
     setDoExtForce(true);
 
+    int _offset = getHaloSkin();
+    real _a = getA();
+    real _invA = 1. / _a;
+    real _fricCoeff = getFricCoeff();
+    Int3D _myNi = getMyNi();
+    Real3D _myLeft = getMyLeft();
+
+    // unit conversions are the same for all particles
+    real _convTimeMDtoLB = convTimeMDtoLB();
+    real _convCoeff = _convTimeMDtoLB / convLenMDtoLB();
+    real _convForce = convMassMDtoLB() / (_convCoeff * _convTimeMDtoLB);
+
     System& system = getSystemRef();
     CellList realCells = system.storage->getRealCells();
 
-    // loop over all real particles in the current CPU
+    // gather real particles with their lattice cells, random forces are drawn in cell order
+    couplBatch.clear();
     for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
     {
         calcRandForce(*cit);  // random force from fluid onto particle
-        calcViscForce(*cit);  // viscous force from fluid onto particle
-    }
-}
-
-/*******************************************************************************************/
-
-void LatticeBoltzmann::calcRandForce(Particle& p)
-{
-    real _fricCoeff = getFricCoeff();              // coupling friction
-    real _invdt = 1. / integrator->getTimeStep();  // MD timestep
-    real _tempLB = getLBTemp();
 
-    // noise amplitude and 3d uniform random number
-    real prefactor = sqrt(24. * _fricCoeff * _tempLB * _invdt);
-    Real3D ranval((*rng)() - .5, (*rng)() - .5, (*rng)() - .5);
-    // noise amplitude and 3d Gaussian random number
-    //         real prefactor = sqrt(2. * _fricCoeff * _tempLB / _timestep);
-    //         Real3D ranval(rng->normal(), rng->normal(), rng->normal());
-    setFOnPart(p.id(), prefactor * ranval);
-}
-
-/*******************************************************************************************/
-
-void LatticeBoltzmann::calcViscForce(Particle& p)
-{
-    int _offset = getHaloSkin();
-    real _a = getA();
-    real _invA = 1. / _a;
-    real _fricCoeff = getFricCoeff();
+        // account for particle's positions with respect to CPU's left border
+        Real3D _posLB = (cit->position() - _myLeft + (double)_offset) * _invA;
 
-    // account for particle's positions with respect to CPU's left border
-    Real3D _pos = p.position() - getMyLeft();
-    Real3D _posLB = (_pos + (double)_offset) * _invA;
-
-    Int3D bin = Int3D(floor(_posLB[0]), floor(_posLB[1]), floor(_posLB[2]));
-
-    // weight factors, dimensionless
-    std::vector<real> delta = std::vector<real>(6, 0.);
-    delta[0] = _posLB[0] - bin[0];
-    delta[1] = _posLB[1] - bin[1];
-    delta[2] = _posLB[2] - bin[2];
-    delta[3] = _a - delta[0];
-    delta[4] = _a - delta[1];
-    delta[5] = _a - delta[2];
+        CouplEntry entry;
+        entry.bin = Int3D(floor(_posLB[0]), floor(_posLB[1]), floor(_posLB[2]));
+        entry.site = (entry.bin[0] * _myNi[1] + entry.bin[1]) * _myNi[2] + entry.bin[2];
+        entry.delta = _posLB - Real3D(entry.bin[0], entry.bin[1], entry.bin[2]);
+        entry.part = &(*cit);
+        couplBatch.push_back(entry);
+    }
+    std::stable_sort(couplBatch.begin(), couplBatch.end(),
+                     [](const CouplEntry& _e1, const CouplEntry& _e2)
+                     { return _e1.site < _e2.site; });
 
-    real _convTimeMDtoLB = convTimeMDtoLB();
-    real _convLenMDtoLB = convLenMDtoLB();
-    real _convMassMDtoLB = convMassMDtoLB();
-    real _convCoeff = _convTimeMDtoLB / _convLenMDtoLB;
-
-    Real3D interpVel = Real3D(0.);
-    // loop over neighboring LB nodes
-    int _ip, _jp, _kp;
-    for (int _i = 0; _i < 2; _i++)
+    // viscous force from fluid onto particles //
+    Real3D _u[8];  // fluid velocity at the corners of the current cell
+    int _site = -1;
+    for (size_t _n = 0; _n < couplBatch.size(); ++_n)
     {
-        for (int _j = 0; _j < 2; _j++)
+        CouplEntry& entry = couplBatch[_n];
+        if (entry.site != _site)
         {
-            for (int _k = 0; _k < 2; _k++)
+            _site = entry.site;
+            for (int _c = 0; _c < 8; _c++)
             {
-                // assign iterations
-                _ip = bin[0] + _i;
-                _jp = bin[1] + _j;
-                _kp = bin[2] + _k;
+                int _ip = entry.bin[0] + (_c >> 2);
+                int _jp = entry.bin[1] + ((_c >> 1) & 1);
+                int _kp = entry.bin[2] + (_c & 1);
 
                 // force acting onto the fluid node at the moment (midpoint scheme)
                 Real3D _f = (*lbfor)[_ip][_jp][_kp].getExtForceLoc() +
@@ -805,42 +893,47 @@ void LatticeBoltzmann::calcViscForce(Particle& p)
                                       (*lbmom)[_ip][_jp][_kp].getMom_i(3) + _f[2]);
                 real _invDenLoc = 1. / (*lbmom)[_ip][_jp][_kp].getMom_i(0);
 
-                Real3D _u = _jLoc * _invDenLoc * _convCoeff;
-                interpVel += _u * delta[3 * _i] * delta[3 * _j + 1] * delta[3 * _k + 2];
+                _u[_c] = _jLoc * _invDenLoc * _convCoeff;
             }
         }
-    }
 
-    // add visc force to the buffered rand force acting onto particle p.id()
-    addFOnPart(p.id(), -_fricCoeff * (p.velocity() - interpVel));
+        Real3D interpVel = Real3D(0.);
+        for (int _c = 0; _c < 8; _c++)
+        {
+            interpVel += _u[_c] * couplWeight(entry.delta, _a, _c);
+        }
 
-    // apply buffered force to the MD-particle p.id()
-    p.force() += getFOnPart(p.id());
+        // add visc force to the buffered rand force acting onto the particle
+        Particle& p = *entry.part;
+        addFOnPart(p.id(), -_fricCoeff * (p.velocity() - interpVel));
 
-    // convert coupl force (LJ units) to mom change on a lattice (LB units)
-    Real3D deltaJLoc = Real3D(0.);
-    deltaJLoc -= getFOnPart(p.id()) * _convMassMDtoLB / (_convCoeff * _convTimeMDtoLB);
+        // apply buffered force to the MD-particle
+        entry.force = getFOnPart(p.id());
+        p.force() += entry.force;
+    }
 
-    // loop over neighboring LB nodes
-    for (int _i = 0; _i < 2; _i++)
+    // spread coupling forces onto the lattice //
+    // convert coupl force (LJ units) to mom change on a lattice (LB units) pooled per cell
+    Real3D _dJ[8];
+    for (size_t _n = 0; _n < couplBatch.size(); ++_n)
     {
-        for (int _j = 0; _j < 2; _j++)
+        const CouplEntry& entry = couplBatch[_n];
+        for (int _c = 0; _c < 8; _c++)
         {
-            for (int _k = 0; _k < 2; _k++)
-            {
-                // PBC on the right (left is safe)
-                _ip = bin[0] + _i;
-                _jp = bin[1] + _j;
-                _kp = bin[2] + _k;
+            _dJ[_c] -= entry.force * _convForce * couplWeight(entry.delta, _a, _c);
+        }
 
-                // converting momentum into coupling force with weights delta[i]
-                Real3D _fLoc = deltaJLoc;
-                _fLoc *= delta[3 * _i];
-                _fLoc *= delta[3 * _j + 1];
-                _fLoc *= delta[3 * _k + 2];
+        if (_n + 1 == couplBatch.size() || couplBatch[_n + 1].site != entry.site)
+        {
+            for (int _c = 0; _c < 8; _c++)
+            {
+                int _ip = entry.bin[0] + (_c >> 2);
+                int _jp = entry.bin[1] + ((_c >> 1) & 1);
+                int _kp = entry.bin[2] + (_c & 1);
 
                 // add coupling force to the correspondent lattice cite
-                (*lbfor)[_ip][_jp][_kp].addCouplForceLoc(_fLoc);
+                (*lbfor)[_ip][_jp][_kp].addCouplForceLoc(_dJ[_c]);
+                _dJ[_c] = Real3D(0.);
             }
         }
     }
@@ -848,6 +941,23 @@ void LatticeBoltzmann::calcViscForce(Particle& p)
 
 /*******************************************************************************************/
 
+void LatticeBoltzmann::calcRandForce(Particle& p)
+{
+    real _fricCoeff = getFricCoeff();              // coupling friction
+    real _invdt = 1. / integrator->getTimeStep();  // MD timestep
+    real _tempLB = getLBTemp();
+
+    // noise amplitude and 3d uniform random number
+    real prefactor = sqrt(24. * _fricCoeff * _tempLB * _invdt);
+    Real3D ranval((*rng)() - .5, (*rng)() - .5, (*rng)() - .5);
+    // noise amplitude and 3d Gaussian random number
+    //         real prefactor = sqrt(2. * _fricCoeff * _tempLB / _timestep);
+    //         Real3D ranval(rng->normal(), rng->normal(), rng->normal());
+    setFOnPart(p.id(), prefactor * ranval);
+}
+
+/*******************************************************************************************/
+
 /* CALCULATE DENSITY AND J AT THE LATTICE SITES IN REAL REGION */
 void LatticeBoltzmann::calcDenMom()
 {
@@ -976,6 +1086,37 @@ void LatticeBoltzmann::galileanTransf(Real3D _specCmVel)
 
 /*******************************************************************************************/
 
+namespace
+{
+/* NAME OF THE LB CONFIGURATION DUMPED AT STEP _step */
+std::string lbConfFilename(int _step)
+{
+    std::ostringstream filename;
+    filename << "dump/lbConf." << _step << ".h5";
+    return filename.str();
+}
+
+/* GLOBAL OFFSET AND EXTENT OF THE REAL SITES OF A CPU */
+void lbConfSlab(LatticeBoltzmann& lb,
+                std::vector<hsize_t>& _globalOffset,
+                std::vector<hsize_t>& _localDims)
+{
+    int _offset = lb.getHaloSkin();
+    Int3D _Ni = lb.getNi();
+    Int3D _myNi = lb.getMyNi();
+    Real3D _myLeft = lb.getMyLeft();
+
+    _globalOffset.resize(3);
+    _localDims.resize(3);
+    for (int _dim = 0; _dim < 3; ++_dim)
+    {
+        _globalOffset[_dim] = hsize_t(_myLeft[_dim]);
+        _localDims[_dim] = hsize_t(_myNi[_dim] - 2 * _offset);
+        CHECK_LESS_EQUAL(_globalOffset[_dim] + _localDims[_dim], hsize_t(_Ni[_dim]));
+    }
+}
+}  // namespace
+
 void LatticeBoltzmann::readLBConf(int _mode)
 {
     if (_mode == 0)
@@ -995,174 +1136,107 @@ void LatticeBoltzmann::readLBConf(int _mode)
         timeReadLBConf.reset();
         real timeStart = timeReadLBConf.getElapsedTime();
 
-        // set restart folder and check its existence
-        std::string dirRestart = "dump";
+        System& system = getSystemRef();
+        std::string filename = lbConfFilename(getStepNum());
 
-        if (getStepNum() != 0 && boost::filesystem::is_directory(dirRestart) == false)
+        if (!boost::filesystem::exists(filename))
         {
-            std::cout << "Sorry, the restart directory is missing! " << "Something is wrong!!!"
-                      << std::endl;
+            if (getStepNum() != 0 && system.comm->rank() == 0)
+            {
+                std::cout << "!!! Attention !!! no LB configuration " << filename
+                          << " found for step " << getStepNum() << std::endl;
+            }
+            return;
         }
 
-        // make prefix and suffix //
-        std::string prefix = dirRestart;
-        prefix.append("/");
-
-        std::ostringstream convert, _myRank;
-        convert << getStepNum();
-        _myRank << getSystem()->comm->rank();
-
-        std::string suffix = ".dat";
-        suffix.insert(0, _myRank.str());
-        suffix.insert(0, ".");
-        suffix.insert(0, convert.str());
+        hid_t fileId = io::openParallelFile(filename, *system.comm);
 
-        /*  COUPLING FORCES */
-        // create filenames for the input files //
-        std::string filenameForces = "couplForces";
-        filenameForces.insert(0, prefix);
-        filenameForces.append(suffix);
+        /*  LATTICE */
+        // the file holds real sites of the whole lattice, take the block of this CPU //
+        int _offset = getHaloSkin();
+        int _numVels = getNumVels();
+        Int3D _Ni = getNi();
+        Int3D _myNi = getMyNi();
+        std::vector<hsize_t> globalOffset, localDims;
+        lbConfSlab(*this, globalOffset, localDims);
 
-        // fill in the coupling forces acting on MD-particles with zeros //
-        int _totNPart = getTotNPart();
-        for (int _id = 0; _id <= _totNPart; _id++)
+        std::vector<hsize_t> fileDims = io::getDatasetDims(fileId, "/lattice/populations");
+        CHECK_EQUAL(fileDims.size(), 4u);
+        for (int _dim = 0; _dim < 3; ++_dim)
         {
-            setFOnPart(_id, Real3D(0.));
+            CHECK_EQUAL(fileDims[_dim], hsize_t(_Ni[_dim]),
+                        "LB configuration was saved for a different lattice");
         }
+        CHECK_EQUAL(fileDims[3], hsize_t(_numVels));
 
-        // access particles' data and open a file to read couplForces from //
-        long int _id;
-        Int3D _myNi = getMyNi();
-        real _fx, _fy, _fz;
-
-        System& system = getSystemRef();
-        CellList realCells = system.storage->getRealCells();
+        std::vector<real> pops, moms, forces;
+        globalOffset.push_back(0);
+        localDims.push_back(_numVels);
+        io::readHyperslab(fileId, "/lattice/populations", globalOffset, localDims, pops);
+        localDims.back() = 4;
+        io::readHyperslab(fileId, "/lattice/moments", globalOffset, localDims, moms);
+        localDims.back() = 3;
+        io::readHyperslab(fileId, "/lattice/couplForces", globalOffset, localDims, forces);
 
-        std::ifstream couplForcesFile;
-        couplForcesFile.open(filenameForces.c_str(), std::ifstream::in);
-
-        if (couplForcesFile.is_open())
+        // halo forces were folded onto their owners on saving //
+        for (int _i = 0; _i < _myNi[0]; _i++)
         {
-            // MD-part //
-            for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+            for (int _j = 0; _j < _myNi[1]; _j++)
             {
-                couplForcesFile >> _id >> _fx >> _fy >> _fz;
-
-                setFOnPart(_id, Real3D(_fx, _fy, _fz));
-                // add the forces to the integrator
-                cit->force() += getFOnPart(cit->id());
+                for (int _k = 0; _k < _myNi[2]; _k++)
+                {
+                    (*lbfor)[_i][_j][_k].setCouplForceLoc(Real3D(0.));
+                }
             }
+        }
 
-            // LB-part //
-            // initialize with zeros //
-            for (int _i = 0; _i < _myNi[0]; _i++)
+        size_t _site = 0;
+        for (int _i = _offset; _i < _myNi[0] - _offset; _i++)
+        {
+            for (int _j = _offset; _j < _myNi[1] - _offset; _j++)
             {
-                for (int _j = 0; _j < _myNi[1]; _j++)
+                for (int _k = _offset; _k < _myNi[2] - _offset; _k++, _site++)
                 {
-                    for (int _k = 0; _k < _myNi[2]; _k++)
+                    for (int _l = 0; _l < _numVels; _l++)
                     {
-                        (*lbfor)[_i][_j][_k].setCouplForceLoc(Real3D(0.));
+                        (*lbfluid)[_i][_j][_k].setF_i(_l, pops[_site * _numVels + _l]);
+                    }
+                    for (int _l = 0; _l < 4; _l++)
+                    {
+                        (*lbmom)[_i][_j][_k].setMom_i(_l, moms[_site * 4 + _l]);
                     }
+                    (*lbfor)[_i][_j][_k].setCouplForceLoc(Real3D(
+                        forces[_site * 3], forces[_site * 3 + 1], forces[_site * 3 + 2]));
                 }
             }
-
-            int _i, _j, _k;
-
-            while (couplForcesFile >> _i >> _j >> _k >> _fx >> _fy >> _fz)
-            {
-                (*lbfor)[_i][_j][_k].setCouplForceLoc(Real3D(_fx, _fy, _fz));
-            }
-
-            couplForcesFile.close();
-        }
-        else
-        {
-            if (getStepNum() != 0)
-            {
-                std::cout << "!!! Attention !!! no file with coupling forces"
-                          << "acting onto MD particles found for step " << convert.str()
-                          << std::endl;
-            }
         }
 
-        /*  LB-FLUID MOMENTS */
-        // create filenames for the input files //
-        std::string filenameFluid = "fluid";
-        filenameFluid.insert(0, prefix);
-        filenameFluid.append(suffix);
-
-        // read density and velocity of the fluid (excl. ghost region) //
-        int _offset = getHaloSkin();
-        Int3D _myPos = getMyPos();
-
-        std::ifstream fluidFile;
-        fluidFile.open(filenameFluid.c_str(), std::ifstream::in);
+        /*  COUPLING FORCES ON MD-PARTICLES */
+        // particles may sit on any CPU now: scan the file in blocks, keep what is local //
+        fOnPart.clear();
 
-        if (fluidFile.is_open())
+        hsize_t const blockSize = 1 << 20;
+        hsize_t _nTotal = io::getDatasetDims(fileId, "/particles/id")[0];
+        std::vector<int64_t> ids;
+        for (hsize_t _start = 0; _start < _nTotal; _start += blockSize)
         {
-            int _x, _y, _z, _i, _j, _k;
-            real _rho, _vx, _vy, _vz;
+            hsize_t _n = std::min(blockSize, _nTotal - _start);
+            io::readHyperslab(fileId, "/particles/id", {_start}, {_n}, ids);
+            io::readHyperslab(fileId, "/particles/couplForces", {_start, 0}, {_n, 3}, forces);
 
-            while (fluidFile >> _x >> _y >> _z >> _rho >> _vx >> _vy >> _vz)
+            for (hsize_t _p = 0; _p < _n; _p++)
             {
-                _i = _x + 1 - _myPos[0] * (_myNi[0] - 2 * _offset);
-                _j = _y + 1 - _myPos[1] * (_myNi[1] - 2 * _offset);
-                _k = _z + 1 - _myPos[2] * (_myNi[2] - 2 * _offset);
-
-                (*lbmom)[_i][_j][_k].setMom_i(0, _rho);
-                (*lbmom)[_i][_j][_k].setMom_i(1, _vx * _rho);
-                (*lbmom)[_i][_j][_k].setMom_i(2, _vy * _rho);
-                (*lbmom)[_i][_j][_k].setMom_i(3, _vz * _rho);
-            }
+                Particle* part = system.storage->lookupRealParticle(ids[_p]);
+                if (!part) continue;
 
-            fluidFile.close();
-        }
-        else
-        {
-            if (getStepNum() != 0)
-            {
-                std::cout << "!!! Attention !!! no file with fluid moments " << "found for step "
-                          << convert.str() << std::endl;
+                Real3D _f(forces[3 * _p], forces[3 * _p + 1], forces[3 * _p + 2]);
+                setFOnPart(ids[_p], _f);
+                // add the forces to the integrator
+                part->force() += _f;
             }
         }
 
-        /*  POPULATIONS */
-        // create filenames for the input files //
-        std::string filenamePops = "pops";
-        filenamePops.insert(0, prefix);
-        filenamePops.append(suffix);
-
-        // open a file to read populations from //
-        std::ifstream popsFile;
-        popsFile.open(filenamePops.c_str(), std::ifstream::in);
-
-        if (popsFile.is_open())
-        {
-            int _numVels = getNumVels();
-            int _i, _j, _k;
-            real _fi[_numVels];
-
-            while (popsFile >> _i >> _j >> _k >> _fi[0] >> _fi[1] >> _fi[2] >> _fi[3] >> _fi[4] >>
-                   _fi[5] >> _fi[6] >> _fi[7] >> _fi[8] >> _fi[9] >> _fi[10] >> _fi[11] >>
-                   _fi[12] >> _fi[13] >> _fi[14] >> _fi[15] >> _fi[16] >> _fi[17] >> _fi[18])
-            {
-                // read in the populations on the site _i, _j, _k
-                for (int _l = 0; _l < _numVels; _l++)
-                {
-                    setPops(Int3D(_i, _j, _k), _l, _fi[_l]);
-                }
-            }
-
-            popsFile.close();
-        }
-        else
-        {
-            if (getStepNum() != 0)
-            {
-                std::cout << "!!! Attention !!! no file with LB populations " << "found for step "
-                          << convert.str() << std::endl;
-            }
-        }
+        io::CHECK_HDF5(H5Fclose(fileId));
 
         // timer //
         real timeEnd = timeReadLBConf.getElapsedTime() - timeStart;
@@ -1179,167 +1253,232 @@ void LatticeBoltzmann::saveLBConf()
     timeSaveLBConf.reset();
     real timeStart = timeSaveLBConf.getElapsedTime();
 
+    System& system = getSystemRef();
+
     // check if folder exists, if not - create it //
     std::string dirRestart = "dump";
-    if (boost::filesystem::is_directory(dirRestart) == false)
+    if (system.comm->rank() == 0 && boost::filesystem::is_directory(dirRestart) == false)
     {
         boost::filesystem::create_directory(dirRestart);
     }
+    system.comm->barrier();
 
     int currDumpStep = getStepNum() + 1;
     // or you should take it directly from the integrator
     // reason: LB couples to the signal befIntV and when the integrator is
     // done with the step it is incremented, while stepNum in LB is not.
 
-    // make prefix, suffix and suffix for deletion //
-    std::string prefix = dirRestart;
-    prefix.append("/");
-
-    std::ostringstream convert, convDel, _myRank;
-    convert << currDumpStep;
-    convDel << getPrevDumpStep();
-    _myRank << getSystem()->comm->rank();
-
-    std::string suffix = ".dat";
-    suffix.insert(0, _myRank.str());
-    suffix.insert(0, ".");
-    std::string suffixDel = suffix;
-    suffix.insert(0, convert.str());
-    suffixDel.insert(0, convDel.str());
-
-    /*  COUPLING FORCES */
-    // create filenames for the input and to be removed files //
-    std::string filenameForces = "couplForces";
-    std::string filenameForcesDel = filenameForces;
-
-    filenameForces.insert(0, prefix);
-    filenameForces.append(suffix);
-    filenameForcesDel.insert(0, prefix);
-    filenameForcesDel.append(suffixDel);
-
-    // access particles' data and open a file to write coupling forces to //
-    System& system = getSystemRef();
-    CellList realCells = system.storage->getRealCells();
-
-    // write forces acting onto MD-particles //
-    FILE* couplForcesFile = fopen(filenameForces.c_str(), "w");
-
-    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
-    {
-        long int _id = cit->id();
-        fprintf(couplForcesFile, "%ld %15.10f %15.10f %15.10f \n", _id, getFOnPart(_id).getItem(0),
-                getFOnPart(_id).getItem(1), getFOnPart(_id).getItem(2));
-    }
-
-    // write forces acting onto LB-sites (incl. ghost region) //
+    // coupling forces in the halo belong to the neighbouring CPUs. Add them there now (and
+    // clear the halo, so the next collide-stream does not add them again) to keep the dump
+    // independent of the decomposition.
+    int _offset = getHaloSkin();
     Int3D _myNi = getMyNi();
-
-    for (int _i = 0; _i < _myNi[0]; _i++)
+    if (doCoupling())
     {
-        for (int _j = 0; _j < _myNi[1]; _j++)
+        copyForcesFromHalo();
+        for (int _i = 0; _i < _myNi[0]; _i++)
         {
-            for (int _k = 0; _k < _myNi[2]; _k++)
+            for (int _j = 0; _j < _myNi[1]; _j++)
             {
-                Real3D _couplForceLoc = (*lbfor)[_i][_j][_k].getCouplForceLoc();
-                if (_couplForceLoc.sqr() < ROUND_ERROR_PREC)
+                for (int _k = 0; _k < _myNi[2]; _k++)
                 {
-                    // see definition of ROUND ERROR in src/include/esconfig.hpp
-                }
-                else
-                {
-                    fprintf(couplForcesFile, "%d %d %d %15.10f %15.10f %15.10f \n", _i, _j, _k,
-                            _couplForceLoc[0], _couplForceLoc[1], _couplForceLoc[2]);
+                    if (_i < _offset || _i >= _myNi[0] - _offset || _j < _offset ||
+                        _j >= _myNi[1] - _offset || _k < _offset || _k >= _myNi[2] - _offset)
+                    {
+                        (*lbfor)[_i][_j][_k].setCouplForceLoc(Real3D(0.));
+                    }
                 }
             }
         }
     }
-    fclose(couplForcesFile);
-
-    /*  LB-FLUID MOMENTS */
-    // create filenames for the input and to be removed files //
-    std::string filenameFluid = "fluid";
-    std::string filenameFluidDel = filenameFluid;
-
-    filenameFluid.insert(0, prefix);
-    filenameFluid.append(suffix);
-    filenameFluidDel.insert(0, prefix);
-    filenameFluidDel.append(suffixDel);
-
-    // write down density and velocity of the fluid (excl. ghost region) //
-    int _offset = getHaloSkin();
-    Int3D _myPos = getMyPos();
 
-    FILE* fluidFile = fopen(filenameFluid.c_str(), "w");
+    hid_t fileId = io::createParallelFile(lbConfFilename(currDumpStep), *system.comm);
 
+    /*  LATTICE */
+    // populations, density and momentum, coupling forces of the real sites //
+    int _numVels = getNumVels();
+    Int3D _Ni = getNi();
+    std::vector<hsize_t> globalOffset, localDims;
+    lbConfSlab(*this, globalOffset, localDims);
+    size_t _numSites = localDims[0] * localDims[1] * localDims[2];
+
+    std::vector<real> pops, moms, forces;
+    pops.reserve(_numSites * _numVels);
+    moms.reserve(_numSites * 4);
+    forces.reserve(_numSites * 3);
     for (int _i = _offset; _i < _myNi[0] - _offset; _i++)
     {
         for (int _j = _offset; _j < _myNi[1] - _offset; _j++)
         {
             for (int _k = _offset; _k < _myNi[2] - _offset; _k++)
             {
-                real _rho = (*lbmom)[_i][_j][_k].getMom_i(0);
-                real _jx, _jy, _jz;
-                _jx = (*lbmom)[_i][_j][_k].getMom_i(1);
-                _jy = (*lbmom)[_i][_j][_k].getMom_i(2);
-                _jz = (*lbmom)[_i][_j][_k].getMom_i(3);
-
-                // -1 comes from the offset. we have to output the first real node as 0
-                fprintf(fluidFile, "%d %d %d %15.10f %15.10f %15.10f %15.10f\n",
-                        _myPos[0] * (_myNi[0] - 2 * _offset) + _i - 1,
-                        _myPos[1] * (_myNi[1] - 2 * _offset) + _j - 1,
-                        _myPos[2] * (_myNi[2] - 2 * _offset) + _k - 1, _rho, _jx / _rho, _jy / _rho,
-                        _jz / _rho);
+                for (int _l = 0; _l < _numVels; _l++)
+                {
+                    pops.push_back((*lbfluid)[_i][_j][_k].getF_i(_l));
+                }
+                for (int _l = 0; _l < 4; _l++)
+                {
+                    moms.push_back((*lbmom)[_i][_j][_k].getMom_i(_l));
+                }
+                Real3D _couplForceLoc = (*lbfor)[_i][_j][_k].getCouplForceLoc();
+                for (int _dir = 0; _dir < 3; _dir++)
+                {
+                    forces.push_back(_couplForceLoc[_dir]);
+                }
             }
         }
     }
-    fclose(fluidFile);
 
-    /*  POPULATIONS */
-    // create filenames for the input and to be removed files //
-    std::string filenamePops = "pops";
-    std::string filenamePopsDel = filenamePops;
+    // chunks of one lattice plane each when compressing //
+    std::vector<hsize_t> globalDims = {hsize_t(_Ni[0]), hsize_t(_Ni[1]), hsize_t(_Ni[2]), 0};
+    std::vector<hsize_t> chunkDims = {1, hsize_t(_Ni[1]), hsize_t(_Ni[2]), 0};
+    globalOffset.push_back(0);
+    localDims.push_back(0);
+
+    hid_t latticeGroup =
+        io::CHECK_HDF5(H5Gcreate(fileId, "/lattice", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    io::CHECK_HDF5(H5Gclose(latticeGroup));
+    globalDims.back() = localDims.back() = chunkDims.back() = _numVels;
+    io::writeHyperslab(fileId, "/lattice/populations", globalDims, globalOffset, localDims, pops,
+                       compression, chunkDims);
+    globalDims.back() = localDims.back() = chunkDims.back() = 4;
+    io::writeHyperslab(fileId, "/lattice/moments", globalDims, globalOffset, localDims, moms,
+                       compression, chunkDims);
+    globalDims.back() = localDims.back() = chunkDims.back() = 3;
+    io::writeHyperslab(fileId, "/lattice/couplForces", globalDims, globalOffset, localDims,
+                       forces, compression, chunkDims);
+
+    /*  COUPLING FORCES ON MD-PARTICLES */
+    // written in the order of CPUs, each block in the order of real cells //
+    std::vector<int64_t> ids;
+    forces.clear();
+    CellList realCells = system.storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        Real3D _f = getFOnPart(cit->id());
+        ids.push_back(cit->id());
+        forces.push_back(_f[0]);
+        forces.push_back(_f[1]);
+        forces.push_back(_f[2]);
+    }
+
+    int64_t _nLocal = ids.size();
+    int64_t _nTotal = 0;
+    int64_t _nOffset = 0;
+    MPI_Allreduce(&_nLocal, &_nTotal, 1, MPI_INT64_T, MPI_SUM, *system.comm);
+    MPI_Exscan(&_nLocal, &_nOffset, 1, MPI_INT64_T, MPI_SUM, *system.comm);
+    if (system.comm->rank() == 0) _nOffset = 0;
 
-    filenamePops.insert(0, prefix);
-    filenamePops.append(suffix);
-    filenamePopsDel.insert(0, prefix);
-    filenamePopsDel.append(suffixDel);
+    hsize_t _chunk = std::min(hsize_t(_nTotal), hsize_t(1 << 16));
+    hid_t particlesGroup =
+        io::CHECK_HDF5(H5Gcreate(fileId, "/particles", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    io::CHECK_HDF5(H5Gclose(particlesGroup));
+    io::writeHyperslab(fileId, "/particles/id", {hsize_t(_nTotal)}, {hsize_t(_nOffset)},
+                       {hsize_t(_nLocal)}, ids, compression, {_chunk});
+    io::writeHyperslab(fileId, "/particles/couplForces", {hsize_t(_nTotal), 3},
+                       {hsize_t(_nOffset), 0}, {hsize_t(_nLocal), 3}, forces, compression,
+                       {_chunk, 3});
 
-    // write populations at LB-sites (incl. ghost region) //
-    FILE* popsFile = fopen(filenamePops.c_str(), "w");
+    io::CHECK_HDF5(H5Fclose(fileId));
 
-    int _numVels = getNumVels();
-    for (int _i = 0; _i < _myNi[0]; _i++)
+    // delete previous dump //
+    if (getPrevDumpStep() != 0 && system.comm->rank() == 0)
     {
-        for (int _j = 0; _j < _myNi[1]; _j++)
-        {
-            for (int _k = 0; _k < _myNi[2]; _k++)
-            {
-                fprintf(popsFile, "%d %d %d ", _i, _j, _k);
-                for (int _l = 0; _l < _numVels; _l++)
+        boost::filesystem::remove(lbConfFilename(getPrevDumpStep()));
+    }
+
+    setPrevDumpStep(currDumpStep);
+
+    // timer //
+    real timeEnd = timeSaveLBConf.getElapsedTime() - timeStart;
+    printf("step %lld, CPU %d: saved LB-conf and MD forces in %f seconds\n", integrator->getStep(),
+           system.comm->rank(), timeEnd);
+}
+
+/*******************************************************************************************/
+
+/* PACK AND UNPACK THE COMPLETE LOCAL STATE (HALO INCLUDED) FOR A CHECKPOINT */
+void LatticeBoltzmann::writeCheckpoint(OutBuffer& buf)
+{
+    int _numVels = getNumVels();
+    Int3D _myNi = getMyNi();
+    buf.write(_myNi);
+    buf.write(_numVels);
+
+    for (int _i = 0; _i < _myNi[0]; _i++)
+    {
+        for (int _j = 0; _j < _myNi[1]; _j++)
+        {
+            for (int _k = 0; _k < _myNi[2]; _k++)
+            {
+                for (int _l = 0; _l < _numVels; _l++)
+                {
+                    buf.write((*lbfluid)[_i][_j][_k].getF_i(_l));
+                }
+                for (int _l = 0; _l < 4; _l++)
                 {
-                    fprintf(popsFile, "%15.10f ", getPops(Int3D(_i, _j, _k), _l));
+                    buf.write((*lbmom)[_i][_j][_k].getMom_i(_l));
                 }
-                fprintf(popsFile, "\n ");
+                buf.write((*lbfor)[_i][_j][_k].getExtForceLoc());
+                buf.write((*lbfor)[_i][_j][_k].getCouplForceLoc());
             }
         }
     }
 
-    fclose(popsFile);
-
-    // delete previous dumps //
-    if (getPrevDumpStep() != 0)
+    buf.write(fOnPart.size());
+    for (auto& _entry : fOnPart)
     {
-        boost::filesystem::remove(filenameForcesDel);
-        boost::filesystem::remove(filenameFluidDel);
-        boost::filesystem::remove(filenamePopsDel);
+        buf.write(_entry.first);
+        buf.write(_entry.second);
     }
+}
 
-    setPrevDumpStep(currDumpStep);
+void LatticeBoltzmann::readCheckpoint(InBuffer& buf)
+{
+    int _numVels;
+    Int3D _myNi;
+    buf.read(_myNi);
+    buf.read(_numVels);
+    if (_myNi != getMyNi() || _numVels != getNumVels())
+        throw std::runtime_error("LatticeBoltzmann: checkpoint lattice does not match");
 
-    // timer //
-    real timeEnd = timeSaveLBConf.getElapsedTime() - timeStart;
-    printf("step %lld, CPU %d: saved LB-conf and MD forces in %f seconds\n", integrator->getStep(),
-           system.comm->rank(), timeEnd);
+    for (int _i = 0; _i < _myNi[0]; _i++)
+    {
+        for (int _j = 0; _j < _myNi[1]; _j++)
+        {
+            for (int _k = 0; _k < _myNi[2]; _k++)
+            {
+                real _value;
+                for (int _l = 0; _l < _numVels; _l++)
+                {
+                    buf.read(_value);
+                    (*lbfluid)[_i][_j][_k].setF_i(_l, _value);
+                }
+                for (int _l = 0; _l < 4; _l++)
+                {
+                    buf.read(_value);
+                    (*lbmom)[_i][_j][_k].setMom_i(_l, _value);
+                }
+                Real3D _force;
+                buf.read(_force);
+                (*lbfor)[_i][_j][_k].setExtForceLoc(_force);
+                buf.read(_force);
+                (*lbfor)[_i][_j][_k].setCouplForceLoc(_force);
+            }
+        }
+    }
+
+    size_t _numParts;
+    buf.read(_numParts);
+    fOnPart.clear();
+    for (size_t _n = 0; _n < _numParts; _n++)
+    {
+        longint _id;
+        Real3D _force;
+        buf.read(_id);
+        buf.read(_force);
+        fOnPart[_id] = _force;
+    }
 }
 
 /*******************************************************************************************/
@@ -1436,362 +1575,214 @@ Int3D LatticeBoltzmann::findGlobIdx()
 
 /*******************************************************************************************/
 
-/* COMMUNICATE POPULATIONS IN HALO REGIONS TO THE NEIGHBOURING CPUs */
-void LatticeBoltzmann::commHalo()
+/* SET UP PREALLOCATED HALO BUFFERS AND PERSISTENT REQUESTS */
+// message 0 is sent to the right and received from the left neighbour, message 1 goes the
+// other way round. Requests are only bound in directions that are split between CPUs.
+void LatticeBoltzmann::initHaloComm()
 {
-    int i, j, k, idx;            // running indices
-    int const numPopTransf = 5;  // num of popul and hydro moms to be sent
-    int rnode, snode;            // CPU ranks to receive from and to send to
-    std::vector<real> bufToSend, bufToRecv;
+    int const numTransf[3] = {5, 3, 4};  // pops, force components and hydro moms per site
+    int const haloTags[3][2] = {
+        {COMM_DIR_0, COMM_DIR_1}, {COMM_FORCE_0, COMM_FORCE_1}, {COMM_DEN_0, COMM_DEN_1}};
 
-    int _offset = getHaloSkin();
     Int3D _myNi = getMyNi();
-    Int3D _myPos = getMyPos();
-
-    mpi::communicator world;
-
-    //////////////////////
-    //// X-direction /////
-    //////////////////////
-    int numDataTransf = numPopTransf * _myNi[1] * _myNi[2];
-    bufToSend.resize(numDataTransf);
-    bufToRecv.resize(numDataTransf);
-
-    /* send to right, recv from left i = 1, 7, 9, 11, 13 */
-    snode = getMyNeigh(1);
-    rnode = getMyNeigh(0);
+    Int3D _nodeGrid = getNodeGrid();
+    MPI_Comm _mpiComm = *getSystem()->comm;
+    MPI_Datatype _type = mpi::get_mpi_datatype<real>();
 
-    // prepare message for sending
-    i = _myNi[0] - _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
+    for (int _kind = 0; _kind < 3; ++_kind)
     {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
+        for (int _dim = 0; _dim < 3; ++_dim)
         {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(1);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(7);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(9);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(11);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(13);
-        }
-    }
+            int _planeSize = _myNi[(_dim + 1) % 3] * _myNi[(_dim + 2) % 3];
+            int numDataTransf = numTransf[_kind] * _planeSize;
+            for (int _msg = 0; _msg < 2; ++_msg)
+            {
+                haloSend[_kind][_dim][_msg].assign(numDataTransf, 0.);
+                haloRecv[_kind][_dim][_msg].assign(numDataTransf, 0.);
+            }
+            for (int _r = 0; _r < 4; ++_r)
+            {
+                haloReq[_kind][_dim][_r] = MPI_REQUEST_NULL;
+            }
 
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_0, bufToSend);
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-            world.send(snode, COMM_DIR_0, bufToSend);
+            if (_nodeGrid[_dim] > 1)
+            {
+                int _left = getMyNeigh(2 * _dim);
+                int _right = getMyNeigh(2 * _dim + 1);
+                MPI_Recv_init(haloRecv[_kind][_dim][0].data(), numDataTransf, _type, _left,
+                              haloTags[_kind][0], _mpiComm, &haloReq[_kind][_dim][0]);
+                MPI_Recv_init(haloRecv[_kind][_dim][1].data(), numDataTransf, _type, _right,
+                              haloTags[_kind][1], _mpiComm, &haloReq[_kind][_dim][1]);
+                MPI_Send_init(haloSend[_kind][_dim][0].data(), numDataTransf, _type, _right,
+                              haloTags[_kind][0], _mpiComm, &haloReq[_kind][_dim][2]);
+                MPI_Send_init(haloSend[_kind][_dim][1].data(), numDataTransf, _type, _left,
+                              haloTags[_kind][1], _mpiComm, &haloReq[_kind][_dim][3]);
+            }
         }
     }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+}
 
-    // unpack message
-    i = _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(1, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(7, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(9, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(11, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(13, bufToRecv[idx + 4]);
-        }
-    }
+/*******************************************************************************************/
 
-    /* send to left, recv from right i = 2, 8, 10, 12, 14 */
-    snode = getMyNeigh(0);
-    rnode = getMyNeigh(1);
+/* RELEASE PERSISTENT HALO REQUESTS */
+void LatticeBoltzmann::freeHaloComm()
+{
+    // the interpreter may tear LB down after MPI is gone already
+    int _finalized = 0;
+    MPI_Finalized(&_finalized);
+    if (_finalized) return;
 
-    // prepare message for sending
-    i = 0;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
+    for (int _kind = 0; _kind < 3; ++_kind)
     {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
+        for (int _dim = 0; _dim < 3; ++_dim)
         {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(2);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(8);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(10);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(12);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(14);
+            for (int _r = 0; _r < 4; ++_r)
+            {
+                if (haloReq[_kind][_dim][_r] != MPI_REQUEST_NULL)
+                {
+                    MPI_Request_free(&haloReq[_kind][_dim][_r]);
+                }
+            }
         }
     }
+}
 
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_1, bufToSend);
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-            world.send(snode, COMM_DIR_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+/*******************************************************************************************/
 
-    // unpack message
-    i = _myNi[0] - 2 * _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
+/* START EXCHANGE OF THE PACKED HALO PLANES IN DIRECTION _dim */
+void LatticeBoltzmann::startHalo(int _kind, int _dim)
+{
+    if (getNodeGrid().getItem(_dim) > 1)
     {
-        for (j = 0; j < _myNi[1]; j++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(2, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(8, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(10, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(12, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(14, bufToRecv[idx + 4]);
-        }
+        MPI_Startall(4, haloReq[_kind][_dim]);
     }
+}
 
-    //////////////////////
-    //// Y-direction /////
-    //////////////////////
-    numDataTransf = numPopTransf * _myNi[0] * _myNi[2];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left i = 3, 7, 10, 15, 17 */
-    snode = getMyNeigh(3);
-    rnode = getMyNeigh(2);
-
-    // prepare message for sending
-    j = _myNi[1] - _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(3);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(7);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(10);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(15);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(17);
-        }
-    }
+/*******************************************************************************************/
 
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
+/* COMPLETE EXCHANGE OF THE HALO PLANES IN DIRECTION _dim */
+void LatticeBoltzmann::waitHalo(int _kind, int _dim)
+{
+    if (getNodeGrid().getItem(_dim) > 1)
     {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_0, bufToSend);
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-            world.send(snode, COMM_DIR_0, bufToSend);
-        }
+        MPI_Waitall(4, haloReq[_kind][_dim], MPI_STATUSES_IGNORE);
     }
     else
     {
-        bufToRecv = bufToSend;
+        // single CPU along _dim: the packed planes are our own periodic images
+        haloRecv[_kind][_dim][0].swap(haloSend[_kind][_dim][0]);
+        haloRecv[_kind][_dim][1].swap(haloSend[_kind][_dim][1]);
     }
+}
 
-    // unpack message
-    j = _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(3, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(7, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(10, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(15, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(17, bufToRecv[idx + 4]);
-        }
-    }
-
-    /* send to left, recv from right i = 4, 8, 9, 16, 18 */
-    snode = getMyNeigh(2);
-    rnode = getMyNeigh(3);
-
-    // prepare message for sending
-    j = 0;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(4);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(8);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(9);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(16);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(18);
-        }
-    }
+/*******************************************************************************************/
 
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
+namespace
+{
+// populations leaving through the right (message 0) and left (message 1) halo plane
+int const haloPops[3][2][5] = {{{1, 7, 9, 11, 13}, {2, 8, 10, 12, 14}},
+                               {{3, 7, 10, 15, 17}, {4, 8, 9, 16, 18}},
+                               {{5, 11, 14, 15, 18}, {6, 12, 13, 16, 17}}};
+
+/* visit all sites (halo included) of the plane _plane normal to _dim in message order */
+template <class SiteOp>
+void forHaloPlane(const Int3D& _myNi, int _dim, int _plane, int _stride, SiteOp _op)
+{
+    int _d1 = (_dim == 0) ? 1 : 0;  // fast running index inside the plane
+    int _d2 = (_dim == 2) ? 1 : 2;  // slow running index inside the plane
+    Int3D _s;
+    _s[_dim] = _plane;
+    int idx = 0;
+    for (_s[_d2] = 0; _s[_d2] < _myNi[_d2]; ++_s[_d2])
     {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_1, bufToSend);
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-        }
-        else
+        for (_s[_d1] = 0; _s[_d1] < _myNi[_d1]; ++_s[_d1], idx += _stride)
         {
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-            world.send(snode, COMM_DIR_1, bufToSend);
+            _op(_s[0], _s[1], _s[2], idx);
         }
     }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+}
+}  // namespace
 
-    // unpack message
-    j = _myNi[1] - 2 * _offset;
-    idx = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(4, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(8, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(9, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(16, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(18, bufToRecv[idx + 4]);
-        }
-    }
+/* PACK POPULATIONS STREAMED INTO THE HALO PLANES NORMAL TO _dim AND POST THEM */
+void LatticeBoltzmann::postHaloPops(int _dim)
+{
+    int const numPopTransf = 5;  // num of popul to be sent
+    int _offset = getHaloSkin();
+    Int3D _myNi = getMyNi();
 
-    //////////////////////
-    //// Z-direction /////
-    //////////////////////
-    numDataTransf = numPopTransf * _myNi[0] * _myNi[1];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left i = 5, 11, 14, 15, 18 */
-    snode = getMyNeigh(5);
-    rnode = getMyNeigh(4);
-
-    // prepare message for sending
-    k = _myNi[2] - _offset;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(5);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(11);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(14);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(15);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(18);
-        }
-    }
+    /* send to right, recv from left */
+    std::vector<real>& _toRight = haloSend[HALO_POPS][_dim][0];
+    int const* _popsR = haloPops[_dim][0];
+    forHaloPlane(_myNi, _dim, _myNi[_dim] - _offset, numPopTransf,
+                 [&](int i, int j, int k, int idx)
+                 {
+                     for (int l = 0; l < numPopTransf; ++l)
+                     {
+                         _toRight[idx + l] = (*ghostlat)[i][j][k].getF_i(_popsR[l]);
+                     }
+                 });
 
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_0, bufToSend);
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_0, bufToRecv);
-            world.send(snode, COMM_DIR_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+    /* send to left, recv from right */
+    std::vector<real>& _toLeft = haloSend[HALO_POPS][_dim][1];
+    int const* _popsL = haloPops[_dim][1];
+    forHaloPlane(_myNi, _dim, 0, numPopTransf,
+                 [&](int i, int j, int k, int idx)
+                 {
+                     for (int l = 0; l < numPopTransf; ++l)
+                     {
+                         _toLeft[idx + l] = (*ghostlat)[i][j][k].getF_i(_popsL[l]);
+                     }
+                 });
+
+    startHalo(HALO_POPS, _dim);
+}
 
-    // unpack message
-    k = _offset;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(5, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(11, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(14, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(15, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(18, bufToRecv[idx + 4]);
-        }
-    }
+/*******************************************************************************************/
 
-    /* send to left, recv from right i = 6, 12, 13, 16, 17 */
-    snode = getMyNeigh(4);
-    rnode = getMyNeigh(5);
+/* WAIT FOR THE HALO POPULATIONS NORMAL TO _dim AND PUT THEM ONTO THE BOUNDARY SITES */
+void LatticeBoltzmann::completeHaloPops(int _dim)
+{
+    int const numPopTransf = 5;  // num of popul to be received
+    int _offset = getHaloSkin();
+    Int3D _myNi = getMyNi();
 
-    // prepare message for sending
-    k = 0;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            bufToSend[idx] = (*ghostlat)[i][j][k].getF_i(6);
-            bufToSend[idx + 1] = (*ghostlat)[i][j][k].getF_i(12);
-            bufToSend[idx + 2] = (*ghostlat)[i][j][k].getF_i(13);
-            bufToSend[idx + 3] = (*ghostlat)[i][j][k].getF_i(16);
-            bufToSend[idx + 4] = (*ghostlat)[i][j][k].getF_i(17);
-        }
-    }
+    waitHalo(HALO_POPS, _dim);
+
+    std::vector<real>& _fromLeft = haloRecv[HALO_POPS][_dim][0];
+    int const* _popsR = haloPops[_dim][0];
+    forHaloPlane(_myNi, _dim, _offset, numPopTransf,
+                 [&](int i, int j, int k, int idx)
+                 {
+                     for (int l = 0; l < numPopTransf; ++l)
+                     {
+                         (*ghostlat)[i][j][k].setF_i(_popsR[l], _fromLeft[idx + l]);
+                     }
+                 });
+
+    std::vector<real>& _fromRight = haloRecv[HALO_POPS][_dim][1];
+    int const* _popsL = haloPops[_dim][1];
+    forHaloPlane(_myNi, _dim, _myNi[_dim] - 2 * _offset, numPopTransf,
+                 [&](int i, int j, int k, int idx)
+                 {
+                     for (int l = 0; l < numPopTransf; ++l)
+                     {
+                         (*ghostlat)[i][j][k].setF_i(_popsL[l], _fromRight[idx + l]);
+                     }
+                 });
+}
 
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_DIR_1, bufToSend);
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DIR_1, bufToRecv);
-            world.send(snode, COMM_DIR_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
+/*******************************************************************************************/
 
-    // unpack message
-    k = _myNi[2] - 2 * _offset;
-    idx = 0;
-    for (j = 0; j < _myNi[1]; j++)
+/* COMMUNICATE POPULATIONS IN HALO REGIONS TO THE NEIGHBOURING CPUs */
+// y- and z-planes include edge sites filled by the previous direction, so the directions
+// have to go in turn; both messages of one direction are independent and travel together.
+void LatticeBoltzmann::commHalo()
+{
+    for (int _dim = 0; _dim < 3; ++_dim)
     {
-        for (i = 0; i < _myNi[0]; i++, idx += numPopTransf)
-        {
-            (*ghostlat)[i][j][k].setF_i(6, bufToRecv[idx]);
-            (*ghostlat)[i][j][k].setF_i(12, bufToRecv[idx + 1]);
-            (*ghostlat)[i][j][k].setF_i(13, bufToRecv[idx + 2]);
-            (*ghostlat)[i][j][k].setF_i(16, bufToRecv[idx + 3]);
-            (*ghostlat)[i][j][k].setF_i(17, bufToRecv[idx + 4]);
-        }
+        postHaloPops(_dim);
+        completeHaloPops(_dim);
     }
-
-    // release buffers
-    bufToSend.resize(0);
-    bufToRecv.resize(0);
 }
 
 /*******************************************************************************************/
@@ -1799,343 +1790,57 @@ void LatticeBoltzmann::commHalo()
 /* COPY COUPLING FORCES FROM HALO REGIONS TO THE REAL ONES */
 void LatticeBoltzmann::copyForcesFromHalo()
 {
-    int i, j, k, idx;            // running indices
     int const numForceComp = 3;  // number of force components to transfer
-    int rnode, snode;            // CPU ranks to receive from and to send to
-    std::vector<real> bufToSend, bufToRecv;
-
-    Real3D _addForce;
-
     int _offset = getHaloSkin();
     Int3D _myNi = getMyNi();
-    Int3D _myPos = getMyPos();
-
-    mpi::communicator world;
-
-    //////////////////////
-    //// X-direction /////
-    //////////////////////
-    int numDataTransf = numForceComp * _myNi[1] * _myNi[2];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left */
-    snode = getMyNeigh(1);
-    rnode = getMyNeigh(0);
-
-    // prepare message for sending
-    i = _myNi[0] - _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numForceComp * _myNi[1] * k + j * numForceComp;
-
-            for (int _dir = 0; _dir < 3; ++_dir)
-            {
-                bufToSend[idx + _dir] = (*lbfor)[i][j][k].getCouplForceLoc().getItem(_dir);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_FORCE_0, bufToSend);
-            world.recv(rnode, COMM_FORCE_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_FORCE_0, bufToRecv);
-            world.send(snode, COMM_FORCE_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    i = _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numForceComp * _myNi[1] * k + j * numForceComp;
-            _addForce = Real3D(bufToRecv[idx], bufToRecv[idx + 1], bufToRecv[idx + 2]);
-            (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
-        }
-    }
-
-    /* send to left, recv from right */
-    snode = getMyNeigh(0);
-    rnode = getMyNeigh(1);
-
-    // prepare message for sending
-    i = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numForceComp * _myNi[1] * k + j * numForceComp;
-
-            for (int _dir = 0; _dir < 3; ++_dir)
-            {
-                bufToSend[idx + _dir] = (*lbfor)[i][j][k].getCouplForceLoc().getItem(_dir);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_FORCE_1, bufToSend);
-            world.recv(rnode, COMM_FORCE_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_FORCE_1, bufToRecv);
-            world.send(snode, COMM_FORCE_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    i = _myNi[0] - 2 * _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numForceComp * _myNi[1] * k + j * numForceComp;
-            _addForce = Real3D(bufToRecv[idx], bufToRecv[idx + 1], bufToRecv[idx + 2]);
-            (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
-        }
-    }
-
-    //////////////////////
-    //// Y-direction /////
-    //////////////////////
-    numDataTransf = numForceComp * _myNi[0] * _myNi[2];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left */
-    snode = getMyNeigh(3);
-    rnode = getMyNeigh(2);
-
-    // prepare message for sending
-    j = _myNi[1] - _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * k + i * numForceComp;
-
-            for (int _dir = 0; _dir < 3; ++_dir)
-            {
-                bufToSend[idx + _dir] = (*lbfor)[i][j][k].getCouplForceLoc().getItem(_dir);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
-    {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_FORCE_0, bufToSend);
-            world.recv(rnode, COMM_FORCE_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_FORCE_0, bufToRecv);
-            world.send(snode, COMM_FORCE_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    j = _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * k + i * numForceComp;
-            _addForce = Real3D(bufToRecv[idx], bufToRecv[idx + 1], bufToRecv[idx + 2]);
-            (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
-        }
-    }
-
-    /* send to left, recv from right */
-    snode = getMyNeigh(2);
-    rnode = getMyNeigh(3);
-
-    // prepare message for sending
-    j = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * k + i * numForceComp;
-
-            for (int _dir = 0; _dir < 3; ++_dir)
-            {
-                bufToSend[idx + _dir] = (*lbfor)[i][j][k].getCouplForceLoc().getItem(_dir);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
-    {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_FORCE_1, bufToSend);
-            world.recv(rnode, COMM_FORCE_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_FORCE_1, bufToRecv);
-            world.send(snode, COMM_FORCE_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    j = _myNi[1] - 2 * _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * k + i * numForceComp;
-            _addForce = Real3D(bufToRecv[idx], bufToRecv[idx + 1], bufToRecv[idx + 2]);
-            (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
-        }
-    }
-
-    //////////////////////
-    //// Z-direction /////
-    //////////////////////
-    numDataTransf = numForceComp * _myNi[0] * _myNi[1];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left */
-    snode = getMyNeigh(5);
-    rnode = getMyNeigh(4);
-
-    // prepare message for sending
-    k = _myNi[2] - _offset;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * j + i * numForceComp;
-
-            for (int _dir = 0; _dir < 3; ++_dir)
-            {
-                bufToSend[idx + _dir] = (*lbfor)[i][j][k].getCouplForceLoc().getItem(_dir);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_FORCE_0, bufToSend);
-            world.recv(rnode, COMM_FORCE_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_FORCE_0, bufToRecv);
-            world.send(snode, COMM_FORCE_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    k = _offset;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * j + i * numForceComp;
-            _addForce = Real3D(bufToRecv[idx], bufToRecv[idx + 1], bufToRecv[idx + 2]);
-            (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
-        }
-    }
-
-    /* send to left, recv from right */
-    snode = getMyNeigh(4);
-    rnode = getMyNeigh(5);
-
-    // prepare message for sending
-    k = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * j + i * numForceComp;
-
-            for (int _dir = 0; _dir < 3; ++_dir)
-            {
-                bufToSend[idx + _dir] = (*lbfor)[i][j][k].getCouplForceLoc().getItem(_dir);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_FORCE_1, bufToSend);
-            world.recv(rnode, COMM_FORCE_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_FORCE_1, bufToRecv);
-            world.send(snode, COMM_FORCE_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
 
-    // unpack message
-    k = _myNi[2] - 2 * _offset;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numForceComp * _myNi[0] * j + i * numForceComp;
-            _addForce = Real3D(bufToRecv[idx], bufToRecv[idx + 1], bufToRecv[idx + 2]);
-            (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
-        }
+    for (int _dim = 0; _dim < 3; ++_dim)
+    {
+        /* send to right, recv from left */
+        std::vector<real>& _toRight = haloSend[HALO_FORCES][_dim][0];
+        forHaloPlane(_myNi, _dim, _myNi[_dim] - _offset, numForceComp,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         Real3D _f = (*lbfor)[i][j][k].getCouplForceLoc();
+                         for (int _dir = 0; _dir < 3; ++_dir)
+                         {
+                             _toRight[idx + _dir] = _f[_dir];
+                         }
+                     });
+
+        /* send to left, recv from right */
+        std::vector<real>& _toLeft = haloSend[HALO_FORCES][_dim][1];
+        forHaloPlane(_myNi, _dim, 0, numForceComp,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         Real3D _f = (*lbfor)[i][j][k].getCouplForceLoc();
+                         for (int _dir = 0; _dir < 3; ++_dir)
+                         {
+                             _toLeft[idx + _dir] = _f[_dir];
+                         }
+                     });
+
+        startHalo(HALO_FORCES, _dim);
+        waitHalo(HALO_FORCES, _dim);
+
+        // add received forces to the boundary sites
+        std::vector<real>& _fromLeft = haloRecv[HALO_FORCES][_dim][0];
+        forHaloPlane(_myNi, _dim, _offset, numForceComp,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         Real3D _addForce(_fromLeft[idx], _fromLeft[idx + 1], _fromLeft[idx + 2]);
+                         (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
+                     });
+
+        std::vector<real>& _fromRight = haloRecv[HALO_FORCES][_dim][1];
+        forHaloPlane(_myNi, _dim, _myNi[_dim] - 2 * _offset, numForceComp,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         Real3D _addForce(_fromRight[idx], _fromRight[idx + 1],
+                                          _fromRight[idx + 2]);
+                         (*lbfor)[i][j][k].addCouplForceLoc(_addForce);
+                     });
     }
-
-    // release buffers
-    bufToSend.resize(0);
-    bufToRecv.resize(0);
 }
 
 /*******************************************************************************************/
@@ -2143,347 +1848,58 @@ void LatticeBoltzmann::copyForcesFromHalo()
 /* COPY DEN AND J FROM A REAL REGION TO HALO NODES */
 void LatticeBoltzmann::copyDenMomToHalo()
 {
-    int i, j, k, idx;            // running indices
-    int const numPopTransf = 4;  // num of pops or hydro moms to transfer
-    int rnode, snode;            // CPU ranks to receive from and to send to
-    std::vector<real> bufToSend, bufToRecv;
-
+    int const numPopTransf = 4;  // num of hydro moms to transfer
     int _offset = getHaloSkin();
     Int3D _myNi = getMyNi();
-    Int3D _myPos = getMyPos();
-
-    mpi::communicator world;
-
-    //////////////////////
-    //// X-direction /////
-    //////////////////////
-    int numDataTransf = numPopTransf * _myNi[1] * _myNi[2];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left */
-    snode = getMyNeigh(1);
-    rnode = getMyNeigh(0);
-
-    // prepare message for sending
-    i = _myNi[0] - 2 * _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numPopTransf * _myNi[1] * k + j * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                bufToSend[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_DEN_0, bufToSend);
-            world.recv(rnode, COMM_DEN_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DEN_0, bufToRecv);
-            world.send(snode, COMM_DEN_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    i = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numPopTransf * _myNi[1] * k + j * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                (*lbmom)[i][j][k].setMom_i(l, bufToRecv[idx + l]);
-            }
-        }
-    }
-
-    /* send to left, recv from right i = 2, 8, 10, 12, 14 */
-    snode = getMyNeigh(0);
-    rnode = getMyNeigh(1);
-
-    // prepare message for sending
-    i = _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numPopTransf * _myNi[1] * k + j * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                bufToSend[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in x-dir is 1
-    if (getNodeGrid().getItem(0) > 1)
-    {
-        if (_myPos[0] % 2 == 0)
-        {
-            world.send(snode, COMM_DEN_1, bufToSend);
-            world.recv(rnode, COMM_DEN_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DEN_1, bufToRecv);
-            world.send(snode, COMM_DEN_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    i = _myNi[0] - _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (j = 0; j < _myNi[1]; j++)
-        {
-            idx = numPopTransf * _myNi[1] * k + j * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                (*lbmom)[i][j][k].setMom_i(l, bufToRecv[idx + l]);
-            }
-        }
-    }
-
-    //////////////////////
-    //// Y-direction /////
-    //////////////////////
-    numDataTransf = numPopTransf * _myNi[0] * _myNi[2];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left */
-    snode = getMyNeigh(3);
-    rnode = getMyNeigh(2);
-
-    // prepare message for sending
-    j = _myNi[1] - 2 * _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * k + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                bufToSend[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
-    {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_DEN_0, bufToSend);
-            world.recv(rnode, COMM_DEN_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DEN_0, bufToRecv);
-            world.send(snode, COMM_DEN_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    j = 0;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * k + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                (*lbmom)[i][j][k].setMom_i(l, bufToRecv[idx + l]);
-            }
-        }
-    }
-
-    /* send to left, recv from right i = 4, 8, 9, 16, 18 */
-    snode = getMyNeigh(2);
-    rnode = getMyNeigh(3);
-
-    // prepare message for sending
-    j = _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * k + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                bufToSend[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in y-dir is 1
-    if (getNodeGrid().getItem(1) > 1)
-    {
-        if (_myPos[1] % 2 == 0)
-        {
-            world.send(snode, COMM_DEN_1, bufToSend);
-            world.recv(rnode, COMM_DEN_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DEN_1, bufToRecv);
-            world.send(snode, COMM_DEN_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
-
-    // unpack message
-    j = _myNi[1] - _offset;
-    for (k = 0; k < _myNi[2]; k++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * k + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                (*lbmom)[i][j][k].setMom_i(l, bufToRecv[idx + l]);
-            }
-        }
-    }
-
-    //////////////////////
-    //// Z-direction /////
-    //////////////////////
-    numDataTransf = numPopTransf * _myNi[0] * _myNi[1];
-    bufToSend.resize(numDataTransf);  // resize bufToSend
-    bufToRecv.resize(numDataTransf);  // resize bufToRecv
-
-    /* send to right, recv from left i = 5, 11, 14, 15, 18 */
-    snode = getMyNeigh(5);
-    rnode = getMyNeigh(4);
-
-    // prepare message for sending
-    k = _myNi[2] - 2 * _offset;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * j + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                bufToSend[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_DEN_0, bufToSend);
-            world.recv(rnode, COMM_DEN_0, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DEN_0, bufToRecv);
-            world.send(snode, COMM_DEN_0, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
-    }
 
-    // unpack message
-    k = 0;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * j + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                (*lbmom)[i][j][k].setMom_i(l, bufToRecv[idx + l]);
-            }
-        }
-    }
-
-    /* send to left, recv from right i = 6, 12, 13, 16, 17 */
-    snode = getMyNeigh(4);
-    rnode = getMyNeigh(5);
-
-    // prepare message for sending
-    k = _offset;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * j + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                bufToSend[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
-            }
-        }
-    }
-
-    // send and receive data or use memcpy if number of CPU in z-dir is 1
-    if (getNodeGrid().getItem(2) > 1)
-    {
-        if (_myPos[2] % 2 == 0)
-        {
-            world.send(snode, COMM_DEN_1, bufToSend);
-            world.recv(rnode, COMM_DEN_1, bufToRecv);
-        }
-        else
-        {
-            world.recv(rnode, COMM_DEN_1, bufToRecv);
-            world.send(snode, COMM_DEN_1, bufToSend);
-        }
-    }
-    else
-    {
-        bufToRecv = bufToSend;
+    for (int _dim = 0; _dim < 3; ++_dim)
+    {
+        /* send to right, recv from left */
+        std::vector<real>& _toRight = haloSend[HALO_DENMOM][_dim][0];
+        forHaloPlane(_myNi, _dim, _myNi[_dim] - 2 * _offset, numPopTransf,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         for (int l = 0; l < numPopTransf; ++l)
+                         {
+                             _toRight[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
+                         }
+                     });
+
+        /* send to left, recv from right */
+        std::vector<real>& _toLeft = haloSend[HALO_DENMOM][_dim][1];
+        forHaloPlane(_myNi, _dim, _offset, numPopTransf,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         for (int l = 0; l < numPopTransf; ++l)
+                         {
+                             _toLeft[idx + l] = (*lbmom)[i][j][k].getMom_i(l);
+                         }
+                     });
+
+        startHalo(HALO_DENMOM, _dim);
+        waitHalo(HALO_DENMOM, _dim);
+
+        // fill the halo planes
+        std::vector<real>& _fromLeft = haloRecv[HALO_DENMOM][_dim][0];
+        forHaloPlane(_myNi, _dim, 0, numPopTransf,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         for (int l = 0; l < numPopTransf; ++l)
+                         {
+                             (*lbmom)[i][j][k].setMom_i(l, _fromLeft[idx + l]);
+                         }
+                     });
+
+        std::vector<real>& _fromRight = haloRecv[HALO_DENMOM][_dim][1];
+        forHaloPlane(_myNi, _dim, _myNi[_dim] - _offset, numPopTransf,
+                     [&](int i, int j, int k, int idx)
+                     {
+                         for (int l = 0; l < numPopTransf; ++l)
+                         {
+                             (*lbmom)[i][j][k].setMom_i(l, _fromRight[idx + l]);
+                         }
+                     });
     }
-
-    // unpack message
-    k = _myNi[2] - _offset;
-    for (j = 0; j < _myNi[1]; j++)
-    {
-        for (i = 0; i < _myNi[0]; i++)
-        {
-            idx = numPopTransf * _myNi[0] * j + i * numPopTransf;
-            for (int l = 0; l < numPopTransf; ++l)
-            {
-                (*lbmom)[i][j][k].setMom_i(l, bufToRecv[idx + l]);
-            }
-        }
-    }
-
-    // release buffers
-    bufToSend.resize(0);
-    bufToRecv.resize(0);
 }
 
 /*******************************************************************************************/
@@ -2527,6 +1943,8 @@ void LatticeBoltzmann::registerPython()
             .add_property("profStep", &LatticeBoltzmann::getProfStep,
                           &LatticeBoltzmann::setProfStep)
             .add_property("getMyNi", &LatticeBoltzmann::getMyNi)
+            .add_property("compression", &LatticeBoltzmann::getCompression,
+                          &LatticeBoltzmann::setCompression)
             .def("getLBMom", &LatticeBoltzmann::getLBMom)
             .def("setLBMom", &LatticeBoltzmann::setLBMom)
             .def("saveLBConf", &LatticeBoltzmann::saveLBConf)
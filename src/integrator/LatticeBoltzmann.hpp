@@ -28,9 +28,13 @@
 #include "Extension.hpp"
 #include "boost/signals2.hpp"
 #include "esutil/Timer.hpp"
+#include "mpi.hpp"
 #include "Real3D.hpp"
 #include "Int3D.hpp"
 #include "LatticeSite.hpp"
+#include "Particle.hpp"
+#include "Buffer.hpp"
+#include <boost/unordered_map.hpp>
 
 typedef std::vector<std::vector<std::vector<espressopp::integrator::LBSite> > > lblattice;
 typedef std::vector<std::vector<std::vector<espressopp::integrator::LBMom> > > lbmoments;
@@ -171,9 +175,9 @@ public:
     void setTotNPart(int _totNPart);  // tot num of MD particles in the whole system (sum over CPUs)
     int getTotNPart();
 
-    void setFOnPart(int _id, Real3D _fOnPart);  // force on particle
-    Real3D getFOnPart(int _id);
-    void addFOnPart(int _id, Real3D _fOnPart);
+    void setFOnPart(longint _id, Real3D _fOnPart);  // force on (local) particle
+    Real3D getFOnPart(longint _id);
+    void addFOnPart(longint _id, Real3D _fOnPart);
 
     void keepLBDump();
 
@@ -208,11 +212,17 @@ public:
     void setDoRestart(bool _restart);  // restart flag
     bool doRestart();
 
+    void setCompression(int _compression);  // deflate level of LB dumps (0 - off)
+    int getCompression();
+
     /* END OF SET AND GET DECLARATION */
 
     void readLBConf(int _mode);  // reads LB configuration from file
     void saveLBConf();           // dumps LB configuration
 
+    void writeCheckpoint(OutBuffer& buf);  // packs the local state for io::Checkpoint
+    void readCheckpoint(InBuffer& buf);    // restores the local state from io::Checkpoint
+
     /* FUNCTIONS DECLARATION */
     void initLatticeSize();
     void initLatticeModel();  // initialize (weights, cis)
@@ -225,21 +235,23 @@ public:
     void galileanTransf(Real3D _specCmVel);  // galilean transform by amount of _momPerPart
 
     /* COUPLING TO MD PARTICLES */
-    void coupleLBtoMD();                  //
+    void coupleLBtoMD();                  // random and viscous forces on all local particles
     void calcRandForce(class Particle&);  // calc random force
-    void calcViscForce(class Particle&);
     void calcDenMom();
     real convMDtoLB(int _opCode);
 
-    void collideStream();  // use collide-stream scheme
+    void collideStream();                            // use collide-stream scheme
+    void collideStreamSlab(int _iBegin, int _iEnd);  // collide-stream real sites of x-slab
 
     void streaming(int _i, int _j, int _k);  // streaming along velocities
 
     /* MPI FUNCTIONS */
     void findMyNeighbours();
     void assignMyLattice();
-    Int3D findGlobIdx();        // find global index of first lb site of cpu
-    void commHalo();            // communicate populations in halo
+    Int3D findGlobIdx();              // find global index of first lb site of cpu
+    void commHalo();                  // communicate populations in halo
+    void postHaloPops(int _dim);      // pack and post halo populations in direction _dim
+    void completeHaloPops(int _dim);  // wait for halo populations and unpack them
     void copyForcesFromHalo();  // copy coupling forces from halo regions to the real lattice sites
     void copyDenMomToHalo();    // copy den and j from real lattice sites to halo
     void makeDecompose();  // decompose storage to put escaped real particles into neighbouring CPU
@@ -276,6 +288,7 @@ private:
     int stepNum;        // step number
     real copyTimestep;  // copy of the integrator timestep
     bool restart;
+    int compression;  // deflate level of LB dumps
     std::shared_ptr<esutil::RNG> rng;  //!< random number generator used for fluctuations
 
     // EXTERNAL FORCES
@@ -292,7 +305,20 @@ private:
     int nSteps;                   // # of MD steps between LB update
     int totNPart;                 // total number of MD particles
     real fricCoeff;               // friction in LB-MD coupling (LJ-units)
-    std::vector<Real3D> fOnPart;  // force acting onto an MD particle
+    // coupling force acting onto a local MD particle, keyed by its id; it migrates with the
+    // particle, so memory scales with the local rather than the global number of particles
+    boost::unordered_map<longint, Real3D> fOnPart;
+
+    // local particles of one coupling step, sorted by the lattice cell they are in
+    struct CouplEntry
+    {
+        int site;       // flat index of the lower corner of the cell
+        Int3D bin;      // the same corner as 3D index
+        Real3D delta;   // position inside the cell (lattice units)
+        Real3D force;   // coupling force onto the particle
+        Particle* part;
+    };
+    std::vector<CouplEntry> couplBatch;
     int saveStep;                 // step numbers of LBConfs to save
 
     // MPI THINGS
@@ -303,9 +329,31 @@ private:
     Int3D nodeGrid;  // 3D-array of processors
     Real3D myLeft;   // left border of a physical ("real") domain for a CPU
 
+    // HALO BUFFERS, indexed by halo kind, direction and message (0 - to the right, 1 - to the
+    // left); persistent requests are (recv 0, recv 1, send 0, send 1) and stay bound to them
+    enum HaloKind
+    {
+        HALO_POPS = 0,
+        HALO_FORCES = 1,
+        HALO_DENMOM = 2
+    };
+    std::vector<real> haloSend[3][3][2];
+    std::vector<real> haloRecv[3][3][2];
+    MPI_Request haloReq[3][3][4];
+
+    void initHaloComm();                  // preallocate buffers, bind persistent requests
+    void freeHaloComm();                  // release persistent requests
+    void startHalo(int _kind, int _dim);  // start exchange of packed planes along _dim
+    void waitHalo(int _kind, int _dim);   // complete exchange along _dim
+
     // SIGNALS
     boost::signals2::connection _befIntV;
     boost::signals2::connection _recalc2;
+    boost::signals2::connection _befSendParticles;
+    boost::signals2::connection _aftRecvParticles;
+
+    void beforeSendParticles(ParticleList& pl, OutBuffer& buf);
+    void afterRecvParticles(ParticleList& pl, InBuffer& buf);
 
     // TIMERS
     esutil::WallTimer swapping, colstream, comm;
@@ -101,10 +101,10 @@ LB/MD simulations. It is implemented as :py:class:`espressopp.integrator.Extensi
 
     .. py:method:: saveLBConf()
 
-        Dumps LB configuration with separate files for coupling forces, \
-        LB-fluid moments and populations (the last one is a bit overkill). \
-        The dump files are written for every CPU separately and \
-        are put in the *dump* folder
+        Dumps LB configuration (populations, LB-fluid moments and coupling \
+        forces on LB-sites and MD-particles) into one parallel HDF5 file \
+        *dump/lbConf.<step>.h5*. The lattice is stored in its global layout, \
+        so the dump can be read back on any number of CPUs.
 
     .. py:method:: keepLBDump()
 
@@ -243,6 +243,15 @@ LB/MD simulations. It is implemented as :py:class:`espressopp.integrator.Extensi
 
         Number of real and halo nodes for the CPU
 
+    .. py:data:: int compression = 0
+
+        Deflate level (1-9) of the dumped LB configuration, 0 switches compression off
+
+        Example
+
+        >>> # write compressed restart files
+        >>> lb.compression = 4
+
 """
 
 from espressopp.esutil import cxxinit
@@ -263,6 +272,6 @@ if pmi.isController :
     class LatticeBoltzmann(Extension, metaclass=pmi.Proxy):
         pmiproxydefs = dict(
                             cls = 'espressopp.integrator.LatticeBoltzmannLocal',
-                            pmiproperty = ['nodeGrid', 'a', 'tau', 'numDims', 'numVels', 'visc_b', 'visc_s', 'gamma_b', 'gamma_s', 'gamma_odd', 'gamma_even', 'lbTemp', 'fricCoeff', 'nSteps', 'profStep', 'getMyNi'],
+                            pmiproperty = ['nodeGrid', 'a', 'tau', 'numDims', 'numVels', 'visc_b', 'visc_s', 'gamma_b', 'gamma_s', 'gamma_odd', 'gamma_even', 'lbTemp', 'fricCoeff', 'nSteps', 'profStep', 'getMyNi', 'compression'],
                             pmicall = ["getLBMom","setLBMom","saveLBConf","keepLBDump"]
                             )
@@ -33,22 +33,69 @@ using namespace esutil;
 
 LOG4ESPP_LOGGER(MinimizeEnergy::theLogger, "MinimizeEnergy");
 
+namespace
+{
+// FIRE parameters as proposed by Bitzek et al.
+const int fire_n_min = 5;
+const real fire_f_inc = 1.1;
+const real fire_f_dec = 0.5;
+const real fire_alpha_start = 0.1;
+const real fire_f_alpha = 0.99;
+
+// Sufficient decrease constant and number of halvings of the L-BFGS line search.
+const real lbfgs_c1 = 1e-4;
+const int lbfgs_max_backtrack = 10;
+}  // namespace
+
 MinimizeEnergy::MinimizeEnergy(std::shared_ptr<System> system,
                                real gamma,
                                real ftol,
                                real max_displacement,
                                bool variable_step_flag)
 
+    : MinimizeEnergy(system, gamma, ftol, max_displacement, variable_step_flag, "sd", 0.0, 10)
+{
+}
+
+MinimizeEnergy::MinimizeEnergy(std::shared_ptr<System> system,
+                               real gamma,
+                               real ftol,
+                               real max_displacement,
+                               bool variable_step_flag,
+                               std::string method,
+                               real etol,
+                               int lbfgs_memory)
+
     : SystemAccess(system),
       gamma_(gamma),
       max_displacement_(max_displacement),
       ftol_sqr_(ftol),
-      variable_step_flag_(variable_step_flag)
+      variable_step_flag_(variable_step_flag),
+      etol_(etol),
+      lbfgs_memory_(lbfgs_memory)
 {
     LOG4ESPP_INFO(theLogger, "construct MinimizeEnergy");
     resort_flag_ = true;
     dp_MAX = 0.;
     nstep_ = 0;
+    energy_ = 0.;
+
+    if (method == "sd")
+        method_ = SteepestDescent;
+    else if (method == "fire")
+        method_ = FIRE;
+    else if (method == "lbfgs")
+        method_ = LBFGS;
+    else
+        throw std::runtime_error("MinimizeEnergy: unknown method " + method +
+                                 " (use sd, fire or lbfgs)");
+
+    if (lbfgs_memory_ < 1) throw std::runtime_error("MinimizeEnergy: lbfgs_memory must be >= 1");
+
+    fire_dt_ = gamma_;
+    fire_dt_max_ = 10.0 * gamma_;
+    fire_alpha_ = fire_alpha_start;
+    fire_npos_ = 0;
 }
 
 MinimizeEnergy::~MinimizeEnergy() { LOG4ESPP_INFO(theLogger, "free MinimizeEnergy"); }
@@ -70,7 +117,17 @@ bool MinimizeEnergy::run(int max_steps, bool verbose)
         resort_flag_ = false;
     }
 
+    // FIRE keeps its own velocities, L-BFGS relies on the cell order of the local particles.
+    if (method_ == FIRE)
+        resetFIRE();
+    else if (method_ == LBFGS)
+        resetLBFGS();
+
+    // The energy is only evaluated if a method or the convergence criterion needs it.
+    bool track_energy = (method_ == LBFGS) || (etol_ > 0.0);
+
     updateForces();
+    if (track_energy) energy_ = computeEnergy();
 
     LOG4ESPP_INFO(theLogger, "starting energy minimalization loop (iters=" << max_steps << ")");
 
@@ -79,13 +136,29 @@ bool MinimizeEnergy::run(int max_steps, bool verbose)
         std::cout << "Minimize energy" << std::endl;
         std::cout << "  current force_max = " << sqrt(f_max_sqr_) << std::endl;
         std::cout << "  f_tol = " << sqrt(ftol_sqr_) << std::endl;
+        std::cout << "  e_tol = " << etol_ << std::endl;
         std::cout << "  max_steps = " << max_steps << std::endl;
         std::cout << "  max displacement = " << max_displacement_ << std::endl;
     }
     int iters = 0;
-    for (; iters < max_steps && f_max_sqr_ > ftol_sqr_; iters++)
+    bool energy_converged = false;
+    for (; iters < max_steps && f_max_sqr_ > ftol_sqr_ && !energy_converged; iters++)
     {
-        steepestDescentStep();
+        real energy_old = energy_;
+        bool forces_updated = false;
+
+        switch (method_)
+        {
+            case FIRE:
+                fireStep();
+                break;
+            case LBFGS:
+                forces_updated = lbfgsStep();
+                break;
+            default:
+                steepestDescentStep();
+                break;
+        }
 
         dp_MAX += sqrt(dp_sqr_max_);
 
@@ -99,13 +172,27 @@ bool MinimizeEnergy::run(int max_steps, bool verbose)
             storage.decompose();
             LOG4ESPP_INFO(theLogger, "Particles have been decomposed.");
             resort_flag_ = false;
+            forces_updated = false;
+            // The history vectors are in the old cell order.
+            if (method_ == LBFGS) resetLBFGS();
         }
 
-        updateForces();
+        if (!forces_updated)
+        {
+            updateForces();
+            if (track_energy) energy_ = computeEnergy();
+        }
+
+        // An undone L-BFGS step leaves the energy unchanged without converging.
+        if (etol_ > 0.0 && dp_sqr_max_ > 0.0) energy_converged = fabs(energy_ - energy_old) < etol_;
 
         if (verbose)
-            std::cout << nstep_ << ": f_max^2=" << f_max_sqr_ << " max_dp^2=" << dp_sqr_max_
-                      << std::endl;
+        {
+            std::cout << nstep_ << ": f_max^2=" << f_max_sqr_ << " max_dp^2=" << dp_sqr_max_;
+            if (track_energy) std::cout << " energy=" << energy_;
+            if (method_ == FIRE) std::cout << " dt=" << fire_dt_;
+            std::cout << std::endl;
+        }
 
         nstep_++;
     }
@@ -116,7 +203,7 @@ bool MinimizeEnergy::run(int max_steps, bool verbose)
         std::cout << "  current force_max = " << sqrt(f_max_sqr_) << std::endl;
         std::cout << "  run for steps = " << iters << std::endl;
         std::cout << "  max displacement^2 = " << dp_sqr_max_ << std::endl;
-        if (f_max_sqr_ > ftol_sqr_)
+        if (f_max_sqr_ > ftol_sqr_ && !energy_converged)
         {
             std::cout << "WARNING: the current max force is greater than the ftol="
                       << sqrt(ftol_sqr_);
@@ -124,7 +211,7 @@ bool MinimizeEnergy::run(int max_steps, bool verbose)
                       << std::endl;
         }
     }
-    retval = (f_max_sqr_ < ftol_sqr_);
+    retval = (f_max_sqr_ < ftol_sqr_) || energy_converged;
 
     LOG4ESPP_INFO(theLogger,
                   "finished run, f_max_sqr_^2=" << f_max_sqr_ << " max_displ^2=" << dp_sqr_max_);
@@ -168,6 +255,20 @@ void MinimizeEnergy::updateForces()
     mpi::all_reduce(*system.comm, f_max, f_max_sqr_, boost::mpi::maximum<real>());
 }
 
+real MinimizeEnergy::computeEnergy()
+{
+    System& system = getSystemRef();
+
+    // computeEnergy of the interactions already reduces over all CPUs.
+    real e = 0.0;
+    const InteractionList& srIL = system.shortRangeInteractions;
+    for (size_t i = 0; i < srIL.size(); i++)
+    {
+        e += srIL[i]->computeEnergy();
+    }
+    return e;
+}
+
 template <typename T>
 int sgn(T val)
 {
@@ -220,6 +321,241 @@ void MinimizeEnergy::steepestDescentStep()
     mpi::all_reduce(*system.comm, dp_sqr_max, dp_sqr_max_, boost::mpi::maximum<real>());
 }
 
+void MinimizeEnergy::resetFIRE()
+{
+    fire_dt_ = gamma_;
+    fire_dt_max_ = 10.0 * gamma_;
+    fire_alpha_ = fire_alpha_start;
+    fire_npos_ = 0;
+
+    CellList realCells = getSystemRef().storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        cit->velocity() = 0.0;
+    }
+}
+
+void MinimizeEnergy::fireStep()
+{
+    LOG4ESPP_INFO(theLogger, "FIRE single step");
+    System& system = getSystemRef();
+    CellList realCells = system.storage->getRealCells();
+
+    // P = F.v, |v|^2 and |F|^2 are reduced together.
+    real local[3] = {0.0, 0.0, 0.0};
+    real global[3];
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        local[0] += cit->force() * cit->velocity();
+        local[1] += cit->velocity().sqr();
+        local[2] += cit->force().sqr();
+    }
+    mpi::all_reduce(*system.comm, local, 3, global, std::plus<real>());
+
+    real power = global[0];
+    real v_norm = sqrt(global[1]);
+    real f_norm = sqrt(global[2]);
+
+    if (power > 0.0)
+    {
+        real mix = (f_norm > 0.0) ? fire_alpha_ * v_norm / f_norm : 0.0;
+        for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+        {
+            cit->velocity() = (1.0 - fire_alpha_) * cit->velocity() + mix * cit->force();
+        }
+        if (fire_npos_ > fire_n_min)
+        {
+            fire_dt_ = std::min(fire_dt_ * fire_f_inc, fire_dt_max_);
+            fire_alpha_ *= fire_f_alpha;
+        }
+        fire_npos_++;
+    }
+    else
+    {
+        fire_dt_ *= fire_f_dec;
+        fire_alpha_ = fire_alpha_start;
+        fire_npos_ = 0;
+        for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+        {
+            cit->velocity() = 0.0;
+        }
+    }
+
+    // Semi-implicit Euler step with unit masses, the displacement is capped.
+    real dp_sqr_max = 0.0;
+    real max_dp_sqr = max_displacement_ * max_displacement_;
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        cit->velocity() += fire_dt_ * cit->force();
+        Real3D dp = fire_dt_ * cit->velocity();
+        real dp_sqr = dp.sqr();
+        if (dp_sqr > max_dp_sqr)
+        {
+            dp *= max_displacement_ / sqrt(dp_sqr);
+            dp_sqr = max_dp_sqr;
+        }
+        cit->position() += dp;
+        dp_sqr_max = std::max(dp_sqr_max, dp_sqr);
+    }
+
+    mpi::all_reduce(*system.comm, dp_sqr_max, dp_sqr_max_, boost::mpi::maximum<real>());
+}
+
+void MinimizeEnergy::resetLBFGS()
+{
+    lbfgs_s_.clear();
+    lbfgs_y_.clear();
+    lbfgs_rho_.clear();
+}
+
+longint MinimizeEnergy::gatherForces(std::vector<real>& f)
+{
+    CellList realCells = getSystemRef().storage->getRealCells();
+    f.clear();
+    longint n = 0;
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit, ++n)
+    {
+        const Real3D& force = cit->force();
+        f.push_back(force[0]);
+        f.push_back(force[1]);
+        f.push_back(force[2]);
+    }
+    return n;
+}
+
+real MinimizeEnergy::globalDot(const std::vector<real>& a, const std::vector<real>& b)
+{
+    real local = 0.0, global;
+    for (size_t i = 0; i < a.size(); i++) local += a[i] * b[i];
+    mpi::all_reduce(*getSystemRef().comm, local, global, std::plus<real>());
+    return global;
+}
+
+bool MinimizeEnergy::lbfgsStep()
+{
+    LOG4ESPP_INFO(theLogger, "L-BFGS single step");
+    System& system = getSystemRef();
+    CellList realCells = system.storage->getRealCells();
+
+    // The gradient is -F.
+    std::vector<real> f_old;
+    gatherForces(f_old);
+    size_t nlocal3 = f_old.size();
+
+    // Two-loop recursion, q starts as the gradient.
+    std::vector<real> d(nlocal3);
+    for (size_t i = 0; i < nlocal3; i++) d[i] = -f_old[i];
+
+    size_t nhist = lbfgs_s_.size();
+    std::vector<real> alpha(nhist);
+    for (size_t k = nhist; k-- > 0;)
+    {
+        alpha[k] = lbfgs_rho_[k] * globalDot(lbfgs_s_[k], d);
+        for (size_t i = 0; i < nlocal3; i++) d[i] -= alpha[k] * lbfgs_y_[k][i];
+    }
+    if (nhist > 0)
+    {
+        const std::vector<real>& y = lbfgs_y_.back();
+        real gamma_k = 1.0 / (lbfgs_rho_.back() * globalDot(y, y));
+        for (size_t i = 0; i < nlocal3; i++) d[i] *= gamma_k;
+    }
+    for (size_t k = 0; k < nhist; k++)
+    {
+        real beta = lbfgs_rho_[k] * globalDot(lbfgs_y_[k], d);
+        for (size_t i = 0; i < nlocal3; i++) d[i] += (alpha[k] - beta) * lbfgs_s_[k][i];
+    }
+    // d is now H*g, the search direction is -d.
+    for (size_t i = 0; i < nlocal3; i++) d[i] = -d[i];
+
+    real slope = -globalDot(f_old, d);
+    if (slope >= 0.0)
+    {
+        // Not a descent direction, fall back to steepest descent.
+        LOG4ESPP_DEBUG(theLogger, "L-BFGS direction is uphill, history is reset");
+        resetLBFGS();
+        for (size_t i = 0; i < nlocal3; i++) d[i] = f_old[i];
+        slope = -globalDot(f_old, f_old);
+    }
+
+    // Initial step length so that no particle moves more than max_displacement.
+    real d_sqr_max = 0.0, d_sqr_max_global;
+    for (size_t i = 0; i < nlocal3; i += 3)
+        d_sqr_max = std::max(d_sqr_max, d[i] * d[i] + d[i + 1] * d[i + 1] + d[i + 2] * d[i + 2]);
+    mpi::all_reduce(*system.comm, d_sqr_max, d_sqr_max_global, boost::mpi::maximum<real>());
+    real step = 1.0;
+    if (d_sqr_max_global > max_displacement_ * max_displacement_)
+        step = max_displacement_ / sqrt(d_sqr_max_global);
+
+    // Backtracking line search with the Armijo condition.
+    real energy_old = energy_;
+    real applied = 0.0;
+    bool accepted = false;
+    for (int trial = 0; trial < lbfgs_max_backtrack; trial++)
+    {
+        size_t i = 0;
+        for (CellListIterator cit(realCells); !cit.isDone(); ++cit, i += 3)
+        {
+            Real3D& pos = cit->position();
+            for (int j = 0; j < 3; j++) pos[j] += (step - applied) * d[i + j];
+        }
+        applied = step;
+
+        updateForces();
+        energy_ = computeEnergy();
+        if (energy_ <= energy_old + lbfgs_c1 * step * slope)
+        {
+            accepted = true;
+            break;
+        }
+        step *= 0.5;
+    }
+
+    std::vector<real> f_new;
+    gatherForces(f_new);
+
+    if (accepted)
+    {
+        std::vector<real> s(nlocal3), y(nlocal3);
+        for (size_t i = 0; i < nlocal3; i++)
+        {
+            s[i] = applied * d[i];
+            y[i] = f_old[i] - f_new[i];  // y = g_new - g_old
+        }
+        real sy = globalDot(s, y);
+        if (sy > std::numeric_limits<real>::epsilon())
+        {
+            lbfgs_s_.push_back(s);
+            lbfgs_y_.push_back(y);
+            lbfgs_rho_.push_back(1.0 / sy);
+            if (static_cast<int>(lbfgs_s_.size()) > lbfgs_memory_)
+            {
+                lbfgs_s_.pop_front();
+                lbfgs_y_.pop_front();
+                lbfgs_rho_.pop_front();
+            }
+        }
+    }
+    else
+    {
+        // Back to the start positions, the next step starts from steepest descent.
+        LOG4ESPP_DEBUG(theLogger, "L-BFGS line search failed, history is reset");
+        resetLBFGS();
+        size_t i = 0;
+        for (CellListIterator cit(realCells); !cit.isDone(); ++cit, i += 3)
+        {
+            Real3D& pos = cit->position();
+            for (int j = 0; j < 3; j++) pos[j] -= applied * d[i + j];
+        }
+        applied = 0.0;
+    }
+
+    mpi::all_reduce(*system.comm, applied * applied * d_sqr_max, dp_sqr_max_,
+                    boost::mpi::maximum<real>());
+
+    // Forces and energy at the new positions are already computed, unless the step was undone.
+    return accepted;
+}
+
 void MinimizeEnergy::registerPython()
 {
     using namespace espressopp::python;
@@ -227,8 +563,11 @@ void MinimizeEnergy::registerPython()
     // Note: use noncopyable and no_init for abstract classes
     class_<MinimizeEnergy, boost::noncopyable>(
         "integrator_MinimizeEnergy", init<std::shared_ptr<System>, real, real, real, bool>())
+        .def(init<std::shared_ptr<System>, real, real, real, bool, std::string, real, int>())
         .add_property("f_max", &MinimizeEnergy::getFMax)
         .add_property("displacement", &MinimizeEnergy::getDpMax)
+        .add_property("energy", &MinimizeEnergy::getEnergy)
+        .add_property("dt", &MinimizeEnergy::getDt)
         .add_property("step", make_getter(&MinimizeEnergy::nstep_),
                       make_setter(&MinimizeEnergy::nstep_))
         .def("run", &MinimizeEnergy::run);
@@ -33,6 +33,10 @@
 #include "interaction/Interaction.hpp"
 #include "interaction/Potential.hpp"
 
+#include <deque>
+#include <string>
+#include <vector>
+
 namespace espressopp
 {
 namespace integrator
@@ -47,6 +51,14 @@ public:
                    real ftol,
                    real max_displacement,
                    bool variable_step_flag);
+    MinimizeEnergy(std::shared_ptr<class espressopp::System> system,
+                   real gamma,
+                   real ftol,
+                   real max_displacement,
+                   bool variable_step_flag,
+                   std::string method,
+                   real etol,
+                   int lbfgs_memory);
     virtual ~MinimizeEnergy();
 
     bool run(int max_steps, bool verbose);
@@ -54,15 +66,35 @@ public:
     /** Register this class so it can be used from Python. */
     static void registerPython();
 
+    /** Minimization algorithms. */
+    enum Method
+    {
+        SteepestDescent,
+        FIRE,
+        LBFGS
+    };
+
 private:
     void steepestDescentStep();
+    void fireStep();
+    bool lbfgsStep();
     void updateForces();
+    real computeEnergy();
+
+    void resetFIRE();
+    void resetLBFGS();
+    longint gatherForces(std::vector<real>& f);
+    real globalDot(const std::vector<real>& a, const std::vector<real>& b);
 
     // Getters
     real getFMax() { return sqrt(f_max_sqr_); }
 
     real getDpMax() { return sqrt(dp_sqr_max_); }
 
+    real getEnergy() { return energy_; }
+
+    real getDt() { return fire_dt_; }
+
     // Params
     real gamma_;
     real max_displacement_;  // Maximum displacement on particle.
@@ -76,6 +108,23 @@ private:
 
     bool resort_flag_;  //!< true implies need for resort of particles
 
+    Method method_;
+    real etol_;        // Energy change limit, when |dE| is lower then stop (0 disables).
+    real energy_;      // Total potential energy after the last force evaluation.
+
+    // FIRE state (Bitzek et al., PRL 97, 170201 (2006)), unit masses are used.
+    real fire_dt_;
+    real fire_dt_max_;
+    real fire_alpha_;
+    int fire_npos_;
+
+    // L-BFGS state, vectors are stored in the order of the local real cells and
+    // the history is dropped whenever the particles are resorted.
+    int lbfgs_memory_;
+    std::deque<std::vector<real> > lbfgs_s_;
+    std::deque<std::vector<real> > lbfgs_y_;
+    std::deque<real> lbfgs_rho_;
+
     longint nstep_;
 
     static LOG4ESPP_DECL_LOGGER(theLogger);
@@ -45,6 +45,20 @@ where :math:`f_{max}` is a maximum force in a single step of steepest descent me
 
 In both cases, the routine runs until the maximum force is bigger than :math:`f_{max}` or for at most *n* steps.
 
+Two faster minimizers can be selected with the *method* parameter:
+
+* ``'fire'`` - the Fast Inertial Relaxation Engine (`Bitzek et al. 2006 <https://doi.org/10.1103/PhysRevLett.97.170201>`_).
+  The particles are moved with unit masses by a damped dynamics in which the velocity is mixed towards the
+  direction of the force. The time step starts at :math:`\gamma` and grows up to :math:`10\gamma` as long as
+  the power :math:`P=F\cdot v` stays positive. The particle velocities are used as the FIRE velocities and are
+  set to zero at the start of each run.
+* ``'lbfgs'`` - the limited-memory BFGS method. The last *lbfgs_memory* position and gradient changes are stored
+  on each CPU for its local particles, dot products are reduced over all CPUs. A backtracking line search on the
+  total energy is used. The history is dropped whenever the particles are redistributed between the cells.
+
+For all methods, no particle moves by more than :math:`d_{max}` in a single step. If *etol* is positive, the
+minimization also stops when the change of the total potential energy between two steps is lower than *etol*.
+
 **Please note**
 This module does not support any integrator extensions.
 
@@ -58,9 +72,14 @@ Example
 >>> em = espressopp.integrator.MinimizeEnergy(system, gamma=0.01, ftol=0.01, max_displacement=0.01, variable_step_flag=True)
 >>> em.run(10000)
 
+Example
+
+>>> em = espressopp.integrator.MinimizeEnergy(system, gamma=0.005, ftol=0.01, max_displacement=0.05, method='fire')
+>>> em.run(10000)
+
 **API**
 
-.. function:: espressopp.integrator.MinimizeEnergy(system, gamma, ftol, max_displacement, variable_step_flag)
+.. function:: espressopp.integrator.MinimizeEnergy(system, gamma, ftol, max_displacement, variable_step_flag, method, etol, lbfgs_memory)
 
                 :param system: The espressopp system object.
                 :type system: espressopp.System
@@ -72,6 +91,12 @@ Example
                 :type max_displacement: float
                 :param variable_step_flag: The flag of adjusting gamma to the force strength.
                 :type variable_step_flag: bool
+                :param method: The minimizer, one of 'sd' (steepest descent), 'fire' or 'lbfgs'. For 'fire', gamma is the initial time step.
+                :type method: str
+                :param etol: The energy change tolerance (0 disables the criterion).
+                :type etol: float
+                :param lbfgs_memory: The number of correction pairs kept by L-BFGS.
+                :type lbfgs_memory: int
 
 .. function:: espressopp.integrator.MinimizeEnergy.run(max_steps, verbose)
 
@@ -79,7 +104,7 @@ Example
         :type max_steps: int
         :param verbose: If set to True then display information about maximum force during the iterations.
         :type verbose: bool
-        :return: The true if the maximum force in the system is lower than ftol otherwise false.
+        :return: The true if the maximum force in the system is lower than ftol (or the energy change is lower than etol) otherwise false.
         :rtype: bool
 
 .. py:data:: f_max
@@ -90,6 +115,14 @@ Example
 
     The maximum displacement used during the run of MinimizeEnergy
 
+.. py:data:: energy
+
+    The total potential energy after the last step (only evaluated for 'lbfgs' or if etol is set).
+
+.. py:data:: dt
+
+    The current time step of the FIRE method.
+
 .. py:data:: step
 
     The current iteration step.
@@ -101,9 +134,10 @@ from espressopp import pmi
 from _espressopp import integrator_MinimizeEnergy
 
 class MinimizeEnergyLocal(integrator_MinimizeEnergy):
-    def __init__(self, system, gamma, ftol, max_displacement, variable_step_flag=False):
+    def __init__(self, system, gamma, ftol, max_displacement, variable_step_flag=False, method='sd', etol=0.0, lbfgs_memory=10):
         if pmi.workerIsActive():
-            cxxinit(self, integrator_MinimizeEnergy, system, gamma, ftol*ftol, max_displacement, variable_step_flag)
+            cxxinit(self, integrator_MinimizeEnergy, system, gamma, ftol*ftol, max_displacement, variable_step_flag,
+                    method, etol, lbfgs_memory)
 
     def run(self, niter, verbose=False):
         if pmi.workerIsActive():
@@ -113,6 +147,6 @@ if pmi.isController:
     class MinimizeEnergy(metaclass=pmi.Proxy):
         pmiproxydefs = dict(
             cls =  'espressopp.integrator.MinimizeEnergyLocal',
-            pmiproperty = ('f_max', 'displacement', 'step'),
+            pmiproperty = ('f_max', 'displacement', 'step', 'energy', 'dt'),
             pmicall = ('run', )
         )
@@ -41,6 +41,19 @@ namespace integrator
 {
 LOG4ESPP_LOGGER(Rattle::theLogger, "Rattle");
 
+namespace
+{
+int getSlot(boost::unordered_map<longint, int>& atomSlot, std::vector<longint>& atoms, longint pid)
+{
+    boost::unordered_map<longint, int>::iterator it = atomSlot.find(pid);
+    if (it != atomSlot.end()) return it->second;
+    int slot = atoms.size();
+    atoms.push_back(pid);
+    atomSlot.insert(std::make_pair(pid, slot));
+    return slot;
+}
+}  // namespace
+
 Rattle::Rattle(std::shared_ptr<System> _system, real _maxit, real _tol, real _rptol)
     : Extension(_system), maxit(_maxit), tol(_tol), rptol(_rptol)
 {
@@ -73,44 +86,85 @@ void Rattle::addBond(int pid1, int pid2, real constraintDist, real mass1, real m
             << std::endl;
         throw std::runtime_error(msg.str());
     }
+    // each light atom has one constraint, a bond added again is ignored as before
+    if (!hydAtoms.insert(pid2).second) return;
+
     ConstrainedBond newbond;
-    newbond.pidHeavy = pid1;
-    newbond.pidHyd = pid2;
+    newbond.slotHeavy = getSlot(atomSlot, constrainedAtoms, pid1);
+    newbond.slotHyd = getSlot(atomSlot, constrainedAtoms, pid2);
     newbond.constraintDist2 = constraintDist * constraintDist;
     newbond.invmassHeavy = 1.0 / mass1;
     newbond.invmassHyd = 1.0 / mass2;
-    constrainedBonds.insert(std::make_pair(pid2, newbond));
-    constrainedBondsKeys.push_back(pid2);
+    constrainedBonds.push_back(newbond);
 }
 
-void Rattle::saveOldPos()
+void Rattle::collectLocalBonds()
 {
-    oldPos.clear();
     System& system = getSystemRef();
-    boost::unordered_map<longint, ConstrainedBond>::iterator it;
-    // collect coordinates of bonds on this CPU
-    // loop over bonds
-    for (it = constrainedBonds.begin(); it != constrainedBonds.end(); it++)
+    const bc::BC& bc = *system.bc;
+
+    localBonds.clear();
+    localAtoms.clear();
+    localIndex.assign(constrainedAtoms.size(), -1);
+
+    // collect bonds on this CPU, both atoms of a bond must be on the same node
+    for (const ConstrainedBond& bond : constrainedBonds)
     {
-        longint heavyID = (it->second).pidHeavy;
-        longint lightID = (it->second).pidHyd;
-        Particle* hp = system.storage->lookupAdrATParticle(heavyID);
-        if (hp)
-        {  // heavy atom is on this node
-            Particle* lp = system.storage->lookupAdrATParticle(lightID);
-            if (!lp)
-            {
-                std::ostringstream msg;
-                msg << "In Rattle, cannot find light particle " << lightID
-                    << ", all light and heavy particles in a group of rigid bonds must be on the "
-                       "same node"
-                    << std::endl;
-                throw std::runtime_error(msg.str());
-            }
-            oldPos.insert(
-                std::make_pair(lightID, std::pair<Real3D, Real3D>(hp->getPos(), lp->getPos())));
+        Particle* hp = system.storage->lookupAdrATParticle(constrainedAtoms[bond.slotHeavy]);
+        Particle* lp = system.storage->lookupAdrATParticle(constrainedAtoms[bond.slotHyd]);
+        if (!hp && !lp) continue;
+        if (!hp || !lp)
+        {
+            std::ostringstream msg;
+            msg << "In Rattle, cannot find particle "
+                << constrainedAtoms[hp ? bond.slotHyd : bond.slotHeavy]
+                << ", all light and heavy particles in a group of rigid bonds must be on the "
+                   "same node"
+                << std::endl;
+            throw std::runtime_error(msg.str());
+        }
+
+        // an atom may take part in more than one constrained bond
+        int& ia = localIndex[bond.slotHyd];
+        if (ia < 0)
+        {
+            ia = localAtoms.size();
+            localAtoms.push_back(lp);
+        }
+        int& ib = localIndex[bond.slotHeavy];
+        if (ib < 0)
+        {
+            ib = localAtoms.size();
+            localAtoms.push_back(hp);
         }
+
+        LocalBond lb;
+        lb.a = ia;
+        lb.b = ib;
+        lb.constraintDist2 = bond.constraintDist2;
+        lb.invmassHeavy = bond.invmassHeavy;
+        lb.invmassHyd = bond.invmassHyd;
+        bc.getMinimumImageVectorBox(lb.rabOld, lp->getPos(), hp->getPos());
+        localBonds.push_back(lb);
+    }
+
+    size_t n = localAtoms.size();
+    currPosition.resize(n);
+    currVelocity.resize(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        currPosition[i] = localAtoms[i]->getPos();
+        currVelocity[i] = localAtoms[i]->getV();
     }
+    movedLastTime.assign(n, 1);
+    movingThisTime.assign(n, 0);
+}
+
+void Rattle::saveOldPos()
+{
+    // the bond vectors at time t are stored in localBonds, the particles are not resorted
+    // between befIntP and aftIntP so the packed particle pointers stay valid
+    collectLocalBonds();
 }
 
 void Rattle::applyPositionConstraints()
@@ -118,35 +172,19 @@ void Rattle::applyPositionConstraints()
     int iteration = 0;
     bool done = false;
     real dt = integrator->getTimeStep();
-    System& system = getSystemRef();
     const bc::BC& bc = *getSystemRef().bc;  // boundary conditions
 
-    boost::unordered_map<longint, Real3D> currPosition;
-    boost::unordered_map<longint, Real3D> currVelocity;
-    boost::unordered_map<longint, bool> movedLastTime;   // was this particle moved last time?
-    boost::unordered_map<longint, bool> movingThisTime;  // is the particle being moved this time?
-
-    if (oldPos.size() == 0)
+    if (localBonds.size() == 0)
     {
         return;
     }  // no rigid bonds on this node
 
-    // loop over bonds on this node
-    OldPos::iterator it;
-    for (it = oldPos.begin(); it != oldPos.end(); it++)
+    // the positions have been updated since saveOldPos
+    size_t n = localAtoms.size();
+    for (size_t i = 0; i < n; i++)
     {
-        longint pidHyd = it->first;
-        longint pidHeavy = constrainedBonds[pidHyd].pidHeavy;
-        // In the maps below, the values for each key pidHeavy may be initialised more than, if
-        // pidHeavy is involved in more than one constrained bond. This is not a problem
-        movedLastTime[pidHyd] = true;
-        movedLastTime[pidHeavy] = true;
-        movingThisTime[pidHyd] = false;
-        movingThisTime[pidHeavy] = false;
-        currPosition[pidHyd] = system.storage->lookupAdrATParticle(pidHyd)->getPos();
-        currPosition[pidHeavy] = system.storage->lookupAdrATParticle(pidHeavy)->getPos();
-        currVelocity[pidHyd] = system.storage->lookupAdrATParticle(pidHyd)->getV();
-        currVelocity[pidHeavy] = system.storage->lookupAdrATParticle(pidHeavy)->getV();
+        currPosition[i] = localAtoms[i]->getPos();
+        currVelocity[i] = localAtoms[i]->getV();
     }
 
     // constraint interations
@@ -154,11 +192,10 @@ void Rattle::applyPositionConstraints()
     {
         done = true;
         // loop over constrained bonds on this cpu
-        for (it = oldPos.begin(); it != oldPos.end(); it++)
+        for (const LocalBond& bond : localBonds)
         {
-            // get pids of the two particles in this bond
-            longint a = it->first;  // pidHyd
-            longint b = constrainedBonds[a].pidHeavy;
+            int a = bond.a;  // light atom
+            int b = bond.b;  // heavy atom
             if (movedLastTime[a] || movedLastTime[b])
             {
                 // compare current distance to desired constraint distance
@@ -167,24 +204,21 @@ void Rattle::applyPositionConstraints()
                     pab, currPosition[a],
                     currPosition[b]);  // a-b, current positions which change during iterations
                 real pabsq = pab.sqr();
-                real constraint_absq = constrainedBonds[a].constraintDist2;
+                real constraint_absq = bond.constraintDist2;
                 real diffsq = pabsq - constraint_absq;
                 if (fabs(diffsq) > (constraint_absq * tol))
                 {
-                    // get ab vector before unconstrained position update
-                    Real3D rab;
-                    bc.getMinimumImageVectorBox(
-                        rab, oldPos[a].second,
-                        oldPos[a].first);          // pos at time t (end of last timestep), a-b;
-                    real rab_dot_pab = rab * pab;  // r_ab(t) * r_ab,curr(t+dt)
+                    // ab vector before unconstrained position update
+                    const Real3D& rab = bond.rabOld;  // pos at time t (end of last timestep), a-b
+                    real rab_dot_pab = rab * pab;     // r_ab(t) * r_ab,curr(t+dt)
                     if (rab_dot_pab < (constraint_absq * rptol))
                     {  // i.e. if angle is too large
                         std::ostringstream msg;
                         msg << "Constraint failure in RATTLE" << std::endl;
                         throw std::runtime_error(msg.str());
                     }
-                    real rma = constrainedBonds[a].invmassHyd;
-                    real rmb = constrainedBonds[a].invmassHeavy;
+                    real rma = bond.invmassHyd;
+                    real rmb = bond.invmassHeavy;
                     real gab = diffsq / (2.0 * (rma + rmb) * rab_dot_pab);
                     // direct constraint along bond vector at end of previous timestep
                     Real3D displ = gab * rab;
@@ -195,19 +229,14 @@ void Rattle::applyPositionConstraints()
                     currVelocity[a] -= rma * displ;
                     currVelocity[b] += rmb * displ;
 
-                    movingThisTime[a] = true;
-                    movingThisTime[b] = true;
+                    movingThisTime[a] = 1;
+                    movingThisTime[b] = 1;
                     done = false;
                 }
             }
         }
-        boost::unordered_map<longint, bool>::iterator it3;
-        for (it3 = movedLastTime.begin(); it3 != movedLastTime.end(); it3++)
-        {
-            longint id = it3->first;
-            movedLastTime[id] = movingThisTime[id];
-            movingThisTime[id] = false;
-        }
+        movedLastTime.swap(movingThisTime);
+        std::fill(movingThisTime.begin(), movingThisTime.end(), 0);
 
         iteration += 1;
     }
@@ -220,13 +249,10 @@ void Rattle::applyPositionConstraints()
     }
 
     // store new values for positions
-    boost::unordered_map<longint, Real3D>::iterator it2;
-    for (it2 = currPosition.begin(); it2 != currPosition.end(); it2++)
+    for (size_t i = 0; i < n; i++)
     {
-        longint id = it2->first;
-        Particle* p = system.storage->lookupAdrATParticle(id);
-        p->position() = currPosition[id];
-        p->velocity() = currVelocity[id];
+        localAtoms[i]->position() = currPosition[i];
+        localAtoms[i]->velocity() = currVelocity[i];
     }
 }
 
@@ -234,68 +260,30 @@ void Rattle::applyVelocityConstraints()
 {
     int iteration = 0;
     bool done = false;
-    System& system = getSystemRef();
     const bc::BC& bc = *getSystemRef().bc;  // boundary conditions
 
-    boost::unordered_map<longint, Real3D> currPosition;
-    boost::unordered_map<longint, Real3D> currVelocity;
-    boost::unordered_map<longint, bool>
-        changedLastTime;  // was this particle velocity changed last time?
-    boost::unordered_map<longint, bool>
-        changingThisTime;  // is the particle velocity being changed this time?
-
-    // get all constrained bonds (light particles) on this CPU
-    // can't use contents of oldPos to identify which constrained bonds are on this CPU because
-    // particles may have changed CPU since applyPositionConstraints()
-    lightPart.clear();
-    boost::unordered_map<longint, ConstrainedBond>::iterator it3;
-    for (it3 = constrainedBonds.begin(); it3 != constrainedBonds.end(); it3++)
-    {
-        longint lightID = (it3->second).pidHyd;
-        Particle* lp = system.storage->lookupAdrATParticle(lightID);
-        if (lp)
-        {  // light atom is on this node
-            lightPart.push_back(lightID);
-        }
-    }
-
-    // loop over constrained bonds on this node
-    std::vector<int>::iterator it;
-    for (it = lightPart.begin(); it != lightPart.end(); it++)
-    {
-        longint pidHyd = *it;
-        longint pidHeavy = constrainedBonds[pidHyd].pidHeavy;
-        // In the maps below, the values for each key pidHeavy may be initialised more than, if
-        // pidHeavy is involved in more than one constrained bond. This is not a problem
-        changedLastTime[pidHyd] = true;
-        changedLastTime[pidHeavy] = true;
-        changingThisTime[pidHyd] = false;
-        changingThisTime[pidHeavy] = false;
-        currPosition[pidHyd] = system.storage->lookupAdrATParticle(pidHyd)->getPos();
-        currPosition[pidHeavy] = system.storage->lookupAdrATParticle(pidHeavy)->getPos();
-        currVelocity[pidHyd] = system.storage->lookupAdrATParticle(pidHyd)->getV();
-        currVelocity[pidHeavy] = system.storage->lookupAdrATParticle(pidHeavy)->getV();
-    }
+    // get all constrained bonds on this CPU again, particles may have changed CPU since
+    // applyPositionConstraints()
+    collectLocalBonds();
 
     // constraint interations
     while (!done && iteration < maxit)
     {
         done = true;
         // loop over constrained bonds on this cpu
-        for (it = lightPart.begin(); it != lightPart.end(); it++)
+        for (const LocalBond& bond : localBonds)
         {
-            // get pids of the two particles in this bond
-            longint a = *it;  // pidHyd
-            longint b = constrainedBonds[a].pidHeavy;
-            if (changedLastTime[a] || changedLastTime[b])
+            int a = bond.a;  // light atom
+            int b = bond.b;  // heavy atom
+            if (movedLastTime[a] || movedLastTime[b])
             {
                 Real3D vab = currVelocity[a] - currVelocity[b];
                 Real3D rab;
                 bc.getMinimumImageVectorBox(rab, currPosition[a], currPosition[b]);
                 real rab_dot_vab = rab * vab;
-                real rma = constrainedBonds[a].invmassHyd;
-                real rmb = constrainedBonds[a].invmassHeavy;
-                real constraint_absq = constrainedBonds[a].constraintDist2;
+                real rma = bond.invmassHyd;
+                real rmb = bond.invmassHeavy;
+                real constraint_absq = bond.constraintDist2;
                 real gab = -1.0 * rab_dot_vab / ((rma + rmb) * constraint_absq);
                 if (fabs(gab) > tol)
                 {
@@ -303,20 +291,14 @@ void Rattle::applyVelocityConstraints()
                     currVelocity[a] += rma * deltav;
                     currVelocity[b] -= rmb * deltav;
 
-                    changingThisTime[a] = true;
-                    changingThisTime[b] = true;
+                    movingThisTime[a] = 1;
+                    movingThisTime[b] = 1;
                     done = false;
                 }
             }
         }
-
-        boost::unordered_map<longint, bool>::iterator it3;
-        for (it3 = changedLastTime.begin(); it3 != changedLastTime.end(); it3++)
-        {
-            longint id = it3->first;
-            changedLastTime[id] = changingThisTime[id];
-            changingThisTime[id] = false;
-        }
+        movedLastTime.swap(movingThisTime);
+        std::fill(movingThisTime.begin(), movingThisTime.end(), 0);
 
         iteration += 1;
     }
@@ -329,12 +311,9 @@ void Rattle::applyVelocityConstraints()
     }
 
     // store new values for velocities
-    boost::unordered_map<longint, Real3D>::iterator it2;
-    for (it2 = currVelocity.begin(); it2 != currVelocity.end(); it2++)
+    for (size_t i = 0; i < localAtoms.size(); i++)
     {
-        longint id = it2->first;
-        Particle* p = system.storage->lookupAdrATParticle(id);
-        p->velocity() = currVelocity[id];
+        localAtoms[i]->velocity() = currVelocity[i];
     }
 }
 
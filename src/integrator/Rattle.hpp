@@ -25,10 +25,14 @@
 #include "types.hpp"
 #include "logging.hpp"
 #include "Extension.hpp"
+#include "Particle.hpp"
 #include <boost/unordered_map.hpp>
+#include <boost/unordered_set.hpp>
 #include <boost/signals2.hpp>
 #include "boost/signals2.hpp"
 
+#include <vector>
+
 namespace espressopp
 {
 namespace integrator
@@ -52,25 +56,39 @@ private:
     void connect();
     void disconnect();
 
-    // positions in previous timestep
-    // key is pid of light atom in bond, value is heavy atom and light atom coordinates
-    typedef boost::unordered_map<longint, std::pair<Real3D, Real3D> > OldPos;
-    OldPos oldPos;
-
-    std::vector<longint> lightPart;  // list of light particles in constrained bonds on the CPU, for
-                                     // use in applyVelocityConstraints
+    void collectLocalBonds();
 
     struct ConstrainedBond
     {
-        longint pidHeavy;
-        longint pidHyd;
+        int slotHeavy;  // indices into constrainedAtoms
+        int slotHyd;
         real constraintDist2;  // squared distance
         real invmassHeavy;
         real invmassHyd;
     };
-    boost::unordered_map<longint, ConstrainedBond> constrainedBonds;  // key: light atom pid
-    std::vector<longint>
-        constrainedBondsKeys;  // list of keys (light atom pids) in constrainedBonds map
+    std::vector<ConstrainedBond> constrainedBonds;  // all constrained bonds in the system
+    std::vector<longint> constrainedAtoms;          // pids of all atoms in constrained bonds
+    boost::unordered_map<longint, int> atomSlot;    // pid -> index in constrainedAtoms, setup only
+    boost::unordered_set<longint> hydAtoms;         // pids of constrained light atoms, setup only
+
+    // Constrained bonds on this CPU, rebuilt once per call from the storage. The particles of the
+    // bonds are packed into contiguous arrays which are then used by the constraint iterations.
+    struct LocalBond
+    {
+        int a;  // light atom, index into localAtoms
+        int b;  // heavy atom, index into localAtoms
+        real constraintDist2;
+        real invmassHeavy;
+        real invmassHyd;
+        Real3D rabOld;  // a-b at the end of the previous timestep
+    };
+    std::vector<LocalBond> localBonds;
+    std::vector<Particle*> localAtoms;
+    std::vector<int> localIndex;  // slot -> index in localAtoms or -1
+    std::vector<Real3D> currPosition;
+    std::vector<Real3D> currVelocity;
+    std::vector<char> movedLastTime;   // was this particle moved last time?
+    std::vector<char> movingThisTime;  // is the particle being moved this time?
 
     real maxit;  // maximum number of iterations
     real tol;    // tolerance for deciding if constraint distance and current distance are similar
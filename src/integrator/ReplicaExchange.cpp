@@ -0,0 +1,224 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "ReplicaExchange.hpp"
+
+#include "System.hpp"
+#include "storage/Storage.hpp"
+#include "iterator/CellListIterator.hpp"
+#include "interaction/Interaction.hpp"
+#include "MDIntegrator.hpp"
+#include "LangevinThermostat.hpp"
+
+#include <cmath>
+
+namespace espressopp
+{
+using namespace iterator;
+
+namespace integrator
+{
+LOG4ESPP_LOGGER(ReplicaExchange::theLogger, "ReplicaExchange");
+
+ReplicaExchange::ReplicaExchange(std::shared_ptr<System> system,
+                                 std::shared_ptr<MDIntegrator> _integrator,
+                                 std::shared_ptr<LangevinThermostat> _thermostat,
+                                 python::list _temperatures,
+                                 long seed)
+    : SystemAccess(system),
+      integrator(_integrator),
+      thermostat(_thermostat),
+      commInitialized(false),
+      replica(-1),
+      nreplicas(0),
+      state(-1),
+      nexchange(0),
+      rng(seed)
+{
+    LOG4ESPP_INFO(theLogger, "construct ReplicaExchange");
+
+    for (int i = 0; i < python::len(_temperatures); i++)
+        temperatures.push_back(python::extract<real>(_temperatures[i]));
+
+    if (temperatures.size() < 2)
+        throw std::runtime_error("ReplicaExchange needs at least 2 temperatures");
+    for (size_t i = 1; i < temperatures.size(); i++)
+        if (temperatures[i] <= temperatures[i - 1])
+            throw std::runtime_error("ReplicaExchange temperatures must be increasing");
+
+    attempted.assign(temperatures.size() - 1, 0);
+    accepted.assign(temperatures.size() - 1, 0);
+}
+
+ReplicaExchange::~ReplicaExchange() { LOG4ESPP_INFO(theLogger, "~ReplicaExchange"); }
+
+void ReplicaExchange::setupCommunicators()
+{
+    // collective on MPI_COMM_WORLD, every CPU of every replica has to call it
+    System& system = getSystemRef();
+    bool isLeader = (system.comm->rank() == 0);
+    // only the leaders get a communicator, the other CPUs pass MPI_UNDEFINED
+    MPI_Comm comm;
+    MPI_Comm_split(MPI_COMM_WORLD, isLeader ? 0 : MPI_UNDEFINED, 0, &comm);
+    if (isLeader) leaders = boost::mpi::communicator(comm, boost::mpi::comm_take_ownership);
+
+    int info[2];
+    if (isLeader)
+    {
+        info[0] = leaders.rank();
+        info[1] = leaders.size();
+    }
+    boost::mpi::broadcast(*system.comm, info, 2, 0);
+    replica = info[0];
+    nreplicas = info[1];
+
+    if (nreplicas != static_cast<int>(temperatures.size()))
+    {
+        std::ostringstream msg;
+        msg << "ReplicaExchange: " << temperatures.size() << " temperatures given for "
+            << nreplicas << " replicas";
+        throw std::runtime_error(msg.str());
+    }
+
+    stateOf.resize(nreplicas);
+    for (int r = 0; r < nreplicas; r++) stateOf[r] = r;
+    state = replica;
+    thermostat->setTemperature(temperatures[state]);
+
+    commInitialized = true;
+}
+
+real ReplicaExchange::computePotentialEnergy()
+{
+    // computeEnergy of the interactions reduces over the replica communicator
+    real e = 0.0;
+    const interaction::InteractionList& srIL = getSystemRef().shortRangeInteractions;
+    for (size_t i = 0; i < srIL.size(); i++) e += srIL[i]->computeEnergy();
+    return e;
+}
+
+void ReplicaExchange::setState(int newState)
+{
+    if (newState == state) return;
+
+    // keep the configuration, move the replica to the new temperature
+    real scale = sqrt(temperatures[newState] / temperatures[state]);
+    CellList realCells = getSystemRef().storage->getRealCells();
+    for (CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        cit->velocity() *= scale;
+    }
+    thermostat->setTemperature(temperatures[newState]);
+    state = newState;
+}
+
+void ReplicaExchange::exchange()
+{
+    if (!commInitialized) setupCommunicators();
+
+    System& system = getSystemRef();
+    real energy = computePotentialEnergy();
+
+    if (system.comm->rank() == 0)
+    {
+        // the first leader takes all decisions, esutil::RNG gives different random numbers on
+        // every rank so the leaders could not agree on them independently
+        std::vector<real> energies;
+        boost::mpi::gather(leaders, energy, energies, 0);
+
+        if (leaders.rank() == 0)
+        {
+            std::vector<int> replicaOf(nreplicas);
+            for (int r = 0; r < nreplicas; r++) replicaOf[stateOf[r]] = r;
+
+            // alternate between even and odd pairs of neighbouring temperatures
+            for (int k = nexchange % 2; k + 1 < nreplicas; k += 2)
+            {
+                int a = replicaOf[k];
+                int b = replicaOf[k + 1];
+                real delta = (1.0 / temperatures[k] - 1.0 / temperatures[k + 1]) *
+                             (energies[a] - energies[b]);
+                attempted[k]++;
+                if (delta >= 0.0 || exp(delta) > rng())
+                {
+                    stateOf[a] = k + 1;
+                    stateOf[b] = k;
+                    accepted[k]++;
+                    LOG4ESPP_DEBUG(theLogger, "swap of temperatures " << k << " and " << k + 1);
+                }
+            }
+        }
+        boost::mpi::broadcast(leaders, stateOf.data(), stateOf.size(), 0);
+        boost::mpi::broadcast(leaders, attempted.data(), attempted.size(), 0);
+        boost::mpi::broadcast(leaders, accepted.data(), accepted.size(), 0);
+    }
+    nexchange++;
+
+    // all CPUs of a replica keep the permutation and the counters
+    boost::mpi::broadcast(*system.comm, stateOf.data(), stateOf.size(), 0);
+    boost::mpi::broadcast(*system.comm, attempted.data(), attempted.size(), 0);
+    boost::mpi::broadcast(*system.comm, accepted.data(), accepted.size(), 0);
+    setState(stateOf[replica]);
+}
+
+void ReplicaExchange::run(int nsteps, int interval)
+{
+    if (interval < 1) throw std::runtime_error("ReplicaExchange: interval must be positive");
+    if (!commInitialized) setupCommunicators();
+
+    for (int done = 0; done < nsteps; done += interval)
+    {
+        integrator->run(std::min(interval, nsteps - done));
+        exchange();
+    }
+}
+
+python::list ReplicaExchange::getAcceptanceRatios()
+{
+    python::list ratios;
+    for (size_t k = 0; k < attempted.size(); k++)
+        ratios.append(attempted[k] > 0 ? real(accepted[k]) / attempted[k] : 0.0);
+    return ratios;
+}
+
+/****************************************************
+** REGISTRATION WITH PYTHON
+****************************************************/
+
+void ReplicaExchange::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<ReplicaExchange, std::shared_ptr<ReplicaExchange>, boost::noncopyable>(
+        "integrator_ReplicaExchange",
+        init<std::shared_ptr<System>, std::shared_ptr<MDIntegrator>,
+             std::shared_ptr<LangevinThermostat>, python::list, long>())
+        .add_property("replica", &ReplicaExchange::getReplica)
+        .add_property("nreplicas", &ReplicaExchange::getNumberOfReplicas)
+        .add_property("state", &ReplicaExchange::getState)
+        .add_property("temperature", &ReplicaExchange::getTemperature)
+        .def("run", &ReplicaExchange::run)
+        .def("exchange", &ReplicaExchange::exchange)
+        .def("getAcceptanceRatios", &ReplicaExchange::getAcceptanceRatios);
+}
+
+}  // namespace integrator
+}  // namespace espressopp
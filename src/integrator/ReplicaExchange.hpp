@@ -0,0 +1,105 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTEGRATOR_REPLICAEXCHANGE_HPP
+#define _INTEGRATOR_REPLICAEXCHANGE_HPP
+
+#include "types.hpp"
+#include "logging.hpp"
+#include "mpi.hpp"
+#include "python.hpp"
+#include "SystemAccess.hpp"
+#include "esutil/RNG.hpp"
+
+#include <vector>
+
+namespace espressopp
+{
+namespace integrator
+{
+class MDIntegrator;
+class LangevinThermostat;
+
+/** Temperature replica exchange driven from C++.
+
+    Every replica runs on its own group of CPUs, the communicator of the replica is the
+    communicator of its system. The first CPU of every replica (the leader) joins a small
+    communicator of all leaders which is split off MPI_COMM_WORLD. Replicas never exchange
+    coordinates: on an accepted swap the thermostat temperatures are exchanged and the
+    velocities are rescaled. Per exchange the potential energies are gathered on the first
+    leader, which decides all swaps, and the new permutation of temperatures is broadcast to
+    the other leaders and within each replica.
+*/
+class ReplicaExchange : public SystemAccess
+{
+public:
+    ReplicaExchange(std::shared_ptr<System> system,
+                    std::shared_ptr<MDIntegrator> integrator,
+                    std::shared_ptr<LangevinThermostat> thermostat,
+                    python::list temperatures,
+                    long seed);
+    ~ReplicaExchange();
+
+    /** Run nsteps MD steps with an exchange attempt every interval steps. */
+    void run(int nsteps, int interval);
+
+    /** Attempt one round of exchanges between neighbouring temperatures. */
+    void exchange();
+
+    int getReplica() { return replica; }
+    int getNumberOfReplicas() { return nreplicas; }
+    /** Index of the temperature this replica runs at. */
+    int getState() { return state; }
+    real getTemperature() { return temperatures[state]; }
+    python::list getAcceptanceRatios();
+
+    static void registerPython();
+
+private:
+    void setupCommunicators();
+    real computePotentialEnergy();
+    void setState(int newState);
+
+    std::shared_ptr<MDIntegrator> integrator;
+    std::shared_ptr<LangevinThermostat> thermostat;
+
+    std::vector<real> temperatures;  // temperature ladder, ordered
+    std::vector<int> stateOf;        // replica -> temperature index
+    std::vector<long> attempted;     // per neighbour pair of temperatures
+    std::vector<long> accepted;
+
+    boost::mpi::communicator leaders;  // only set on the leaders
+    bool commInitialized;
+    int replica;
+    int nreplicas;
+    int state;
+    long nexchange;
+
+    // only drawn on the first leader, which decides all exchanges
+    esutil::RNG rng;
+
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+};
+
+}  // namespace integrator
+}  // namespace espressopp
+
+#endif
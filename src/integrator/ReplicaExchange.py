@@ -0,0 +1,127 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+*************************************
+espressopp.integrator.ReplicaExchange
+*************************************
+
+Temperature replica exchange (parallel tempering) driven from C++.
+
+Every replica is a complete system that runs on its own group of CPUs, defined with a
+:class:`espressopp.pmi.Communicator` as for :class:`espressopp.MultiSystem`. The replicas
+integrate independently and only the potential energies are exchanged between the first CPUs
+of the replicas, so the exchange does not go through the PMI layer. The configurations stay
+where they are: on an accepted swap the temperatures of the two replicas (set through their
+Langevin thermostats) are exchanged and the velocities are rescaled by
+:math:`\sqrt{T_{new}/T_{old}}`.
+
+Neighbouring temperatures :math:`T_k, T_{k+1}` currently held by replicas :math:`a, b` are swapped
+with the probability
+
+.. math::
+
+   p = \min\left(1, \exp\left[\left(\frac{1}{T_k} - \frac{1}{T_{k+1}}\right)(E_a - E_b)\right]\right)
+
+alternating between even and odd pairs.
+
+Example
+
+>>> comms = [pmi.Communicator(list(range(i * ncpus, (i + 1) * ncpus))) for i in range(nreplicas)]
+>>> rex = espressopp.integrator.ReplicaExchange(temperatures=[1.0, 1.1, 1.2, 1.3], seed=42)
+>>> for i in range(nreplicas):
+>>>     pmi.activate(comms[i])
+>>>     # ... setup system, integrator and thermostat of replica i ...
+>>>     rex.setReplica(system, integrator, thermostat)
+>>>     pmi.deactivate(comms[i])
+>>> rex.run(100000, 500)
+>>> print(rex.getAcceptanceRatios())
+
+.. function:: espressopp.integrator.ReplicaExchange(temperatures, seed)
+
+                :param temperatures: The increasing temperature ladder, one per replica.
+                :type temperatures: list of float
+                :param seed: The seed of the exchange random numbers.
+                :type seed: int
+
+.. function:: espressopp.integrator.ReplicaExchange.setReplica(system, integrator, thermostat)
+
+                Must be called while the communicator of the replica is active.
+
+                :param system: The system of the replica.
+                :type system: espressopp.System
+                :param integrator: The integrator of the replica.
+                :type integrator: espressopp.integrator.MDIntegrator
+                :param thermostat: The thermostat whose temperature is exchanged.
+                :type thermostat: espressopp.integrator.LangevinThermostat
+
+.. function:: espressopp.integrator.ReplicaExchange.run(nsteps, interval)
+
+                Integrates all replicas for nsteps steps and attempts exchanges every
+                interval steps.
+
+                :param nsteps: The number of steps.
+                :type nsteps: int
+                :param interval: The number of steps between exchange attempts.
+                :type interval: int
+
+.. function:: espressopp.integrator.ReplicaExchange.getAcceptanceRatios()
+
+                :return: The acceptance ratio of every pair of neighbouring temperatures.
+                :rtype: list of float
+
+.. function:: espressopp.integrator.ReplicaExchange.getTemperature()
+
+                :return: The current temperature of the replica, one entry per CPU.
+                :rtype: list of float
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from _espressopp import integrator_ReplicaExchange
+
+class ReplicaExchangeLocal(object):
+
+    def __init__(self, temperatures, seed=12345):
+        self.temperatures = list(temperatures)
+        self.seed = seed
+
+    def setReplica(self, system, integrator, thermostat):
+        self.cxxobj = integrator_ReplicaExchange(system, integrator, thermostat, self.temperatures, self.seed)
+
+    def run(self, nsteps, interval):
+        self.cxxobj.run(nsteps, interval)
+
+    def exchange(self):
+        self.cxxobj.exchange()
+
+    def getAcceptanceRatios(self):
+        return self.cxxobj.getAcceptanceRatios()
+
+    def getTemperature(self):
+        return self.cxxobj.temperature
+
+if pmi.isController:
+    class ReplicaExchange(metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls = 'espressopp.integrator.ReplicaExchangeLocal',
+            pmicall = ['setReplica', 'run', 'exchange'],
+            pmiinvoke = ['getAcceptanceRatios', 'getTemperature']
+        )
@@ -106,9 +106,9 @@ void Settle::connect()
     _aftIntSlow = integrator->aftIntSlow.connect(std::bind(&Settle::correctVelocities, this));
 }
 
-void Settle::saveOldPos()
+void Settle::collectWaters(bool savePositions)
 {
-    oldPos.clear();
+    waters.clear();
     System& system = getSystemRef();
     // loop over all local molecules
     CellList realCells = system.storage->getRealCells();
@@ -117,45 +117,48 @@ void Settle::saveOldPos()
         // check if molecule is HHO
         if (molIDs.count(cit->id()) > 0)
         {
-            // lookup cit in tuples, and save AT positions
+            // lookup cit in tuples, and save AT particles
             FixedTupleListAdress::iterator it;
             it = fixedTupleList->find(&(*cit));
 
-            oldPos.insert(std::make_pair(
-                cit->id(), Triple<Real3D, Real3D, Real3D>((it->second.at(0))->getPos(),
-                                                          (it->second.at(1))->getPos(),
-                                                          (it->second.at(2))->getPos())));
+            Water w;
+            w.O = it->second.at(0);
+            w.H1 = it->second.at(1);
+            w.H2 = it->second.at(2);
+            if (savePositions)
+            {
+                w.oldO = w.O->getPos();
+                w.oldH1 = w.H1->getPos();
+                w.oldH2 = w.H2->getPos();
+            }
+            waters.push_back(w);
         }
     }
 }
 
+void Settle::saveOldPos()
+{
+    // particles are not resorted before applyConstraints, so the block stays valid
+    collectWaters(true);
+}
+
 void Settle::applyConstraints()
 {
     // call settlep() for every water molecule on node
-    // System& system = getSystemRef();
-    OldPos::iterator it;
-    for (it = oldPos.begin(); it != oldPos.end(); it++)
+    for (Water& w : waters)
     {
-        // std::cout << "in applyConstraints " << system.comm->rank() << " molID " << it->first <<
-        // std::endl;
-        settlep(it->first);
+        settlep(w);
     }
 }
 
 void Settle::correctVelocities()
 {
-    // call settlev() for every water molecule on node
-
-    System& system = getSystemRef();
-    // loop over all local molecules
-    CellList realCells = system.storage->getRealCells();
-    for (iterator::CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    // call settlev() for every water molecule on node, particles may have been resorted since
+    // saveOldPos
+    collectWaters(false);
+    for (Water& w : waters)
     {
-        // check if molecule is HHO
-        if (molIDs.count(cit->id()) > 0)
-        {
-            settlev(cit->id());
-        }
+        settlev(w);
     }
 }
 
@@ -170,37 +173,21 @@ void Settle::correctVelocities()
  * J. Comp. Chem., 13, 952 (1992).
  *
  */
-void Settle::settlep(longint molID)
+void Settle::settlep(Water& w)
 {
-    System& system = getSystemRef();
     const bc::BC& bc = *getSystemRef().bc;  // boundary conditions
     real dt = integrator->getTimeStep();
     real invdt = 1.0 / dt;
 
-    // std::cout << "\nsettling " << molID << "\n";
-
-    // positions in previous time step
-    OldPos::const_iterator pos = oldPos.find(molID);
-    if (pos == oldPos.end())
-    {
-        std::cout << "WARNING: oldPos not found! Skipping settlep().\n";
-        return;
-    }
-
-    // retrieve particles from tuples
-    Particle* vp = system.storage->lookupRealParticle(molID);
-    FixedTupleListAdress::iterator it;
-    it = fixedTupleList->find(&(*vp));
-
-    Particle* O = it->second.at(0);
-    Particle* H1 = it->second.at(1);
-    Particle* H2 = it->second.at(2);
+    Particle* O = w.O;
+    Particle* H1 = w.H1;
+    Particle* H2 = w.H2;
 
     // --- Step1 A1' ---
     // vectors in the plane of the original positions
     // previous positions OHH
-    Real3D b0 = pos->second.second - pos->second.first;  // H1.pos - O.pos
-    Real3D c0 = pos->second.third - pos->second.first;   // H2.pos - O.pos
+    Real3D b0 = w.oldH1 - w.oldO;  // H1.pos - O.pos
+    Real3D c0 = w.oldH2 - w.oldO;  // H2.pos - O.pos
 
     // new center of mass
     // present positions OHH
@@ -281,34 +268,28 @@ void Settle::settlep(longint molID)
     // get unconstrained velocities at v(t+dt)
     Real3D displ1, displ2, displ3;
     bc.getMinimumImageVectorBox(displ1, O->getPos(),
-                                pos->second.first);  // pos after settle - pos at prev timestep
+                                w.oldO);  // pos after settle - pos at prev timestep
     Real3D vO = displ1 * invdt;
-    bc.getMinimumImageVectorBox(displ2, H1->getPos(), pos->second.second);
+    bc.getMinimumImageVectorBox(displ2, H1->getPos(), w.oldH1);
     Real3D vH1 = displ2 * invdt;
-    bc.getMinimumImageVectorBox(displ3, H2->getPos(), pos->second.third);
+    bc.getMinimumImageVectorBox(displ3, H2->getPos(), w.oldH2);
     Real3D vH2 = displ3 * invdt;
     O->setV(vO);
     H1->setV(vH1);
     H2->setV(vH2);
 }
 
-void Settle::settlev(longint molID)
+void Settle::settlev(Water& w)
 {
     // settlev never called, not necessarily debugged
 
     real dt = integrator->getTimeStep();
 
-    System& system = getSystemRef();
     const bc::BC& bc = *getSystemRef().bc;  // boundary conditions
 
-    // retrieve particles from tuples
-    Particle* vp = system.storage->lookupRealParticle(molID);
-    FixedTupleListAdress::iterator it;
-    it = fixedTupleList->find(&(*vp));
-
-    Particle* O = it->second.at(0);
-    Particle* H1 = it->second.at(1);
-    Particle* H2 = it->second.at(2);
+    Particle* O = w.O;
+    Particle* H1 = w.H1;
+    Particle* H2 = w.H2;
 
     Real3D vO = O->getV();
     Real3D vH1 = H1->getV();
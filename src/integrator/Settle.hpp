@@ -36,7 +36,8 @@
 #include "FixedTupleListAdress.hpp"
 #include "boost/signals2.hpp"
 
-#include <set>
+#include <boost/unordered_set.hpp>
+#include <vector>
 
 namespace espressopp
 {
@@ -57,14 +58,26 @@ public:
     void saveOldPos();
     void applyConstraints();
     void correctVelocities();
-    void settlep(longint molID);
-    void settlev(longint molID);
 
     static void registerPython();
 
 private:
+    // Water molecule on this CPU, the atoms are resolved once per step through the tuple list
+    // and kept in a contiguous block for the constraint sweeps.
+    struct Water
+    {
+        Particle* O;
+        Particle* H1;
+        Particle* H2;
+        Real3D oldO, oldH1, oldH2;  // positions in previous timestep
+    };
+
+    void collectWaters(bool savePositions);
+    void settlep(Water& w);
+    void settlev(Water& w);
+
     boost::signals2::connection _befIntP, _aftIntP, _aftIntV, _aftIntSlow;
-    std::set<longint> molIDs;  // IDs of water molecules
+    boost::unordered_set<longint> molIDs;  // IDs of water molecules
 
     real mO, mH, distHH, distOH;
     real mOrmT, mHrmT;
@@ -73,10 +86,7 @@ private:
     real mOmH, mOmH2;
     real twicemO, twicemH, mH2;
 
-    // positions in previous timestep
-    // key is molecule ID (first member of fixedtuplelist), value is OHH coordinates
-    typedef boost::unordered_map<longint, Triple<Real3D, Real3D, Real3D> > OldPos;
-    OldPos oldPos;
+    std::vector<Water> waters;  // water molecules on this CPU
 
     std::shared_ptr<FixedTupleListAdress> fixedTupleList;
     void connect();
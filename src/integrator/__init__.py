@@ -68,3 +68,5 @@ from espressopp.integrator.VelocityVerletOnRadius import *
 from espressopp.integrator.AssociationReaction import *
 from espressopp.integrator.EmptyExtension import *
 from espressopp.integrator.MinimizeEnergy import *
+from espressopp.integrator.ReplicaExchange import *
+from espressopp.integrator.AdressLoadBalance import *
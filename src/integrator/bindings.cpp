@@ -62,6 +62,8 @@
 #include "VelocityVerletOnRadius.hpp"
 #include "AssociationReaction.hpp"
 #include "MinimizeEnergy.hpp"
+#include "ReplicaExchange.hpp"
+#include "AdressLoadBalance.hpp"
 
 #include "EmptyExtension.hpp"
 
@@ -110,6 +112,8 @@ void registerPython()
     VelocityVerletOnRadius::registerPython();
     AssociationReaction::registerPython();
     MinimizeEnergy::registerPython();
+    ReplicaExchange::registerPython();
+    AdressLoadBalance::registerPython();
     EmptyExtension::registerPython();
 }
 }  // namespace integrator
@@ -0,0 +1,149 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTERACTION_AUTOTABULATED_HPP
+#define _INTERACTION_AUTOTABULATED_HPP
+
+#include <stdexcept>
+#include "Potential.hpp"
+#include "InterpolationR2.hpp"
+
+namespace espressopp
+{
+namespace interaction
+{
+/** Potentials whose pair energy is q1 q2 times a function of r. Their raw
+    energy and force are the charge independent part, which is what gets
+    tabulated; the charges are applied per pair.
+*/
+template <class _Potential>
+struct ChargeScaledPotential
+{
+    static const bool value = false;
+};
+
+class CoulombRSpace;
+class ReactionFieldGeneralized;
+
+template <>
+struct ChargeScaledPotential<CoulombRSpace>
+{
+    static const bool value = true;
+};
+
+template <>
+struct ChargeScaledPotential<ReactionFieldGeneralized>
+{
+    static const bool value = true;
+};
+
+/** This class replaces an analytic pair potential by a cubic table in r^2.
+
+    The table covers rMin up to the cutoff of the potential and is refined
+    at construction until energy and force deviate from the analytic form
+    by at most the given tolerance (relative, absolute below 1). Distances
+    below rMin are computed analytically. Cutoff and shift are taken over
+    from the potential, so it can be used wherever the original is.
+*/
+template <class _Potential>
+class AutoTabulated : public PotentialTemplate<AutoTabulated<_Potential> >
+{
+private:
+    typedef PotentialTemplate<AutoTabulated<_Potential> > Super;
+
+    _Potential potential;
+    InterpolationR2 table;
+    real rMin;
+    real tolerance;
+    real maxError;
+
+public:
+    AutoTabulated() : rMin(0.0), tolerance(0.0), maxError(0.0) {}
+
+    AutoTabulated(const _Potential& _potential, real _rMin, real _tolerance)
+        : potential(_potential), rMin(_rMin), tolerance(_tolerance), maxError(0.0)
+    {
+        this->setCutoff(potential.getCutoff());
+        // charge scaled potentials are not shifted by their pair interaction
+        this->setShift(ChargeScaledPotential<_Potential>::value ? 0.0 : potential.getShift());
+        tabulate();
+    }
+
+    const _Potential& getPotential() const { return potential; }
+    real getRMin() const { return rMin; }
+    real getTolerance() const { return tolerance; }
+
+    /// largest deviation of the table from the analytic potential
+    real getMaxError() const { return maxError; }
+
+    void tabulate()
+    {
+        if (!(rMin > 0.0) || !(rMin < this->cutoff) || this->cutoff == infinity)
+            throw std::invalid_argument("AutoTabulated needs 0 < rMin < cutoff < infinity");
+        if (!(tolerance > 0.0)) throw std::invalid_argument("AutoTabulated needs tolerance > 0");
+
+        const _Potential& pot = potential;
+        maxError = table.build(
+            [&pot](real distSqr, real& e, real& ff) {
+                Real3D force(0.0, 0.0, 0.0);
+                real r = sqrt(distSqr);
+                e = pot._computeEnergySqrRaw(distSqr);
+                pot._computeForceRaw(force, Real3D(r, 0.0, 0.0), distSqr);
+                ff = force[0] / r;
+            },
+            rMin, this->cutoff, tolerance);
+    }
+
+    real _computeEnergySqrRaw(real distSqr) const
+    {
+        if (table.inRange(distSqr)) return table.getEnergy(distSqr);
+        return potential._computeEnergySqrRaw(distSqr);
+    }
+
+    bool _computeForceRaw(Real3D& force, const Real3D& dist, real distSqr) const
+    {
+        if (!table.inRange(distSqr)) return potential._computeForceRaw(force, dist, distSqr);
+        force = dist * table.getForceFactor(distSqr);
+        return true;
+    }
+
+    using Super::_computeEnergy;
+    using Super::_computeForce;
+
+    real _computeEnergy(const Particle& p1, const Particle& p2) const
+    {
+        real e = Super::_computeEnergy(p1, p2);
+        if (ChargeScaledPotential<_Potential>::value) e *= p1.q() * p2.q();
+        return e;
+    }
+
+    bool _computeForce(Real3D& force, const Particle& p1, const Particle& p2) const
+    {
+        if (!Super::_computeForce(force, p1, p2)) return false;
+        if (ChargeScaledPotential<_Potential>::value) force *= p1.q() * p2.q();
+        return true;
+    }
+};
+
+}  // namespace interaction
+}  // namespace espressopp
+
+#endif
@@ -43,8 +43,11 @@ CoulombKSpaceEwald::CoulombKSpaceEwald(std::shared_ptr<System> _system,
     kmax = _kmax;
 
     I = Tensor(1.0, 1.0, 1.0, 0.0, 0.0, 0.0);
-    sum = NULL;
-    totsum = NULL;
+    nParticles = 0;
+    totsumValid = false;
+    totsumCottheta = 0.0;
+    presetLiteValid = false;
+    presetLiteCottheta = 0.0;
 
     preset();
     // getParticleNumber(); // geting the number of particles for the current node // it's done in
@@ -63,13 +66,7 @@ CoulombKSpaceEwald::CoulombKSpaceEwald(std::shared_ptr<System> _system,
         std::bind(&CoulombKSpaceEwald::getParticleNumber, this));
 }
 
-CoulombKSpaceEwald::~CoulombKSpaceEwald()
-{
-    delete[] sum;
-    delete[] totsum;
-    sum = NULL;
-    totsum = NULL;
-}
+CoulombKSpaceEwald::~CoulombKSpaceEwald() {}
 
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
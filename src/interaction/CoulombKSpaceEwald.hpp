@@ -70,8 +70,6 @@ namespace interaction
  *  Does not work for triclinic box, slab geometry.
  */
 
-// TODO should be optimized (force energy and virial calculate the same stuff)
-
 class CoulombKSpaceEwald : public PotentialTemplate<CoulombKSpaceEwald>
 {
 private:
@@ -100,10 +98,6 @@ private:
     vector<int> kxfield;
     vector<int> kyfield;
     vector<int> kzfield;
-    // the same as kxfield, kyfield, kzfield, but adjusted as array indexes
-    vector<int> kx_ind;
-    vector<int> ky_ind;
-    vector<int> kz_ind;
 
     // precalculated factors for the virial and virial tensor
     vector<real> virialPref;
@@ -111,17 +105,49 @@ private:
     vector<Tensor> virialTensorPref;
     Tensor I;
 
-    // exponent array
-    vector<vector<dcomplex> > eikx;
-    vector<vector<dcomplex> > eiky;
-    vector<vector<dcomplex> > eikz;
+    // charged local particles in storage order, with the coordinates entering the exponents
+    vector<Particle*> charged;
+    vector<real> xs, ys, zs, qs;
+    // accumulated k-space force per charged particle
+    vector<real> fxs, fys, fzs;
+
+    // exponent arrays exp(i k x) for k = 0..kmax, real and imaginary parts apart, row k
+    // starting at k * nParticles; negative k are the complex conjugates
+    vector<real> eikxRe, eikxIm;
+    vector<real> eikyRe, eikyIm;
+    vector<real> eikzRe, eikzIm;
 
-    vector<vector<dcomplex> > eik;
+    // q exp(i k r) per k-vector, row k starting at k * nParticles
+    vector<real> eikRe, eikIm;
 
     real sum_q2;
 
-    dcomplex* sum;
-    dcomplex* totsum;
+    // structure factor summed over all nodes, real parts followed by imaginary parts and the
+    // sum of the squared charges; reused by energy, force and virial as long as no charge has
+    // moved or changed
+    vector<real> totsum;
+    bool totsumValid;
+    real totsumCottheta;
+
+    // preset_lite() is redone under shear only when cottheta changes
+    bool presetLiteValid;
+    real presetLiteCottheta;
+
+    // row k of an exponent array from rows k - 1 and 1: exp(i k x) = exp(i (k - 1) x) exp(i x)
+    static void powerStep(vector<real>& re, vector<real>& im, int k, int n)
+    {
+        real* r = re.data() + k * n;
+        real* i = im.data() + k * n;
+        const real* pr = re.data() + (k - 1) * n;
+        const real* pi = im.data() + (k - 1) * n;
+        const real* br = re.data() + n;
+        const real* bi = im.data() + n;
+        for (int j = 0; j < n; j++)
+        {
+            r[j] = pr[j] * br[j] - pi[j] * bi[j];
+            i[j] = pr[j] * bi[j] + pi[j] * br[j];
+        }
+    }
 
 public:
     static void registerPython();
@@ -178,9 +204,6 @@ public:
         kyfield.clear();
         kzfield.clear();
 
-        kx_ind.clear();
-        ky_ind.clear();
-        kz_ind.clear();
         virialPref.clear();
         virialDyadicXZ.clear();
         virialTensorPref.clear();
@@ -215,10 +238,6 @@ public:
                         kyfield.push_back(ky);
                         kzfield.push_back(kz);
 
-                        kx_ind.push_back(kx);
-                        ky_ind.push_back(kmax + ky);
-                        kz_ind.push_back(kmax + kz);
-
                         // the tensor should be: deltaKronecker(i,j) - 2*hi*hj / h^2 - hi*hj /
                         // (2*alfa^2)
                         Real3D h(rk2PIx, rk2PIy, rk2PIz);
@@ -240,18 +259,8 @@ public:
 
         // cout <<"node:  "<< system->comm->rank() <<  " kVectorLength: "<< kVectorLength<< " kmax:
         // "<< skmax  <<endl;
-        if (sum != NULL)
-        {
-            delete[] sum;
-            sum = NULL;
-        }
-        if (totsum != NULL)
-        {
-            delete[] totsum;
-            totsum = NULL;
-        }
-        sum = new dcomplex[kVectorLength];
-        totsum = new dcomplex[kVectorLength];
+        totsum.assign(2 * kVectorLength + 1, 0.0);
+        presetLiteValid = false;
 
         getParticleNumber();
     }
@@ -287,9 +296,6 @@ public:
         kyfield.clear();
         kzfield.clear();
 
-        kx_ind.clear();
-        ky_ind.clear();
-        kz_ind.clear();
         virialDyadicXZ.clear();
 
         int min_ky = 0;
@@ -323,10 +329,6 @@ public:
                         kyfield.push_back(ky);
                         kzfield.push_back(kz);
 
-                        kx_ind.push_back(kx);
-                        ky_ind.push_back(kmax + ky);
-                        kz_ind.push_back(kmax + kz);
-
                         // the tensor should be: deltaKronecker(i,j) - 2*hi*hj / h^2 - hi*hj /
                         // (2*alfa^2)
                         Real3D h(rk2PIx, rk2PIy, rk2PIz);
@@ -343,34 +345,16 @@ public:
             min_ky = -kmax;
         }
 
-        if (sum != NULL)
-        {
-            delete[] sum;
-            sum = NULL;
-        }
-        if (totsum != NULL)
-        {
-            delete[] totsum;
-            totsum = NULL;
-        }
-        sum = new dcomplex[kVectorLength];
-        totsum = new dcomplex[kVectorLength];
+        totsum.assign(2 * kVectorLength + 1, 0.0);
+        presetLiteValid = true;
+        presetLiteCottheta = cottheta;
 
         getParticleNumber();
     }
 
-    // here we get the current particle number on the current node
-    // and set the auxiliary arrays eikx, eiky, eikz
-    void getParticleNumber()
-    {
-        nParticles = system->storage->getNRealParticles();
-
-        eikx = vector<vector<dcomplex> >(kmax + 1, vector<dcomplex>(nParticles, 0));
-        eiky = vector<vector<dcomplex> >(2 * kmax + 1, vector<dcomplex>(nParticles, 0));
-        eikz = vector<vector<dcomplex> >(2 * kmax + 1, vector<dcomplex>(nParticles, 0));
-
-        eik = vector<vector<dcomplex> >(kVectorLength, vector<dcomplex>(nParticles, 0));
-    }
+    // the charged particles are gathered at every evaluation, here the cached structure
+    // factor is only invalidated
+    void getParticleNumber() { totsumValid = false; }
 
     // it counts the squared charges over all system. It is used for self energy calculations
     void count_charges(CellList realcells)
@@ -424,110 +408,152 @@ public:
             real offs = system->shearOffset;
             cottheta = ((offs > Lx / 2.0 ? offs - Lx : offs)) / Lz;
         }
-        /* Calculation of k space sums */
-        // -1, 0, 1
-        int j = 0;  // auxiliary variable, particle counter
+        bool sheared = shear_flag && cottheta != .0;
 
-        if (shear_flag && cottheta != .0)
+        if (sheared && !ifVirial && useOtherPreset == 1 &&
+            !(presetLiteValid && presetLiteCottheta == cottheta))
         {
-            if (!ifVirial)
+            preset_lite();
+            totsumValid = false;
+        }
+        // else interpolate kvectors, NOT done yet
+
+        /* gather the charged particles; the structure factor can be reused if none moved */
+        real key = sheared ? cottheta : 0.0;
+        int same = (totsumValid && totsumCottheta == key) ? 1 : 0;
+        int n = 0;
+        charged.clear();
+        for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
+        {
+            Particle& p = *it;
+            real q = p.q();
+            if (q == 0) continue;
+
+            Real3D pos = p.position();
+            real x = pos[0];
+            if (sheared)
+            {
+                // calculate ksum for ewald under shear flow
+                real intc = Lx / cottheta;
+                real zshift = -pos[0] / cottheta;
+                int nshift = static_cast<int>(floor((pos[2] + zshift) / intc) + 1.0);
+                x = pos[0] + (nshift + .0) * Lx - cottheta * pos[2];
+            }
+
+            if (n < static_cast<int>(xs.size()))
             {
-                if (useOtherPreset == 1)
+                if (xs[n] != x || ys[n] != pos[1] || zs[n] != pos[2] || qs[n] != q)
                 {
-                    preset_lite();
-                    // preset();
+                    same = 0;
+                    xs[n] = x;
+                    ys[n] = pos[1];
+                    zs[n] = pos[2];
+                    qs[n] = q;
                 }
-                else  // interpolate kvectors, NOT done yet
-                    ;
             }
-
-            // calculate ksum for ewald under shear flow
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
+            else
             {
-                Particle& p = *it;
-
-                real intc = Lx / cottheta;
-                real zshift = -p.position()[0] / cottheta;
-                int nshift = static_cast<int>(floor((p.position()[2] + zshift) / intc) + 1.0);
-                real px = p.position()[0] + (nshift + .0) * Lx;
-
-                eikx[0][j] = dcomplex(1.0, 0.0);
-                eiky[kmax + 0][j] = dcomplex(1.0, 0.0);
-                eikz[kmax + 0][j] = dcomplex(1.0, 0.0);
-
-                eikx[1][j] = dcomplex(cos(rclx * (px - cottheta * p.position()[2])),
-                                      sin(rclx * (px - cottheta * p.position()[2])));
-                eiky[kmax + 1][j] =
-                    dcomplex(cos(rcly * p.position()[1]), sin(rcly * p.position()[1]));
-                eikz[kmax + 1][j] =
-                    dcomplex(cos(rclz * p.position()[2]), sin(rclz * p.position()[2]));
-
-                eiky[kmax - 1][j] = conj(eiky[kmax + 1][j]);
-                eikz[kmax - 1][j] = conj(eikz[kmax + 1][j]);
-
-                j++;
+                same = 0;
+                xs.push_back(x);
+                ys.push_back(pos[1]);
+                zs.push_back(pos[2]);
+                qs.push_back(q);
             }
+            charged.push_back(&p);
+            n++;
         }
-        else
-        {
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-            {
-                Particle& p = *it;
-
-                eikx[0][j] = dcomplex(1.0, 0.0);
-                eiky[kmax + 0][j] = dcomplex(1.0, 0.0);
-                eikz[kmax + 0][j] = dcomplex(1.0, 0.0);
-
-                eikx[1][j] = dcomplex(cos(rclx * p.position()[0]), sin(rclx * p.position()[0]));
-                eiky[kmax + 1][j] =
-                    dcomplex(cos(rcly * p.position()[1]), sin(rcly * p.position()[1]));
-                eikz[kmax + 1][j] =
-                    dcomplex(cos(rclz * p.position()[2]), sin(rclz * p.position()[2]));
+        if (n != nParticles) same = 0;
+
+        // all nodes have to agree, the sum below is collective
+        MPI_Allreduce(MPI_IN_PLACE, &same, 1, MPI_INT, MPI_LAND, *system->comm);
+        if (same) return;
+
+        nParticles = n;
+        xs.resize(n);
+        ys.resize(n);
+        zs.resize(n);
+        qs.resize(n);
+        eikxRe.resize((kmax + 1) * n);
+        eikxIm.resize((kmax + 1) * n);
+        eikyRe.resize((kmax + 1) * n);
+        eikyIm.resize((kmax + 1) * n);
+        eikzRe.resize((kmax + 1) * n);
+        eikzIm.resize((kmax + 1) * n);
+        eikRe.resize(kVectorLength * n);
+        eikIm.resize(kVectorLength * n);
 
-                eiky[kmax - 1][j] = conj(eiky[kmax + 1][j]);
-                eikz[kmax - 1][j] = conj(eikz[kmax + 1][j]);
-
-                j++;
-            }
+        /* Calculation of k space sums */
+        // 0, 1
+        for (int j = 0; j < n; j++)
+        {
+            eikxRe[j] = eikyRe[j] = eikzRe[j] = 1.0;
+            eikxIm[j] = eikyIm[j] = eikzIm[j] = 0.0;
+            eikxRe[n + j] = cos(rclx * xs[j]);
+            eikxIm[n + j] = sin(rclx * xs[j]);
+            eikyRe[n + j] = cos(rcly * ys[j]);
+            eikyIm[n + j] = sin(rcly * ys[j]);
+            eikzRe[n + j] = cos(rclz * zs[j]);
+            eikzIm[n + j] = sin(rclz * zs[j]);
         }
 
-        // calculation of the rest terms
+        // calculation of the rest terms by recurrence
         for (int k = 2; k <= kmax; k++)
         {
-            j = 0;
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-            {
-                eikx[k][j] = eikx[k - 1][j] * eikx[1][j];
-
-                eiky[kmax + k][j] = eiky[kmax + k - 1][j] * eiky[kmax + 1][j];
-                eiky[kmax - k][j] = conj(eiky[kmax + k][j]);
-
-                eikz[kmax + k][j] = eikz[kmax + k - 1][j] * eikz[kmax + 1][j];
-                eikz[kmax - k][j] = conj(eikz[kmax + k][j]);
-
-                j++;
-            }
+            powerStep(eikxRe, eikxIm, k, n);
+            powerStep(eikyRe, eikyIm, k, n);
+            powerStep(eikzRe, eikzIm, k, n);
         }
 
-        real q;  // particle charge, auxiliary
+        real* skRe = totsum.data();
+        real* skIm = totsum.data() + kVectorLength;
         for (int k = 0; k < kVectorLength; k++)
         {
-            sum[k] = dcomplex(0.0, 0.0);
-            totsum[k] = dcomplex(0.0, 0.0);
-            j = 0;
-            for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
+            int ky = kyfield[k], kz = kzfield[k];
+            real sy = (ky < 0) ? -1.0 : 1.0;  // conjugate for negative k
+            real sz = (kz < 0) ? -1.0 : 1.0;
+            const real* axr = eikxRe.data() + kxfield[k] * n;
+            const real* axi = eikxIm.data() + kxfield[k] * n;
+            const real* ayr = eikyRe.data() + std::abs(ky) * n;
+            const real* ayi = eikyIm.data() + std::abs(ky) * n;
+            const real* azr = eikzRe.data() + std::abs(kz) * n;
+            const real* azi = eikzIm.data() + std::abs(kz) * n;
+            real* er = eikRe.data() + k * n;
+            real* ei = eikIm.data() + k * n;
+
+            real sr = 0.0, si = 0.0;
+            for (int j = 0; j < n; j++)
             {
-                Particle& p = *it;
-                if ((q = p.q()) != 0)
-                {
-                    eik[k][j] = q * (eikx[kx_ind[k]][j] * eiky[ky_ind[k]][j] * eikz[kz_ind[k]][j]);
-                    sum[k] += eik[k][j];
-                }
-                j++;
+                real yi = sy * ayi[j];
+                real zi = sz * azi[j];
+                real xyr = axr[j] * ayr[j] - axi[j] * yi;
+                real xyi = axr[j] * yi + axi[j] * ayr[j];
+                er[j] = qs[j] * (xyr * azr[j] - xyi * zi);
+                ei[j] = qs[j] * (xyr * zi + xyi * azr[j]);
+                sr += er[j];
+                si += ei[j];
             }
+            skRe[k] = sr;
+            skIm[k] = si;
         }
 
-        mpi::all_reduce(*system->comm, sum, kVectorLength, totsum, plus<dcomplex>());
+        // the self energy follows changed charges
+        real q2 = 0.0;
+        for (int j = 0; j < n; j++) q2 += qs[j] * qs[j];
+        totsum[2 * kVectorLength] = q2;
+
+        // one reduction of the plain array instead of boost::mpi on complex numbers
+        MPI_Allreduce(MPI_IN_PLACE, totsum.data(), 2 * kVectorLength + 1,
+                      boost::mpi::get_mpi_datatype<real>(), MPI_SUM, *system->comm);
+        sum_q2 = totsum[2 * kVectorLength];
+        totsumValid = true;
+        totsumCottheta = key;
+    }
+
+    // |S(k)|^2 of the summed structure factor
+    real totsumNorm(int k) const
+    {
+        real re = totsum[k], im = totsum[kVectorLength + k];
+        return re * re + im * im;
     }
 
     real _computeEnergy(CellList realcells)
@@ -535,31 +561,17 @@ public:
         // exponent array
         exponentPrecalculation(realcells);
 
-        mpi::communicator communic = *system->comm;
-
-        int n_nodes = communic.size();
-        int this_node = communic.rank();
-
-        // TODO it could be a problem if   n_nodes > kVectorLength
-        int numk = kVectorLength / n_nodes + 1;
-        int mink = this_node * numk;
-        int maxk = mink + numk;
-        if (maxk > kVectorLength) maxk = kVectorLength;
+        // the structure factor is known on every node, the k-sum needs no communication
         real fact;
-        real node_energy = 0;
-        for (int k = mink; k < maxk; k++)
+        real energy = 0;
+        for (int k = 0; k < kVectorLength; k++)
         {
             if (kxfield[k] == 0)
                 fact = 1.0;
             else
                 fact = 2.0;
-            node_energy += fact * kvector[k] * norm(totsum[k]);
+            energy += fact * kvector[k] * totsumNorm(k);
         }
-        // cout <<"node:  "<< this_node << "  node energy: "<< node_energy << "  fact: "<< fact<< "
-        // kmax: "<< kVectorLength <<endl;
-        // exit(0);
-        real energy = 0;
-        mpi::all_reduce(communic, node_energy, energy, plus<real>());
 
         /* self energy correction */
         energy -= sum_q2 * alpha * M_1_SQRTPI;
@@ -575,6 +587,15 @@ public:
         // exponent array
         exponentPrecalculation(realcells);
 
+        int n = nParticles;
+        fxs.assign(n, 0.0);
+        fys.assign(n, 0.0);
+        fzs.assign(n, 0.0);
+        real* fx = fxs.data();
+        real* fy = fys.data();
+        real* fz = fzs.data();
+        bool sheared = shear_flag && cottheta != .0;
+
         real fact;  // factor due to the symmetry
         for (int k = 0; k < kVectorLength; k++)
         {
@@ -585,46 +606,30 @@ public:
                 fact = 2.0;
                 if (shear_flag && system->ifViscosity && kzfield[k] != 0)
                     system->dyadicP_xz +=
-                        kvector[k] * virialDyadicXZ[k] * norm(totsum[k]) * kxfield[k] * kzfield[k];
+                        kvector[k] * virialDyadicXZ[k] * totsumNorm(k) * kxfield[k] * kzfield[k];
             }
 
-            dcomplex tff = fact * kvector[k] * totsum[k];  // auxiliary complex factor
-            int j = 0;
-            if (shear_flag && cottheta != .0)
-                for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-                {
-                    Particle& p = *it;
-
-                    real tf = 0.0;
-                    if (p.q() != 0)
-                    {
-                        tf = imag(tff * conj(eik[k][j]));
-
-                        p.force()[0] += force_prefac[0] * tf * kxfield[k];
-                        p.force()[1] += force_prefac[1] * tf * kyfield[k];
-                        p.force()[2] += force_prefac[2] * tf * kzfield[k] -
-                                        force_prefac[0] * cottheta * tf * kxfield[k];
-                    }
-                    j++;
-                }
-            else
-                for (iterator::CellListIterator it(realcells); !it.isDone(); ++it)
-                {
-                    Particle& p = *it;
-
-                    real tf = 0.0;
-                    if (p.q() != 0)
-                    {
-                        tf = imag(tff * conj(eik[k][j]));
-
-                        p.force()[0] += force_prefac[0] * tf * kxfield[k];
-                        p.force()[1] += force_prefac[1] * tf * kyfield[k];
-                        p.force()[2] += force_prefac[2] * tf * kzfield[k];
-                    }
-                    j++;
-                }
+            // auxiliary complex factor
+            real tr = fact * kvector[k] * totsum[k];
+            real ti = fact * kvector[k] * totsum[kVectorLength + k];
+            real ax = force_prefac[0] * kxfield[k];
+            real ay = force_prefac[1] * kyfield[k];
+            real az = force_prefac[2] * kzfield[k];
+            if (sheared) az -= force_prefac[0] * cottheta * kxfield[k];
+
+            const real* er = eikRe.data() + k * n;
+            const real* ei = eikIm.data() + k * n;
+            for (int j = 0; j < n; j++)
+            {
+                real tf = ti * er[j] - tr * ei[j];  // imag(tff * conj(eik))
+                fx[j] += ax * tf;
+                fy[j] += ay * tf;
+                fz[j] += az * tf;
+            }
         }
 
+        for (int j = 0; j < n; j++) charged[j]->force() += Real3D(fx[j], fy[j], fz[j]);
+
         return true;
     }
 
@@ -632,32 +637,19 @@ public:
     // (!note: all particle interaction contains only one potential)
     real _computeVirial(CellList realcells)
     {
-        // TODO it's exactly the same part as energy has
         // exponent array
         exponentPrecalculation(realcells, true);
 
-        mpi::communicator communic = *system->comm;
-
-        int n_nodes = communic.size();
-        int this_node = communic.rank();
-
-        // TODO it could be a problem if   n_nodes > kVectorLength
-        int numk = kVectorLength / n_nodes + 1;
-        int mink = this_node * numk;
-        int maxk = mink + numk;
-        if (maxk > kVectorLength) maxk = kVectorLength;
         real fact;
-        real node_virial = 0;
-        for (int k = mink; k < maxk; k++)
+        real virial = 0;
+        for (int k = 0; k < kVectorLength; k++)
         {
             if (kxfield[k] == 0)
                 fact = 1.0;
             else
                 fact = 2.0;
-            node_virial += fact * virialPref[k] * kvector[k] * norm(totsum[k]);
+            virial += fact * virialPref[k] * kvector[k] * totsumNorm(k);
         }
-        real virial = 0;
-        mpi::all_reduce(communic, node_virial, virial, plus<real>());
 
         return virial;
     }
@@ -666,39 +658,20 @@ public:
     // (!note: all particle interaction contains only one potential)
     Tensor _computeVirialTensor(CellList realcells)
     {
-        // TODO it's exactly the same part as energy does
         // exponent array
         exponentPrecalculation(realcells, true);
 
-        mpi::communicator communic = *system->comm;
-
-        int n_nodes = communic.size();
-        int this_node = communic.rank();
-
-        // TODO it could be a problem if   n_nodes > kVectorLength
-        int numk = kVectorLength / n_nodes + 1;
-        int mink = this_node * numk;
-        int maxk = mink + numk;
-        if (maxk > kVectorLength) maxk = kVectorLength;
         real fact;
-        Tensor node_virialTensor = 0;
-        for (int k = mink; k < maxk; k++)
+        Tensor virialTensor(0.0);
+        for (int k = 0; k < kVectorLength; k++)
         {
             if (kxfield[k] == 0)
                 fact = 1.0;
             else
                 fact = 2.0;
-            node_virialTensor += fact * kvector[k] * norm(totsum[k]) * virialTensorPref[k];
+            virialTensor += fact * kvector[k] * totsumNorm(k) * virialTensorPref[k];
         }
 
-        Tensor virialTensor(0.0);
-        mpi::all_reduce(communic, node_virialTensor, virialTensor, plus<Tensor>());
-
-        // using boost::mpi::all_reduce or reduce is very slow for <Tensor>
-        // as a suggestion, one could try the line below:
-        // mpi::all_reduce( communic, (double*)&node_virialTensor, 6, (double*)&virialTensor,
-        // plus<double>());
-
         return virialTensor;
     }
 
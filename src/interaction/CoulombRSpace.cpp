@@ -22,6 +22,7 @@
 
 #include "python.hpp"
 #include "CoulombRSpace.hpp"
+#include "AutoTabulated.hpp"
 #include "Tabulated.hpp"
 #include "VerletListInteractionTemplate.hpp"
 
@@ -33,6 +34,9 @@ namespace interaction
 {
 typedef class VerletListInteractionTemplate<CoulombRSpace> VerletListCoulombRSpace;
 
+typedef class AutoTabulated<CoulombRSpace> AutoTabulatedCoulombRSpace;
+typedef class VerletListInteractionTemplate<AutoTabulatedCoulombRSpace> VerletListAutoTabulatedCoulombRSpace;
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -52,6 +56,17 @@ void CoulombRSpace::registerPython()
              return_value_policy<reference_existing_object>())
         .def("getPotential", &VerletListCoulombRSpace::getPotential,
              return_value_policy<reference_existing_object>());
+
+    class_<AutoTabulatedCoulombRSpace, bases<Potential> >("interaction_AutoTabulatedCoulombRSpace",
+                                                          init<const CoulombRSpace&, real, real>())
+        .add_property("rMin", &AutoTabulatedCoulombRSpace::getRMin)
+        .add_property("tolerance", &AutoTabulatedCoulombRSpace::getTolerance)
+        .add_property("maxError", &AutoTabulatedCoulombRSpace::getMaxError);
+
+    class_<VerletListAutoTabulatedCoulombRSpace, bases<Interaction> >(
+        "interaction_VerletListAutoTabulatedCoulombRSpace", init<std::shared_ptr<VerletList> >())
+        .def("setPotential", &VerletListAutoTabulatedCoulombRSpace::setPotential)
+        .def("getPotential", &VerletListAutoTabulatedCoulombRSpace::getPotentialPtr);
 }
 
 }  // namespace interaction
@@ -92,18 +92,26 @@ public:
 
     // force and energy
 
+    // keep the distance based overloads visible, the vectorized interaction uses them
+    using PotentialTemplate<CoulombRSpace>::_computeEnergy;
+    using PotentialTemplate<CoulombRSpace>::_computeForce;
+
+    // the Verlet list also holds pairs within the skin, so the cutoff is applied here as well
     real _computeEnergy(const Particle& p1, const Particle& p2) const
     {
         Real3D dist = p1.position() - p2.position();
-        real abs_dist = dist.abs();
+        real sqr_dist = dist.sqr();
+        if (sqr_dist > cutoffSqr) return 0.0;
+        real abs_dist = sqrt(sqr_dist);
         return (prefactor * p1.q() * p2.q() * erfc(alpha * abs_dist) / abs_dist);
     }
 
     bool _computeForce(Real3D& force, const Particle& p1, const Particle& p2) const
     {
         Real3D dist = p1.position() - p2.position();
-        real abs_dist = dist.abs();
         real sqr_dist = dist.sqr();
+        if (sqr_dist > cutoffSqr) return false;
+        real abs_dist = sqrt(sqr_dist);
 
         real forceFactor = prefactor * p1.q() * p2.q() *
                            (factor * exp(-alpha2 * sqr_dist) + erfc(alpha * abs_dist) / abs_dist) /
@@ -112,15 +120,20 @@ public:
         return true;
     }
 
+    // charge independent part, for unit charges
     real _computeEnergySqrRaw(real distSqr) const
     {
-        cout << "This function currently doesn't work" << endl;
-        return 0.0;
+        real abs_dist = sqrt(distSqr);
+        return prefactor * erfc(alpha * abs_dist) / abs_dist;
     }
     bool _computeForceRaw(Real3D& force, const Real3D& dist, real distSqr) const
     {
-        cout << "This function currently doesn't work" << endl;
-        return false;
+        real abs_dist = sqrt(distSqr);
+        real forceFactor =
+            prefactor * (factor * exp(-alpha2 * distSqr) + erfc(alpha * abs_dist) / abs_dist) /
+            distSqr;
+        force = dist * forceFactor;
+        return true;
     }
 };
 }  // namespace interaction
@@ -140,6 +140,32 @@ Adding the interaction to the system:
                 :type type1:
                 :type type2:
                 :type potential:
+
+.. function:: espressopp.interaction.AutoTabulatedCoulombRSpace(potential, rMin, tolerance)
+
+                The CoulombRSpace potential tabulated from rMin to its cutoff within
+                tolerance; the deviation reached is in maxError.
+
+                :param potential:
+                :param rMin:
+                :param tolerance: (default: 1e-6)
+                :type potential: CoulombRSpace
+                :type rMin: real
+                :type tolerance: real
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedCoulombRSpace(vl)
+
+                :param vl:
+                :type vl:
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedCoulombRSpace.setPotential(type1, type2, potential)
+
+                :param type1:
+                :param type2:
+                :param potential:
+                :type type1:
+                :type type2:
+                :type potential:
 """
 
 from espressopp import pmi, infinity
@@ -148,7 +174,9 @@ from espressopp.esutil import *
 from espressopp.interaction.Potential import *
 from espressopp.interaction.Interaction import *
 from _espressopp import interaction_CoulombRSpace, \
-                      interaction_VerletListCoulombRSpace
+                      interaction_VerletListCoulombRSpace, \
+                      interaction_AutoTabulatedCoulombRSpace, \
+                      interaction_VerletListAutoTabulatedCoulombRSpace
 
 class CoulombRSpaceLocal(PotentialLocal, interaction_CoulombRSpace):
 
@@ -179,6 +207,26 @@ class VerletListCoulombRSpaceLocal(InteractionLocal, interaction_VerletListCoulo
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             return self.cxxclass.getVerletList(self)
 
+class AutoTabulatedCoulombRSpaceLocal(PotentialLocal, interaction_AutoTabulatedCoulombRSpace):
+
+    def __init__(self, potential, rMin, tolerance=1e-6):
+        """Initialize the local tabulated CoulombRSpace object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_AutoTabulatedCoulombRSpace, potential, rMin, tolerance)
+
+class VerletListAutoTabulatedCoulombRSpaceLocal(InteractionLocal, interaction_VerletListAutoTabulatedCoulombRSpace):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListAutoTabulatedCoulombRSpace, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
 
 if pmi.isController:
 
@@ -188,3 +236,16 @@ if pmi.isController:
     class VerletListCoulombRSpace(Interaction, metaclass=pmi.Proxy):
         pmiproxydefs = dict( cls = 'espressopp.interaction.VerletListCoulombRSpaceLocal',
         pmicall      = ['setPotential', 'getPotential', 'getVerletList'] )
+
+    class AutoTabulatedCoulombRSpace(Potential):
+        'The CoulombRSpace potential, tabulated.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.AutoTabulatedCoulombRSpaceLocal',
+            pmiproperty = ['rMin', 'tolerance', 'maxError']
+            )
+
+    class VerletListAutoTabulatedCoulombRSpace(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListAutoTabulatedCoulombRSpaceLocal',
+            pmicall = ['setPotential','getPotential']
+            )
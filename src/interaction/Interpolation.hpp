@@ -39,6 +39,11 @@ public:
     virtual real getEnergy(real r) const = 0;
     virtual real getForce(real r) const = 0;
     virtual void read(mpi::communicator comm, const char* file) = 0;
+    /// first and last tabulated value of r
+    virtual real getInner() const = 0;
+    virtual real getOuter() const = 0;
+    /// spacing of the tabulated values
+    virtual real getDelta() const = 0;
 };  // class Interpolation
 
 template <class Derived>
@@ -38,6 +38,9 @@ public:
     void readRaw(mpi::communicator comm, const char* file);
     real getEnergyRaw(real r) const;
     real getForceRaw(real r) const;
+    real getInner() const { return inner; }
+    real getOuter() const { return outer; }
+    real getDelta() const { return delta; }
 
 protected:
     static LOG4ESPP_DECL_LOGGER(theLogger);
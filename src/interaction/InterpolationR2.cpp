@@ -0,0 +1,187 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "InterpolationR2.hpp"
+#include "Interpolation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace espressopp
+{
+namespace interaction
+{
+LOG4ESPP_LOGGER(InterpolationR2::theLogger, "InterpolationR2");
+
+namespace
+{
+// cubic Hermite polynomial on [0,1] from end values and slopes (per unit t)
+void hermite(real* c, real p0, real p1, real m0, real m1)
+{
+    c[0] = p0;
+    c[1] = m0;
+    c[2] = 3.0 * (p1 - p0) - 2.0 * m0 - m1;
+    c[3] = 2.0 * (p0 - p1) + m0 + m1;
+}
+}  // namespace
+
+void InterpolationR2::build(const Interpolation& table)
+{
+    real inner = table.getInner();
+    real outer = table.getOuter();
+
+    // resolve at least half a table spacing, or 1/512 of the range for coarse tables; an even
+    // r^2 grid is coarsest in r at its inner end, so the grid starts at the smallest r0 with
+    // (outer^2 - r0^2) / (r0 dr) <= tableBins and the original r-indexed table stays in use
+    // below r0, a distance pairs hardly ever reach
+    real dr = std::min(table.getDelta(), (outer - inner) / 256.0);
+    real b = tableBins * dr;
+    real r0 = 0.5 * (std::sqrt(b * b + 4.0 * outer * outer) - b);
+    if (r0 > inner)
+    {
+        LOG4ESPP_INFO(theLogger, "r^2 grid starts at " << r0 << ", the table is used below");
+        inner = r0;
+    }
+
+    int bins = static_cast<int>(std::ceil((outer * outer - inner * inner) / (inner * dr)));
+
+    sample(
+        [&table, outer](real distSqr, real& e, real& ff) {
+            real r = std::min(std::sqrt(distSqr), outer);
+            e = table.getEnergy(r);
+            ff = table.getForce(r) / r;
+        },
+        inner, outer, bins, false);
+
+    LOG4ESPP_INFO(theLogger, "resampled table " << inner << " - " << outer << " on " << nbins
+                                                << " r^2 bins");
+}
+
+real InterpolationR2::build(const Sampler& f, real inner, real outer, real tolerance)
+{
+    real error = 0.0;
+    for (int bins = 64;; bins *= 2)
+    {
+        sample(f, inner, outer, bins, true);
+        error = maxDeviation(f);
+        if (error <= tolerance || nbins >= maxBins) break;
+    }
+
+    if (error > tolerance)
+    {
+        LOG4ESPP_WARN(theLogger, "tabulation " << inner << " - " << outer << " reaches only "
+                                               << error << " instead of " << tolerance
+                                               << " on " << nbins << " r^2 bins");
+    }
+    else
+    {
+        LOG4ESPP_INFO(theLogger, "tabulated " << inner << " - " << outer << " on " << nbins
+                                              << " r^2 bins, error " << error);
+    }
+    return error;
+}
+
+void InterpolationR2::sample(const Sampler& f, real inner, real outer, int bins, bool probe)
+{
+    r2min = inner * inner;
+    r2max = outer * outer;
+    if (bins > maxBins)
+    {
+        LOG4ESPP_WARN(theLogger, "r^2 grid " << inner << " - " << outer << " needs " << bins
+                                             << " bins, clamped to " << maxBins);
+    }
+    nbins = std::min(std::max(bins, 1), maxBins);
+    real dr2 = (r2max - r2min) / nbins;
+    invdr2 = 1.0 / dr2;
+
+    // samples of energy, its r^2 derivative and the force factor at the bin edges
+    std::vector<real> e(nbins + 1), de(nbins + 1), ff(nbins + 1), dff(nbins + 1);
+    for (int k = 0; k <= nbins; ++k)
+    {
+        f((k == nbins) ? r2max : r2min + k * dr2, e[k], ff[k]);
+        de[k] = -0.5 * ff[k];  // dE/d(r^2) = -F/(2r)
+    }
+
+    if (probe)
+    {
+        // force factor slopes from second order differences a small step off each edge,
+        // one-sided at the ends of the range
+        real h = 1e-3 * dr2;
+        for (int k = 0; k <= nbins; ++k)
+        {
+            real s = (k == nbins) ? r2max : r2min + k * dr2;
+            real sgn = (k == nbins) ? -1.0 : 1.0;
+            real e1, f1, f2;
+            if (k == 0 || k == nbins)
+            {
+                f(s + sgn * h, e1, f1);
+                f(s + sgn * 2.0 * h, e1, f2);
+                dff[k] = sgn * (4.0 * f1 - f2 - 3.0 * ff[k]) / (2.0 * h) * dr2;
+            }
+            else
+            {
+                f(s - h, e1, f1);
+                f(s + h, e1, f2);
+                dff[k] = (f2 - f1) / (2.0 * h) * dr2;
+            }
+        }
+    }
+    else
+    {
+        // force factor slopes from central differences, one-sided at the ends
+        for (int k = 0; k <= nbins; ++k)
+        {
+            if (k == 0)
+                dff[k] = ff[1] - ff[0];
+            else if (k == nbins)
+                dff[k] = ff[k] - ff[k - 1];
+            else
+                dff[k] = 0.5 * (ff[k + 1] - ff[k - 1]);
+        }
+    }
+
+    coeffs.resize(8 * nbins);
+    for (int k = 0; k < nbins; ++k)
+    {
+        hermite(&coeffs[8 * k], e[k], e[k + 1], de[k] * dr2, de[k + 1] * dr2);
+        hermite(&coeffs[8 * k + 4], ff[k], ff[k + 1], dff[k], dff[k + 1]);
+    }
+}
+
+real InterpolationR2::maxDeviation(const Sampler& f) const
+{
+    // cubic Hermite errors peak near the bin centres; the force is compared as F = r F/r
+    real dr2 = 1.0 / invdr2;
+    real error = 0.0;
+    for (int k = 0; k < nbins; ++k)
+    {
+        real distSqr = r2min + (k + 0.5) * dr2;
+        real r = std::sqrt(distSqr);
+        real e, ff;
+        f(distSqr, e, ff);
+        error = std::max(error, std::abs(getEnergy(distSqr) - e) / std::max(std::abs(e), 1.0));
+        error = std::max(error, r * std::abs(getForceFactor(distSqr) - ff) /
+                                    std::max(r * std::abs(ff), 1.0));
+    }
+    return error;
+}
+
+}  // namespace interaction
+}  // namespace espressopp
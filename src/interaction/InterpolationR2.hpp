@@ -0,0 +1,112 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTERACTION_INTERPOLATIONR2_HPP
+#define _INTERACTION_INTERPOLATIONR2_HPP
+
+#include <functional>
+#include <vector>
+#include "types.hpp"
+#include "logging.hpp"
+
+namespace espressopp
+{
+namespace interaction
+{
+class Interpolation;
+
+/** Resampling of a tabulated pair potential on an even grid in r^2.
+
+    Energy and force factor F(r)/r are stored as cubic polynomials per
+    bin, both blocks of one bin next to each other in one flat array,
+    so a pair evaluation needs no sqrt, no virtual call and touches one
+    cache line. The grid is chosen fine enough that the resampling
+    error stays far below the one of the original table. Distances
+    outside the table are left to the original interpolation.
+*/
+class InterpolationR2
+{
+public:
+    InterpolationR2() : nbins(0), r2min(0.0), r2max(0.0), invdr2(0.0) {}
+
+    /// energy and F(r)/r at a given r^2
+    typedef std::function<void(real distSqr, real& energy, real& forceFactor)> Sampler;
+
+    /** resample table up to its last tabulated distance on tableBins bins at most,
+        starting where the grid still resolves half a table spacing */
+    void build(const Interpolation& table);
+
+    /** tabulate f between inner and outer, doubling the bins until energy and force
+        at the bin centres agree with f within tolerance, relative to their magnitude
+        or absolute below 1; returns the largest deviation found on the final grid */
+    real build(const Sampler& f, real inner, real outer, real tolerance);
+
+    int getBins() const { return nbins; }
+
+    bool inRange(real distSqr) const { return distSqr >= r2min && distSqr < r2max; }
+
+    real getEnergy(real distSqr) const
+    {
+        real t;
+        const real* c = bin(distSqr, t);
+        return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
+    /// F(r)/r, to be multiplied with the distance vector
+    real getForceFactor(real distSqr) const
+    {
+        real t;
+        const real* c = bin(distSqr, t) + 4;
+        return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
+    static const int maxBins = 32768;
+    static const int tableBins = 4096;
+
+protected:
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+
+private:
+    void sample(const Sampler& f, real inner, real outer, int bins, bool probe);
+    real maxDeviation(const Sampler& f) const;
+
+    const real* bin(real distSqr, real& t) const
+    {
+        real x = (distSqr - r2min) * invdr2;
+        int i = static_cast<int>(x);
+        if (i >= nbins) i = nbins - 1;  // distSqr rounded onto r2max
+        t = x - i;
+        return &coeffs[8 * i];
+    }
+
+    int nbins;
+    real r2min;
+    real r2max;
+    real invdr2;
+
+    // per bin: energy c0..c3, force factor c0..c3 in t = (r^2 - r2min) / dr2 - bin
+    std::vector<real> coeffs;
+};
+
+}  // namespace interaction
+}  // namespace espressopp
+
+#endif
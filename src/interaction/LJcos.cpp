@@ -20,6 +20,7 @@
 
 #include "python.hpp"
 #include "LJcos.hpp"
+#include "AutoTabulated.hpp"
 #include "Tabulated.hpp"
 #include "VerletListInteractionTemplate.hpp"
 #include "VerletListAdressInteractionTemplate.hpp"
@@ -37,6 +38,9 @@ typedef class VerletListHadressInteractionTemplate<LJcos, Tabulated> VerletListH
 typedef class CellListAllPairsInteractionTemplate<LJcos> CellListLJcos;
 typedef class FixedPairListInteractionTemplate<LJcos> FixedPairListLJcos;
 
+typedef class AutoTabulated<LJcos> AutoTabulatedLJcos;
+typedef class VerletListInteractionTemplate<AutoTabulatedLJcos> VerletListAutoTabulatedLJcos;
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -84,6 +88,17 @@ void LJcos::registerPython()
         .def("setPotential", &FixedPairListLJcos::setPotential)
         .def("setFixedPairList", &FixedPairListLJcos::setFixedPairList)
         .def("getFixedPairList", &FixedPairListLJcos::getFixedPairList);
+
+    class_<AutoTabulatedLJcos, bases<Potential> >("interaction_AutoTabulatedLJcos",
+                                                  init<const LJcos&, real, real>())
+        .add_property("rMin", &AutoTabulatedLJcos::getRMin)
+        .add_property("tolerance", &AutoTabulatedLJcos::getTolerance)
+        .add_property("maxError", &AutoTabulatedLJcos::getMaxError);
+
+    class_<VerletListAutoTabulatedLJcos, bases<Interaction> >(
+        "interaction_VerletListAutoTabulatedLJcos", init<std::shared_ptr<VerletList> >())
+        .def("setPotential", &VerletListAutoTabulatedLJcos::setPotential)
+        .def("getPotential", &VerletListAutoTabulatedLJcos::getPotentialPtr);
 }
 
 }  // namespace interaction
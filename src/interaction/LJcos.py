@@ -157,6 +157,32 @@ else:
 
                 :param potential:
                 :type potential:
+
+.. function:: espressopp.interaction.AutoTabulatedLJcos(potential, rMin, tolerance)
+
+                The LJcos potential tabulated from rMin to its cutoff within
+                tolerance; the deviation reached is in maxError.
+
+                :param potential:
+                :param rMin:
+                :param tolerance: (default: 1e-6)
+                :type potential: LJcos
+                :type rMin: real
+                :type tolerance: real
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedLJcos(vl)
+
+                :param vl:
+                :type vl:
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedLJcos.setPotential(type1, type2, potential)
+
+                :param type1:
+                :param type2:
+                :param potential:
+                :type type1:
+                :type type2:
+                :type potential:
 """
 from espressopp import pmi, infinity
 from espressopp.esutil import *
@@ -168,7 +194,9 @@ from _espressopp import interaction_LJcos, \
                       interaction_VerletListAdressLJcos, \
                       interaction_VerletListHadressLJcos, \
                       interaction_CellListLJcos, \
-                      interaction_FixedPairListLJcos
+                      interaction_FixedPairListLJcos, \
+                      interaction_AutoTabulatedLJcos, \
+                      interaction_VerletListAutoTabulatedLJcos
 
 class LJcosLocal(PotentialLocal, interaction_LJcos):
 
@@ -252,6 +280,27 @@ class FixedPairListLJcosLocal(InteractionLocal, interaction_FixedPairListLJcos):
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             return self.cxxclass.getFixedPairList(self)
 
+class AutoTabulatedLJcosLocal(PotentialLocal, interaction_AutoTabulatedLJcos):
+
+    def __init__(self, potential, rMin, tolerance=1e-6):
+        """Initialize the local tabulated LJcos object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_AutoTabulatedLJcos, potential, rMin, tolerance)
+
+class VerletListAutoTabulatedLJcosLocal(InteractionLocal, interaction_VerletListAutoTabulatedLJcos):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListAutoTabulatedLJcos, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
 if pmi.isController:
     class LJcos(Potential):
         'The Lennard-Jones potential.'
@@ -289,3 +338,16 @@ if pmi.isController:
             cls =  'espressopp.interaction.FixedPairListLJcosLocal',
             pmicall = ['setPotential', 'setFixedPairList','getFixedPairList' ]
         )
+
+    class AutoTabulatedLJcos(Potential):
+        'The LJcos potential, tabulated.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.AutoTabulatedLJcosLocal',
+            pmiproperty = ['rMin', 'tolerance', 'maxError']
+            )
+
+    class VerletListAutoTabulatedLJcos(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListAutoTabulatedLJcosLocal',
+            pmicall = ['setPotential','getPotential']
+            )
@@ -26,6 +26,7 @@
 #include "Harmonic.hpp"
 #include "ReactionFieldGeneralized.hpp"
 #include "VerletListInteractionTemplate.hpp"
+#include "VerletListMultiInteractionTemplate.hpp"
 #include "VerletListAdressInteractionTemplate.hpp"
 #include "VerletListAdressATInteractionTemplate.hpp"
 #include "VerletListAdressCGInteractionTemplate.hpp"
@@ -84,6 +85,10 @@ typedef class VerletListHadressInteractionTemplate<LennardJones, Harmonic>
 typedef class CellListAllPairsInteractionTemplate<LennardJones> CellListLennardJones;
 typedef class FixedPairListInteractionTemplate<LennardJones> FixedPairListLennardJones;
 typedef class FixedPairListTypesInteractionTemplate<LennardJones> FixedPairListTypesLennardJones;
+typedef class VerletListMultiInteractionTemplate<LennardJones, ReactionFieldGeneralized>
+    VerletListLenJonesReacFieldGen;
+typedef class VerletListMultiInteractionTemplate<LennardJones, ReactionFieldGeneralized, Tabulated>
+    VerletListLJReacFieldGenTab;
 LOG4ESPP_LOGGER(LennardJones::theLogger, "LennardJones");
 // LOG4ESPP_LOGGER(VerletListLennardJones::theLogger, "VerletListLennardJones");
 
@@ -248,6 +253,24 @@ void LennardJones::registerPython()
         .def("getFixedPairList", &FixedPairListTypesLennardJones::getFixedPairList)
         .def("setPotential", &FixedPairListTypesLennardJones::setPotential)
         .def("getPotential", &FixedPairListTypesLennardJones::getPotentialPtr);
+
+    class_<VerletListLenJonesReacFieldGen, bases<Interaction> >(
+        "interaction_VerletListLenJonesReacFieldGen", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLenJonesReacFieldGen::getVerletList)
+        .def("setPotential1", &VerletListLenJonesReacFieldGen::setPotential<0>)
+        .def("setPotential2", &VerletListLenJonesReacFieldGen::setPotential<1>)
+        .def("getPotential1", &VerletListLenJonesReacFieldGen::getPotentialPtr<0>)
+        .def("getPotential2", &VerletListLenJonesReacFieldGen::getPotentialPtr<1>);
+
+    class_<VerletListLJReacFieldGenTab, bases<Interaction> >(
+        "interaction_VerletListLJReacFieldGenTab", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLJReacFieldGenTab::getVerletList)
+        .def("setPotential1", &VerletListLJReacFieldGenTab::setPotential<0>)
+        .def("setPotential2", &VerletListLJReacFieldGenTab::setPotential<1>)
+        .def("setPotential3", &VerletListLJReacFieldGenTab::setPotential<2>)
+        .def("getPotential1", &VerletListLJReacFieldGenTab::getPotentialPtr<0>)
+        .def("getPotential2", &VerletListLJReacFieldGenTab::getPotentialPtr<1>)
+        .def("getPotential3", &VerletListLJReacFieldGenTab::getPotentialPtr<2>);
 }
 
 }  // namespace interaction
@@ -690,6 +690,42 @@ espressopp.interaction.LennardJones
         :type type2: int
         :type potential: std::shared_ptr<Harmonic>
 
+.. function:: espressopp.interaction.VerletListLenJonesReacFieldGen(vl)
+
+        Defines a verletlist-based interaction using both a LennardJones potential and a ReactionFieldGeneralized potential, evaluated in a single loop over the particle pairs.
+
+        :param vl: Verletlist object
+        :type vl: std::shared_ptr<VerletList>
+
+.. function:: espressopp.interaction.VerletListLenJonesReacFieldGen.setPotential1(type1, type2, potential)
+
+        Sets the LennardJones potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: LennardJones potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<LennardJones>
+
+.. function:: espressopp.interaction.VerletListLenJonesReacFieldGen.setPotential2(type1, type2, potential)
+
+        Sets the ReactionFieldGeneralized potential for interacting particles of type1 and type2.
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: ReactionFieldGeneralized potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<ReactionFieldGeneralized>
+
+.. function:: espressopp.interaction.VerletListLJReacFieldGenTab(vl)
+
+        Defines a verletlist-based interaction using a LennardJones, a ReactionFieldGeneralized and a tabulated potential, evaluated in a single loop over the particle pairs. The potentials are set with setPotential1, setPotential2 and setPotential3 and read back with getPotential1, getPotential2 and getPotential3.
+
+        :param vl: Verletlist object
+        :type vl: std::shared_ptr<VerletList>
+
 """
 from espressopp import pmi, infinity
 from espressopp.esutil import *
@@ -716,7 +752,9 @@ from _espressopp import interaction_LennardJones, \
                       interaction_VerletListHadressLennardJonesHarmonic, \
                       interaction_CellListLennardJones, \
                       interaction_FixedPairListLennardJones, \
-                      interaction_FixedPairListTypesLennardJones
+                      interaction_FixedPairListTypesLennardJones, \
+                      interaction_VerletListLenJonesReacFieldGen, \
+                      interaction_VerletListLJReacFieldGenTab
 
 class LennardJonesLocal(PotentialLocal, interaction_LennardJones):
 
@@ -1059,6 +1097,66 @@ class FixedPairListTypesLennardJonesLocal(InteractionLocal, interaction_FixedPai
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.setFixedPairList(self, fixedpairlist)
 
+class VerletListLenJonesReacFieldGenLocal(InteractionLocal, interaction_VerletListLenJonesReacFieldGen):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListLenJonesReacFieldGen, vl)
+
+    def setPotential1(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential1(self, type1, type2, potential)
+
+    def getPotential1(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential1(self, type1, type2)
+
+    def setPotential2(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential2(self, type1, type2, potential)
+
+    def getPotential2(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential2(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+class VerletListLJReacFieldGenTabLocal(InteractionLocal, interaction_VerletListLJReacFieldGenTab):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListLJReacFieldGenTab, vl)
+
+    def setPotential1(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential1(self, type1, type2, potential)
+
+    def getPotential1(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential1(self, type1, type2)
+
+    def setPotential2(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential2(self, type1, type2, potential)
+
+    def getPotential2(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential2(self, type1, type2)
+
+    def setPotential3(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential3(self, type1, type2, potential)
+
+    def getPotential3(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential3(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
 if pmi.isController:
     class LennardJones(Potential):
         'The Lennard-Jones potential.'
@@ -1186,3 +1284,15 @@ if pmi.isController:
             cls =  'espressopp.interaction.FixedPairListTypesLennardJonesLocal',
             pmicall = ['setPotential', 'getPotential', 'setFixedPairList','getFixedPairList' ]
             )
+
+    class VerletListLenJonesReacFieldGen(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListLenJonesReacFieldGenLocal',
+            pmicall = ['setPotential1', 'setPotential2', 'getPotential1', 'getPotential2', 'getVerletList']
+            )
+
+    class VerletListLJReacFieldGenTab(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListLJReacFieldGenTabLocal',
+            pmicall = ['setPotential1', 'setPotential2', 'setPotential3', 'getPotential1', 'getPotential2', 'getPotential3', 'getVerletList']
+            )
@@ -0,0 +1,183 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "LennardJonesCoulombRSpace.hpp"
+
+namespace espressopp
+{
+namespace interaction
+{
+void VerletListLennardJonesCoulombRSpace::addForces()
+{
+    LOG4ESPP_DEBUG(Potential::theLogger,
+                   "loop over verlet list pairs and exclusions and add forces");
+
+    int vlmaxtype = verletList->getMaxType();
+    Potential max_pot = potentialArray.at(vlmaxtype, vlmaxtype);  // force a resize
+
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+        const Potential& potential = potentialArray(p1.type(), p2.type());
+
+        Real3D dist = p1.position() - p2.position();
+        real ffactor = potential._computePairForceFactor(dist.sqr(), p1.q() * p2.q());
+        if (ffactor == 0.0) continue;
+
+        Real3D force = dist * ffactor;
+        p1.force() += force;
+        p2.force() -= force;
+    }
+
+    forExclusions(
+        [](Particle& p1, Particle& p2, const Potential& potential, const Real3D& dist, real qq)
+        {
+            Real3D force = dist * potential._computeExclusionForceFactor(dist.sqr(), qq);
+            p1.force() += force;
+            p2.force() -= force;
+        });
+}
+
+real VerletListLennardJonesCoulombRSpace::computeEnergy()
+{
+    LOG4ESPP_DEBUG(Potential::theLogger,
+                   "loop over verlet list pairs and exclusions and sum up potential energies");
+
+    real es = 0.0;
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+        const Potential& potential = getPotential(p1.type(), p2.type());
+        Real3D dist = p1.position() - p2.position();
+        es += potential._computePairEnergy(dist.sqr(), p1.q() * p2.q());
+    }
+
+    forExclusions(
+        [&es](Particle&, Particle&, const Potential& potential, const Real3D& dist, real qq)
+        { es += potential._computeExclusionEnergy(dist.sqr(), qq); });
+
+    // reduce over all CPUs
+    real esum;
+    boost::mpi::all_reduce(*getVerletList()->getSystem()->comm, es, esum, std::plus<real>());
+    return esum;
+}
+
+real VerletListLennardJonesCoulombRSpace::computeVirial()
+{
+    LOG4ESPP_DEBUG(Potential::theLogger,
+                   "loop over verlet list pairs and exclusions and sum up virial");
+
+    real w = 0.0;
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+        const Potential& potential = getPotential(p1.type(), p2.type());
+
+        Real3D dist = p1.position() - p2.position();
+        real distSqr = dist.sqr();
+        w += distSqr * potential._computePairForceFactor(distSqr, p1.q() * p2.q());
+    }
+
+    forExclusions(
+        [&w](Particle&, Particle&, const Potential& potential, const Real3D& dist, real qq)
+        {
+            real distSqr = dist.sqr();
+            w += distSqr * potential._computeExclusionForceFactor(distSqr, qq);
+        });
+
+    // reduce over all CPUs
+    real wsum;
+    boost::mpi::all_reduce(*mpiWorld, w, wsum, std::plus<real>());
+    return wsum;
+}
+
+void VerletListLennardJonesCoulombRSpace::computeVirialTensor(Tensor& w)
+{
+    LOG4ESPP_DEBUG(Potential::theLogger,
+                   "loop over verlet list pairs and exclusions and sum up virial tensor");
+
+    Tensor wlocal(0.0);
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+        const Potential& potential = getPotential(p1.type(), p2.type());
+
+        Real3D dist = p1.position() - p2.position();
+        real distSqr = dist.sqr();
+        real ffactor = potential._computePairForceFactor(distSqr, p1.q() * p2.q());
+        wlocal += Tensor(dist, dist * ffactor);
+    }
+
+    forExclusions(
+        [&wlocal](Particle&, Particle&, const Potential& potential, const Real3D& dist, real qq)
+        {
+            real ffactor = potential._computeExclusionForceFactor(dist.sqr(), qq);
+            wlocal += Tensor(dist, dist * ffactor);
+        });
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void LennardJonesCoulombRSpace::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<LennardJonesCoulombRSpace, bases<Potential> >(
+        "interaction_LennardJonesCoulombRSpace", init<>())
+        .def(init<real, real, real, real, real, real>())
+        .def(init<real, real, real, real, real, real, real>())
+        .add_property("epsilon", &LennardJonesCoulombRSpace::getEpsilon,
+                      &LennardJonesCoulombRSpace::setEpsilon)
+        .add_property("sigma", &LennardJonesCoulombRSpace::getSigma,
+                      &LennardJonesCoulombRSpace::setSigma)
+        .add_property("prefactor", &LennardJonesCoulombRSpace::getPrefactor,
+                      &LennardJonesCoulombRSpace::setPrefactor)
+        .add_property("alpha", &LennardJonesCoulombRSpace::getAlpha,
+                      &LennardJonesCoulombRSpace::setAlpha)
+        .add_property("epsilonRF", &LennardJonesCoulombRSpace::getEpsilonRF,
+                      &LennardJonesCoulombRSpace::setEpsilonRF);
+
+    VerletListLennardJonesCoulombRSpace::registerPython();
+}
+
+void VerletListLennardJonesCoulombRSpace::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<VerletListLennardJonesCoulombRSpace, bases<Interaction> >(
+        "interaction_VerletListLennardJonesCoulombRSpace", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLennardJonesCoulombRSpace::getVerletList)
+        .def("setPotential", &VerletListLennardJonesCoulombRSpace::setPotential)
+        .def("getPotential", &VerletListLennardJonesCoulombRSpace::getPotentialPtr);
+}
+
+}  // namespace interaction
+}  // namespace espressopp
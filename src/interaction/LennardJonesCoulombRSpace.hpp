@@ -0,0 +1,357 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTERACTION_LENNARDJONESCOULOMBRSPACE_HPP
+#define _INTERACTION_LENNARDJONESCOULOMBRSPACE_HPP
+
+#include <cmath>
+#include <sstream>
+
+#include "Potential.hpp"
+#include "VerletListInteractionTemplate.hpp"
+#include "esutil/Error.hpp"
+
+#ifndef M_2_SQRTPIl
+#define M_2_SQRTPIl 1.1283791670955125738961589031215452L
+#endif
+
+namespace espressopp
+{
+namespace interaction
+{
+/** This class provides methods to compute forces and energies of the
+    Lennard-Jones potential together with the real-space Coulomb part in
+    one pair evaluation.
+
+    \f[ V(r) = 4 \varepsilon \left[ \left( \frac{\sigma}{r} \right)^{12} -
+    \left( \frac{\sigma}{r} \right)^{6} \right] - V_{shift} + P q_1 q_2
+    \left[ \frac{\mathrm{erfc}(\alpha r)}{r} + k_{rf} r^2 - c_{rf} \right]
+    \f]
+
+    alpha > 0 gives the real-space Ewald/P3M part, where erfc is evaluated
+    with the Abramowitz-Stegun approximation 7.1.26 (error below 1.5e-7).
+    epsilonRF > 0 adds a reaction field with that dielectric constant
+    beyond the cutoff. The shift only applies to the Lennard-Jones part.
+    Without particles the Coulomb part is evaluated for unit charges.
+*/
+class LennardJonesCoulombRSpace : public PotentialTemplate<LennardJonesCoulombRSpace>
+{
+private:
+    real epsilon;
+    real sigma;
+    real prefactor;
+    real alpha;
+    real epsilonRF;
+    real ff1, ff2;
+    real ef1, ef2;
+    real factor, alpha2;  // 2 alpha / sqrt(pi), alpha^2
+    real krf, crf;
+
+    // erfc(x) from exp(-x^2)
+    static real fastErfc(real x, real expmx2)
+    {
+        real t = 1.0 / (1.0 + 0.3275911 * x);
+        return t *
+               (0.254829592 +
+                t * (-0.284496736 + t * (1.421413741 + t * (-1.453152027 + t * 1.061405429)))) *
+               expmx2;
+    }
+
+public:
+    static void registerPython();
+
+    LennardJonesCoulombRSpace()
+        : epsilon(0.0), sigma(0.0), prefactor(0.0), alpha(0.0), epsilonRF(0.0)
+    {
+        setShift(0.0);
+        setCutoff(infinity);
+        preset();
+    }
+
+    LennardJonesCoulombRSpace(real _epsilon,
+                              real _sigma,
+                              real _prefactor,
+                              real _alpha,
+                              real _epsilonRF,
+                              real _cutoff,
+                              real _shift)
+        : epsilon(_epsilon),
+          sigma(_sigma),
+          prefactor(_prefactor),
+          alpha(_alpha),
+          epsilonRF(_epsilonRF)
+    {
+        setShift(_shift);
+        setCutoff(_cutoff);
+        preset();
+    }
+
+    LennardJonesCoulombRSpace(
+        real _epsilon, real _sigma, real _prefactor, real _alpha, real _epsilonRF, real _cutoff)
+        : epsilon(_epsilon),
+          sigma(_sigma),
+          prefactor(_prefactor),
+          alpha(_alpha),
+          epsilonRF(_epsilonRF)
+    {
+        autoShift = false;
+        setCutoff(_cutoff);
+        preset();
+        setAutoShift();
+    }
+
+    virtual ~LennardJonesCoulombRSpace(){};
+
+    void preset()
+    {
+        real sig2 = sigma * sigma;
+        real sig6 = sig2 * sig2 * sig2;
+        ff1 = 48.0 * epsilon * sig6 * sig6;
+        ff2 = 24.0 * epsilon * sig6;
+        ef1 = 4.0 * epsilon * sig6 * sig6;
+        ef2 = 4.0 * epsilon * sig6;
+        factor = alpha * M_2_SQRTPIl;
+        alpha2 = alpha * alpha;
+        if (epsilonRF > 0.0 && cutoff != infinity)
+        {
+            real rc3 = cutoff * cutoff * cutoff;
+            krf = (epsilonRF - 1.0) / ((2.0 * epsilonRF + 1.0) * rc3);
+            crf = 1.0 / cutoff + krf * cutoffSqr;
+        }
+        else
+        {
+            krf = 0.0;
+            crf = 0.0;
+        }
+    }
+
+    // Setter and getter
+    void setEpsilon(real _epsilon)
+    {
+        epsilon = _epsilon;
+        preset();
+        updateAutoShift();
+    }
+    real getEpsilon() const { return epsilon; }
+
+    void setSigma(real _sigma)
+    {
+        sigma = _sigma;
+        preset();
+        updateAutoShift();
+    }
+    real getSigma() const { return sigma; }
+
+    void setPrefactor(real _prefactor)
+    {
+        prefactor = _prefactor;
+        preset();
+    }
+    real getPrefactor() const { return prefactor; }
+
+    void setAlpha(real _alpha)
+    {
+        alpha = _alpha;
+        preset();
+    }
+    real getAlpha() const { return alpha; }
+
+    void setEpsilonRF(real _epsilonRF)
+    {
+        epsilonRF = _epsilonRF;
+        preset();
+    }
+    real getEpsilonRF() const { return epsilonRF; }
+
+    void setCutoff(real _cutoff)
+    {
+        PotentialTemplate<LennardJonesCoulombRSpace>::setCutoff(_cutoff);
+        preset();
+    }
+
+    // the shift is the one of the Lennard-Jones part, the Coulomb part depends on the charges
+    real setAutoShift()
+    {
+        autoShift = true;
+        if (cutoffSqr == infinity)
+            shift = 0.0;
+        else
+        {
+            real frac2 = sigma * sigma / cutoffSqr;
+            real frac6 = frac2 * frac2 * frac2;
+            shift = 4.0 * epsilon * (frac6 * frac6 - frac6);
+        }
+        return shift;
+    }
+
+    /** energy of a pair with charge product qq, zero beyond the cutoff */
+    real _computePairEnergy(real distSqr, real qq) const
+    {
+        if (distSqr > cutoffSqr) return 0.0;
+
+        real frac2 = 1.0 / distSqr;
+        real frac6 = frac2 * frac2 * frac2;
+        real energy = frac6 * (ef1 * frac6 - ef2) - shift;
+        if (qq != 0.0)
+        {
+            real r = std::sqrt(distSqr);
+            real erfcr = 1.0;
+            if (alpha > 0.0) erfcr = fastErfc(alpha * r, std::exp(-alpha2 * distSqr));
+            energy += prefactor * qq * (erfcr / r + krf * distSqr - crf);
+        }
+        return energy;
+    }
+
+    /** force divided by distance of a pair with charge product qq, zero beyond the cutoff */
+    real _computePairForceFactor(real distSqr, real qq) const
+    {
+        if (distSqr > cutoffSqr) return 0.0;
+
+        real frac2 = 1.0 / distSqr;
+        real frac6 = frac2 * frac2 * frac2;
+        real ffactor = frac6 * (ff1 * frac6 - ff2) * frac2;
+        if (qq != 0.0)
+        {
+            real r = std::sqrt(distSqr);
+            real coulomb = 1.0 / r;
+            if (alpha > 0.0)
+            {
+                real expar2 = std::exp(-alpha2 * distSqr);
+                coulomb = fastErfc(alpha * r, expar2) / r + factor * expar2;
+            }
+            ffactor += prefactor * qq * (coulomb * frac2 - 2.0 * krf);
+        }
+        return ffactor;
+    }
+
+    /** Ewald correction for an excluded pair: removes the erf(alpha r)/r interaction
+        that the k-space part includes for it */
+    real _computeExclusionEnergy(real distSqr, real qq) const
+    {
+        if (alpha <= 0.0) return 0.0;
+        real r = std::sqrt(distSqr);
+        real erfr = 1.0 - fastErfc(alpha * r, std::exp(-alpha2 * distSqr));
+        return -prefactor * qq * erfr / r;
+    }
+
+    real _computeExclusionForceFactor(real distSqr, real qq) const
+    {
+        if (alpha <= 0.0) return 0.0;
+        real r = std::sqrt(distSqr);
+        real expar2 = std::exp(-alpha2 * distSqr);
+        real erfr = 1.0 - fastErfc(alpha * r, expar2);
+        return prefactor * qq * (factor * expar2 - erfr / r) / distSqr;
+    }
+
+    using PotentialTemplate<LennardJonesCoulombRSpace>::_computeEnergy;
+    using PotentialTemplate<LennardJonesCoulombRSpace>::_computeForce;
+
+    real _computeEnergy(const Particle& p1, const Particle& p2) const
+    {
+        Real3D dist = p1.position() - p2.position();
+        return _computePairEnergy(dist.sqr(), p1.q() * p2.q());
+    }
+
+    bool _computeForce(Real3D& force, const Particle& p1, const Particle& p2) const
+    {
+        Real3D dist = p1.position() - p2.position();
+        real distSqr = dist.sqr();
+        if (distSqr > cutoffSqr) return false;
+        force = dist * _computePairForceFactor(distSqr, p1.q() * p2.q());
+        return true;
+    }
+
+    real _computeEnergySqrRaw(real distSqr) const
+    {
+        return _computePairEnergy(distSqr, 1.0) + shift;
+    }
+
+    bool _computeForceRaw(Real3D& force, const Real3D& dist, real distSqr) const
+    {
+        force = dist * _computePairForceFactor(distSqr, 1.0);
+        return true;
+    }
+};
+
+/** Verlet list interaction of LennardJonesCoulombRSpace that also applies
+    the Ewald correction to the pairs excluded from the Verlet list, so
+    intramolecular exclusions need no separate interaction. Each excluded
+    pair is taken on the node that owns its first particle, so the second
+    one has to be within the ghost layer; otherwise an error is raised.
+*/
+class VerletListLennardJonesCoulombRSpace
+    : public VerletListInteractionTemplate<LennardJonesCoulombRSpace>
+{
+public:
+    VerletListLennardJonesCoulombRSpace(std::shared_ptr<VerletList> _verletList)
+        : VerletListInteractionTemplate<LennardJonesCoulombRSpace>(_verletList)
+    {
+    }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+
+    static void registerPython();
+
+private:
+    template <typename Visitor>
+    void forExclusions(Visitor visit);
+};
+
+template <typename Visitor>
+inline void VerletListLennardJonesCoulombRSpace::forExclusions(Visitor visit)
+{
+    System& system = verletList->getSystemRef();
+    esutil::Error err(system.comm);
+    const auto& exList = verletList->getExcludeList();
+    for (const auto& ex : exList)
+    {
+        // exclusions may be listed in both orders
+        if (ex.first > ex.second && exList.count(std::make_pair(ex.second, ex.first)) == 1)
+            continue;
+        Particle* p1 = system.storage->lookupRealParticle(ex.first);
+        if (!p1) continue;
+        Particle* p2 = system.storage->lookupLocalParticle(ex.second);
+        if (!p2)
+        {
+            std::stringstream msg;
+            msg << "VerletListLennardJonesCoulombRSpace: excluded particle " << ex.second
+                << " of particle " << ex.first
+                << " does not exist here, it is farther away than the ghost layer";
+            err.setException(msg.str());
+            continue;
+        }
+        real qq = p1->q() * p2->q();
+        if (qq == 0.0) continue;
+
+        Real3D dist;
+        system.bc->getMinimumImageVectorBox(dist, p1->position(), p2->position());
+        visit(*p1, *p2, potentialArray(p1->type(), p2->type()), dist, qq);
+    }
+    err.checkException();
+}
+
+}  // namespace interaction
+}  // namespace espressopp
+
+#endif
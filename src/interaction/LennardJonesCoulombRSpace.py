@@ -0,0 +1,138 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+************************************************
+espressopp.interaction.LennardJonesCoulombRSpace
+************************************************
+
+Lennard-Jones and real-space Coulomb interaction evaluated in one pass
+over the Verlet list.
+
+.. math::
+
+        V(r) = 4 \varepsilon \left[ \left( \frac{\sigma}{r} \right)^{12} -
+        \left( \frac{\sigma}{r} \right)^{6} \right] - V_{shift} + P q_1 q_2
+        \left[ \frac{\mathrm{erfc}(\alpha r)}{r} + k_{rf} r^2 - c_{rf} \right]
+
+With alpha > 0 the Coulomb part is the real-space part of Ewald or P3M,
+with alpha = 0 it is the plain Coulomb interaction. With epsilonRF > 0 a
+reaction field with dielectric constant epsilonRF is added beyond the
+cutoff, :math:`k_{rf} = (\varepsilon_{rf} - 1) / ((2 \varepsilon_{rf} + 1) r_c^3)`
+and :math:`c_{rf} = 1/r_c + k_{rf} r_c^2`. The shift only applies to the
+Lennard-Jones part.
+
+The Verlet list interaction also handles the pairs excluded from the Verlet
+list: for alpha > 0 it subtracts their :math:`\mathrm{erf}(\alpha r)/r` interaction,
+which the k-space part includes.
+
+.. function:: espressopp.interaction.LennardJonesCoulombRSpace(epsilon, sigma, prefactor, alpha, epsilonRF, cutoff, shift)
+
+        :param epsilon: (default: 1.0)
+        :param sigma: (default: 1.0)
+        :param prefactor: (default: 1.0)
+        :param alpha: Ewald splitting parameter (default: 0.0)
+        :param epsilonRF: reaction field dielectric constant, 0 disables it (default: 0.0)
+        :param cutoff: (default: infinity)
+        :param shift: (default: "auto")
+        :type epsilon: real
+        :type sigma: real
+        :type prefactor: real
+        :type alpha: real
+        :type epsilonRF: real
+        :type cutoff: real
+        :type shift: real or "auto"
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace(vl)
+
+        :param vl: Verletlist object
+        :type vl: std::shared_ptr<VerletList>
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace.getPotential(type1, type2)
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :type type1: int
+        :type type2: int
+        :rtype: std::shared_ptr<LennardJonesCoulombRSpace>
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace.getVerletList()
+
+        :rtype: std::shared_ptr<VerletList>
+
+.. function:: espressopp.interaction.VerletListLennardJonesCoulombRSpace.setPotential(type1, type2, potential)
+
+        :param type1: particle type 1
+        :param type2: particle type 2
+        :param potential: LennardJonesCoulombRSpace potential object
+        :type type1: int
+        :type type2: int
+        :type potential: std::shared_ptr<LennardJonesCoulombRSpace>
+"""
+from espressopp import pmi, infinity
+from espressopp.esutil import *
+
+from espressopp.interaction.Potential import *
+from espressopp.interaction.Interaction import *
+from _espressopp import interaction_LennardJonesCoulombRSpace, \
+                      interaction_VerletListLennardJonesCoulombRSpace
+
+class LennardJonesCoulombRSpaceLocal(PotentialLocal, interaction_LennardJonesCoulombRSpace):
+
+    def __init__(self, epsilon=1.0, sigma=1.0, prefactor=1.0, alpha=0.0, epsilonRF=0.0,
+                 cutoff=infinity, shift="auto"):
+        """Initialize the local LennardJonesCoulombRSpace object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            if shift == "auto":
+                cxxinit(self, interaction_LennardJonesCoulombRSpace,
+                        epsilon, sigma, prefactor, alpha, epsilonRF, cutoff)
+            else:
+                cxxinit(self, interaction_LennardJonesCoulombRSpace,
+                        epsilon, sigma, prefactor, alpha, epsilonRF, cutoff, shift)
+
+class VerletListLennardJonesCoulombRSpaceLocal(InteractionLocal, interaction_VerletListLennardJonesCoulombRSpace):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListLennardJonesCoulombRSpace, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+if pmi.isController:
+    class LennardJonesCoulombRSpace(Potential):
+        'The Lennard-Jones and real-space Coulomb potential.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.LennardJonesCoulombRSpaceLocal',
+            pmiproperty = ['epsilon', 'sigma', 'prefactor', 'alpha', 'epsilonRF']
+            )
+
+    class VerletListLennardJonesCoulombRSpace(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListLennardJonesCoulombRSpaceLocal',
+            pmicall = ['setPotential', 'getPotential', 'getVerletList']
+            )
@@ -22,6 +22,7 @@
 
 #include "python.hpp"
 #include "LennardJonesGromacs.hpp"
+#include "AutoTabulated.hpp"
 #include "VerletListInteractionTemplate.hpp"
 #include "CellListAllPairsInteractionTemplate.hpp"
 #include "FixedPairListInteractionTemplate.hpp"
@@ -35,6 +36,9 @@ typedef class CellListAllPairsInteractionTemplate<LennardJonesGromacs> CellListL
 typedef class FixedPairListInteractionTemplate<LennardJonesGromacs>
     FixedPairListLennardJonesGromacs;
 
+typedef class AutoTabulated<LennardJonesGromacs> AutoTabulatedLennardJonesGromacs;
+typedef class VerletListInteractionTemplate<AutoTabulatedLennardJonesGromacs> VerletListAutoTabulatedLennardJonesGromacs;
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -68,6 +72,19 @@ void LennardJonesGromacs::registerPython()
              std::shared_ptr<LennardJonesGromacs> >())
         .def("setPotential", &FixedPairListLennardJonesGromacs::setPotential);
     ;
+
+    class_<AutoTabulatedLennardJonesGromacs, bases<Potential> >(
+        "interaction_AutoTabulatedLennardJonesGromacs",
+        init<const LennardJonesGromacs&, real, real>())
+        .add_property("rMin", &AutoTabulatedLennardJonesGromacs::getRMin)
+        .add_property("tolerance", &AutoTabulatedLennardJonesGromacs::getTolerance)
+        .add_property("maxError", &AutoTabulatedLennardJonesGromacs::getMaxError);
+
+    class_<VerletListAutoTabulatedLennardJonesGromacs, bases<Interaction> >(
+        "interaction_VerletListAutoTabulatedLennardJonesGromacs",
+        init<std::shared_ptr<VerletList> >())
+        .def("setPotential", &VerletListAutoTabulatedLennardJonesGromacs::setPotential)
+        .def("getPotential", &VerletListAutoTabulatedLennardJonesGromacs::getPotentialPtr);
 }
 }  // namespace interaction
 }  // namespace espressopp
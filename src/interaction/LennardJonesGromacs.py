@@ -104,6 +104,32 @@ else
 
                 :param potential:
                 :type potential:
+
+.. function:: espressopp.interaction.AutoTabulatedLennardJonesGromacs(potential, rMin, tolerance)
+
+                The LennardJonesGromacs potential tabulated from rMin to its cutoff within
+                tolerance; the deviation reached is in maxError.
+
+                :param potential:
+                :param rMin:
+                :param tolerance: (default: 1e-6)
+                :type potential: LennardJonesGromacs
+                :type rMin: real
+                :type tolerance: real
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedLennardJonesGromacs(vl)
+
+                :param vl:
+                :type vl:
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedLennardJonesGromacs.setPotential(type1, type2, potential)
+
+                :param type1:
+                :param type2:
+                :param potential:
+                :type type1:
+                :type type2:
+                :type potential:
 """
 
 
@@ -151,7 +177,9 @@ from espressopp.interaction.Interaction import *
 from _espressopp import interaction_LennardJonesGromacs, \
                       interaction_VerletListLennardJonesGromacs, \
                       interaction_CellListLennardJonesGromacs, \
-                      interaction_FixedPairListLennardJonesGromacs
+                      interaction_FixedPairListLennardJonesGromacs, \
+                      interaction_AutoTabulatedLennardJonesGromacs, \
+                      interaction_VerletListAutoTabulatedLennardJonesGromacs
 
 class LennardJonesGromacsLocal(PotentialLocal, interaction_LennardJonesGromacs):
 
@@ -200,6 +228,27 @@ class FixedPairListLennardJonesGromacsLocal(InteractionLocal, interaction_FixedP
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.setPotential(self, potential)
 
+class AutoTabulatedLennardJonesGromacsLocal(PotentialLocal, interaction_AutoTabulatedLennardJonesGromacs):
+
+    def __init__(self, potential, rMin, tolerance=1e-6):
+        """Initialize the local tabulated LennardJonesGromacs object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_AutoTabulatedLennardJonesGromacs, potential, rMin, tolerance)
+
+class VerletListAutoTabulatedLennardJonesGromacsLocal(InteractionLocal, interaction_VerletListAutoTabulatedLennardJonesGromacs):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListAutoTabulatedLennardJonesGromacs, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
 if pmi.isController:
     class LennardJonesGromacs(Potential):
         'The LennardJonesGromacs potential.'
@@ -223,3 +272,16 @@ if pmi.isController:
             cls =  'espressopp.interaction.FixedPairListLennardJonesGromacsLocal',
             pmicall = ['setPotential']
             )
+
+    class AutoTabulatedLennardJonesGromacs(Potential):
+        'The LennardJonesGromacs potential, tabulated.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.AutoTabulatedLennardJonesGromacsLocal',
+            pmiproperty = ['rMin', 'tolerance', 'maxError']
+            )
+
+    class VerletListAutoTabulatedLennardJonesGromacs(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListAutoTabulatedLennardJonesGromacsLocal',
+            pmicall = ['setPotential','getPotential']
+            )
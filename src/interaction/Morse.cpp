@@ -22,6 +22,7 @@
 
 #include "python.hpp"
 #include "Morse.hpp"
+#include "AutoTabulated.hpp"
 #include "Tabulated.hpp"
 #include "VerletListInteractionTemplate.hpp"
 #include "VerletListAdressInteractionTemplate.hpp"
@@ -39,6 +40,9 @@ typedef class VerletListHadressInteractionTemplate<Morse, Tabulated> VerletListH
 typedef class CellListAllPairsInteractionTemplate<Morse> CellListMorse;
 typedef class FixedPairListInteractionTemplate<Morse> FixedPairListMorse;
 
+typedef class AutoTabulated<Morse> AutoTabulatedMorse;
+typedef class VerletListInteractionTemplate<AutoTabulatedMorse> VerletListAutoTabulatedMorse;
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -84,6 +88,17 @@ void Morse::registerPython()
                   std::shared_ptr<Morse> >())
         .def("setPotential", &FixedPairListMorse::setPotential);
     ;
+
+    class_<AutoTabulatedMorse, bases<Potential> >("interaction_AutoTabulatedMorse",
+                                                  init<const Morse&, real, real>())
+        .add_property("rMin", &AutoTabulatedMorse::getRMin)
+        .add_property("tolerance", &AutoTabulatedMorse::getTolerance)
+        .add_property("maxError", &AutoTabulatedMorse::getMaxError);
+
+    class_<VerletListAutoTabulatedMorse, bases<Interaction> >(
+        "interaction_VerletListAutoTabulatedMorse", init<std::shared_ptr<VerletList> >())
+        .def("setPotential", &VerletListAutoTabulatedMorse::setPotential)
+        .def("getPotential", &VerletListAutoTabulatedMorse::getPotentialPtr);
 }
 
 }  // namespace interaction
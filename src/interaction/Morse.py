@@ -148,6 +148,32 @@ the Morse potential.
 
                 :param potential:
                 :type potential:
+
+.. function:: espressopp.interaction.AutoTabulatedMorse(potential, rMin, tolerance)
+
+                The Morse potential tabulated from rMin to its cutoff within
+                tolerance; the deviation reached is in maxError.
+
+                :param potential:
+                :param rMin:
+                :param tolerance: (default: 1e-6)
+                :type potential: Morse
+                :type rMin: real
+                :type tolerance: real
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedMorse(vl)
+
+                :param vl:
+                :type vl:
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedMorse.setPotential(type1, type2, potential)
+
+                :param type1:
+                :param type2:
+                :param potential:
+                :type type1:
+                :type type2:
+                :type potential:
 """
 from espressopp import pmi, infinity
 from espressopp.esutil import *
@@ -159,7 +185,9 @@ from _espressopp import interaction_Morse, \
                       interaction_VerletListAdressMorse, \
                       interaction_VerletListHadressMorse, \
                       interaction_CellListMorse, \
-                      interaction_FixedPairListMorse
+                      interaction_FixedPairListMorse, \
+                      interaction_AutoTabulatedMorse, \
+                      interaction_VerletListAutoTabulatedMorse
 
 class MorseLocal(PotentialLocal, interaction_Morse):
 
@@ -236,6 +264,27 @@ class FixedPairListMorseLocal(InteractionLocal, interaction_FixedPairListMorse):
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.setPotential(self, potential)
 
+class AutoTabulatedMorseLocal(PotentialLocal, interaction_AutoTabulatedMorse):
+
+    def __init__(self, potential, rMin, tolerance=1e-6):
+        """Initialize the local tabulated Morse object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_AutoTabulatedMorse, potential, rMin, tolerance)
+
+class VerletListAutoTabulatedMorseLocal(InteractionLocal, interaction_VerletListAutoTabulatedMorse):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListAutoTabulatedMorse, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
 if pmi.isController:
     class Morse(Potential):
         'The Morse potential.'
@@ -273,3 +322,16 @@ if pmi.isController:
             cls =  'espressopp.interaction.FixedPairListMorseLocal',
             pmicall = ['setPotential']
             )
+
+    class AutoTabulatedMorse(Potential):
+        'The Morse potential, tabulated.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.AutoTabulatedMorseLocal',
+            pmiproperty = ['rMin', 'tolerance', 'maxError']
+            )
+
+    class VerletListAutoTabulatedMorse(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListAutoTabulatedMorseLocal',
+            pmicall = ['setPotential','getPotential']
+            )
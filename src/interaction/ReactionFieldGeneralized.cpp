@@ -22,6 +22,7 @@
 
 #include "python.hpp"
 #include "ReactionFieldGeneralized.hpp"
+#include "AutoTabulated.hpp"
 #include "Tabulated.hpp"
 #include "VerletListInteractionTemplate.hpp"
 #include "VerletListAdressInteractionTemplate.hpp"
@@ -56,6 +57,9 @@ typedef class CellListAllPairsInteractionTemplate<ReactionFieldGeneralized>
 /*typedef class FixedPairListInteractionTemplate<ReactionFieldGeneralized>
     FixedPairListReactionFieldGeneralized;*/
 
+typedef class AutoTabulated<ReactionFieldGeneralized> AutoTabulatedReactionFieldGeneralized;
+typedef class VerletListInteractionTemplate<AutoTabulatedReactionFieldGeneralized> VerletListAutoTabulatedReactionFieldGeneralized;
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -113,6 +117,19 @@ void ReactionFieldGeneralized::registerPython()
       std::shared_ptr<ReactionFieldGeneralized> >()) .def("setPotential",
       &FixedPairListReactionFieldGeneralized::setPotential);
         ;*/
+
+    class_<AutoTabulatedReactionFieldGeneralized, bases<Potential> >(
+        "interaction_AutoTabulatedReactionFieldGeneralized",
+        init<const ReactionFieldGeneralized&, real, real>())
+        .add_property("rMin", &AutoTabulatedReactionFieldGeneralized::getRMin)
+        .add_property("tolerance", &AutoTabulatedReactionFieldGeneralized::getTolerance)
+        .add_property("maxError", &AutoTabulatedReactionFieldGeneralized::getMaxError);
+
+    class_<VerletListAutoTabulatedReactionFieldGeneralized, bases<Interaction> >(
+        "interaction_VerletListAutoTabulatedReactionFieldGeneralized",
+        init<std::shared_ptr<VerletList> >())
+        .def("setPotential", &VerletListAutoTabulatedReactionFieldGeneralized::setPotential)
+        .def("getPotential", &VerletListAutoTabulatedReactionFieldGeneralized::getPotentialPtr);
 }
 }  // namespace interaction
 }  // namespace espressopp
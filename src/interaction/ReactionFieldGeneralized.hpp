@@ -182,19 +182,18 @@ public:
         }*/
     }
 
+    // charge independent part, for unit charges
     real _computeEnergySqrRaw(real distSqr) const
     {
-        cout << "_computeEnergySqrRaw not possible for reaction field, no particle information"
-             << endl;
-        exit(0);
-        return 0;
+        if (distSqr > rc2) return 0.0;
+        return prefactor * (1.0 / sqrt(distSqr) - B1_half * distSqr - crf);
     }
     bool _computeForceRaw(Real3D& force, const Real3D& dist, real distSqr) const
     {
-        cout << "_computeEnergySqrRaw not possible for reaction field, no particle information"
-             << endl;
-        exit(0);
-        return false;
+        if (distSqr > rc2) return false;
+        real ffactor = prefactor * (1.0 / (sqrt(distSqr) * distSqr) + B1);
+        force = dist * ffactor;
+        return true;
     }
     /*bool _computeForceRaw(Real3D& force,
             const Real3D& dist, real distSqr) const {
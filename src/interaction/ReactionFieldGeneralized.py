@@ -222,6 +222,32 @@ where `P` is a prefactor, `Q` is the product of the charges of the two particles
         :type type1: int
         :type type2: int
         :type potential: std::shared_ptr<ReactionFieldGeneralized>
+
+.. function:: espressopp.interaction.AutoTabulatedReactionFieldGeneralized(potential, rMin, tolerance)
+
+                The ReactionFieldGeneralized potential tabulated from rMin to its cutoff within
+                tolerance; the deviation reached is in maxError.
+
+                :param potential:
+                :param rMin:
+                :param tolerance: (default: 1e-6)
+                :type potential: ReactionFieldGeneralized
+                :type rMin: real
+                :type tolerance: real
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedReactionFieldGeneralized(vl)
+
+                :param vl:
+                :type vl:
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedReactionFieldGeneralized.setPotential(type1, type2, potential)
+
+                :param type1:
+                :param type2:
+                :param potential:
+                :type type1:
+                :type type2:
+                :type potential:
 """
 from espressopp import pmi, infinity
 from espressopp.esutil import *
@@ -234,7 +260,9 @@ from _espressopp import interaction_ReactionFieldGeneralized, \
                       interaction_VerletListAdressATReactionFieldGeneralized, \
                       interaction_VerletListHadressReactionFieldGeneralized, \
                       interaction_VerletListHadressATReactionFieldGeneralized, \
-                      interaction_CellListReactionFieldGeneralized
+                      interaction_CellListReactionFieldGeneralized, \
+                      interaction_AutoTabulatedReactionFieldGeneralized, \
+                      interaction_VerletListAutoTabulatedReactionFieldGeneralized
                       #interaction_FixedPairListReactionFieldGeneralized
 
 class ReactionFieldGeneralizedLocal(PotentialLocal, interaction_ReactionFieldGeneralized):
@@ -340,6 +368,27 @@ class CellListReactionFieldGeneralizedLocal(InteractionLocal, interaction_CellLi
 #        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
 #            self.cxxclass.setPotential(self, potential)
 
+class AutoTabulatedReactionFieldGeneralizedLocal(PotentialLocal, interaction_AutoTabulatedReactionFieldGeneralized):
+
+    def __init__(self, potential, rMin, tolerance=1e-6):
+        """Initialize the local tabulated ReactionFieldGeneralized object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_AutoTabulatedReactionFieldGeneralized, potential, rMin, tolerance)
+
+class VerletListAutoTabulatedReactionFieldGeneralizedLocal(InteractionLocal, interaction_VerletListAutoTabulatedReactionFieldGeneralized):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListAutoTabulatedReactionFieldGeneralized, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
 if pmi.isController:
     class ReactionFieldGeneralized(Potential):
         'The ReactionFieldGeneralized potential.'
@@ -390,3 +439,16 @@ if pmi.isController:
     #        cls =  'espressopp.interaction.FixedPairListReactionFieldGeneralizedLocal',
     #        pmicall = ['setPotential']
     #        )
+
+    class AutoTabulatedReactionFieldGeneralized(Potential):
+        'The ReactionFieldGeneralized potential, tabulated.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.AutoTabulatedReactionFieldGeneralizedLocal',
+            pmiproperty = ['rMin', 'tolerance', 'maxError']
+            )
+
+    class VerletListAutoTabulatedReactionFieldGeneralized(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListAutoTabulatedReactionFieldGeneralizedLocal',
+            pmicall = ['setPotential','getPotential']
+            )
@@ -22,6 +22,7 @@
 
 #include "python.hpp"
 #include "SoftCosine.hpp"
+#include "AutoTabulated.hpp"
 #include "VerletListInteractionTemplate.hpp"
 #include "CellListAllPairsInteractionTemplate.hpp"
 #include "FixedPairListInteractionTemplate.hpp"
@@ -34,6 +35,9 @@ typedef class VerletListInteractionTemplate<SoftCosine> VerletListSoftCosine;
 typedef class CellListAllPairsInteractionTemplate<SoftCosine> CellListSoftCosine;
 typedef class FixedPairListInteractionTemplate<SoftCosine> FixedPairListSoftCosine;
 
+typedef class AutoTabulated<SoftCosine> AutoTabulatedSoftCosine;
+typedef class VerletListInteractionTemplate<AutoTabulatedSoftCosine> VerletListAutoTabulatedSoftCosine;
+
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
@@ -66,6 +70,17 @@ void SoftCosine::registerPython()
                   std::shared_ptr<SoftCosine> >())
         .def("setPotential", &FixedPairListSoftCosine::setPotential);
     ;
+
+    class_<AutoTabulatedSoftCosine, bases<Potential> >("interaction_AutoTabulatedSoftCosine",
+                                                       init<const SoftCosine&, real, real>())
+        .add_property("rMin", &AutoTabulatedSoftCosine::getRMin)
+        .add_property("tolerance", &AutoTabulatedSoftCosine::getTolerance)
+        .add_property("maxError", &AutoTabulatedSoftCosine::getMaxError);
+
+    class_<VerletListAutoTabulatedSoftCosine, bases<Interaction> >(
+        "interaction_VerletListAutoTabulatedSoftCosine", init<std::shared_ptr<VerletList> >())
+        .def("setPotential", &VerletListAutoTabulatedSoftCosine::setPotential)
+        .def("getPotential", &VerletListAutoTabulatedSoftCosine::getPotentialPtr);
 }
 
 }  // namespace interaction
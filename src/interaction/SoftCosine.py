@@ -81,6 +81,32 @@ This class provides methods to compute forces and energies ofthe SoftCosine pote
 
                 :param potential:
                 :type potential:
+
+.. function:: espressopp.interaction.AutoTabulatedSoftCosine(potential, rMin, tolerance)
+
+                The SoftCosine potential tabulated from rMin to its cutoff within
+                tolerance; the deviation reached is in maxError.
+
+                :param potential:
+                :param rMin:
+                :param tolerance: (default: 1e-6)
+                :type potential: SoftCosine
+                :type rMin: real
+                :type tolerance: real
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedSoftCosine(vl)
+
+                :param vl:
+                :type vl:
+
+.. function:: espressopp.interaction.VerletListAutoTabulatedSoftCosine.setPotential(type1, type2, potential)
+
+                :param type1:
+                :param type2:
+                :param potential:
+                :type type1:
+                :type type2:
+                :type potential:
 """
 from espressopp import pmi, infinity
 from espressopp.esutil import *
@@ -90,7 +116,9 @@ from espressopp.interaction.Interaction import *
 from _espressopp import interaction_SoftCosine, \
                       interaction_VerletListSoftCosine, \
                       interaction_CellListSoftCosine, \
-                      interaction_FixedPairListSoftCosine
+                      interaction_FixedPairListSoftCosine, \
+                      interaction_AutoTabulatedSoftCosine, \
+                      interaction_VerletListAutoTabulatedSoftCosine
 
 class SoftCosineLocal(PotentialLocal, interaction_SoftCosine):
 
@@ -146,6 +174,27 @@ class FixedPairListSoftCosineLocal(InteractionLocal, interaction_FixedPairListSo
         if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
             self.cxxclass.setPotential(self, potential)
 
+class AutoTabulatedSoftCosineLocal(PotentialLocal, interaction_AutoTabulatedSoftCosine):
+
+    def __init__(self, potential, rMin, tolerance=1e-6):
+        """Initialize the local tabulated SoftCosine object."""
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_AutoTabulatedSoftCosine, potential, rMin, tolerance)
+
+class VerletListAutoTabulatedSoftCosineLocal(InteractionLocal, interaction_VerletListAutoTabulatedSoftCosine):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, interaction_VerletListAutoTabulatedSoftCosine, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
 if pmi.isController:
     class SoftCosine(Potential):
         'The SoftCosine potential.'
@@ -168,3 +217,16 @@ if pmi.isController:
             cls =  'espressopp.interaction.FixedPairListSoftCosineLocal',
             pmicall = ['setPotential']
             )
+
+    class AutoTabulatedSoftCosine(Potential):
+        'The SoftCosine potential, tabulated.'
+        pmiproxydefs = dict(
+            cls = 'espressopp.interaction.AutoTabulatedSoftCosineLocal',
+            pmiproperty = ['rMin', 'tolerance', 'maxError']
+            )
+
+    class VerletListAutoTabulatedSoftCosine(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.interaction.VerletListAutoTabulatedSoftCosineLocal',
+            pmicall = ['setPotential','getPotential']
+            )
@@ -68,6 +68,12 @@ void Tabulated::setFilename(int itype, const char* _filename)
         table = std::make_shared<InterpolationCubic>();
         table->read(world, _filename);
     }
+
+    if (table)
+    {
+        tableR2 = std::make_shared<InterpolationR2>();
+        tableR2->build(*table);
+    }
 }
 
 typedef class VerletListInteractionTemplate<Tabulated> VerletListTabulated;
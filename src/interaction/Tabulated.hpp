@@ -27,6 +27,7 @@
 // #include <stdexcept>
 #include "Potential.hpp"
 #include "Interpolation.hpp"
+#include "InterpolationR2.hpp"
 
 namespace espressopp
 {
@@ -45,6 +46,7 @@ class Tabulated : public PotentialTemplate<Tabulated>
 private:
     std::string filename;
     std::shared_ptr<Interpolation> table;
+    std::shared_ptr<InterpolationR2> tableR2;  // same table on an r^2 grid, used in range
     int interpolationType;
 
 public:
@@ -93,7 +95,10 @@ public:
     {
         // make an interpolation
         if (interpolationType != 0)
+        {
+            if (tableR2->inRange(distSqr)) return tableR2->getEnergy(distSqr);
             return table->getEnergy(sqrt(distSqr));
+        }
         else
             return 0;
         /*else {
@@ -105,7 +110,11 @@ public:
     bool _computeForceRaw(Real3D& force, const Real3D& dist, real distSqr) const
     {
         real ffactor;
-        if (interpolationType != 0)
+        if (interpolationType != 0 && tableR2->inRange(distSqr))
+        {
+            ffactor = tableR2->getForceFactor(distSqr);
+        }
+        else if (interpolationType != 0)
         {
             real distrt = sqrt(distSqr);
             ffactor = table->getForce(distrt);
@@ -163,7 +163,7 @@ inline void
 VerletListAdressATATCGInteractionTemplate<_PotentialAT1, _PotentialAT2, _PotentialCG>::addForces()
 {
     LOG4ESPP_INFO(theLogger, "add forces computed by the Verlet List");
-    std::set<Particle*> cgZone = verletList->getCGZone();
+    std::vector<Particle*>& cgZone = verletList->getCGZone();
 
     // Pairs not inside the AdResS Zone (CG region)
     for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
@@ -185,8 +185,6 @@ VerletListAdressATATCGInteractionTemplate<_PotentialAT1, _PotentialAT2, _Potenti
         }
     }
 
-    std::set<Particle*> adrZone = verletList->getAdrZone();
-
     // Compute forces (AT and VP) of Pairs inside AdResS zone
     for (PairList::Iterator it(verletList->getAdrPairs()); it.isValid(); ++it)
     {
@@ -278,7 +276,7 @@ VerletListAdressATATCGInteractionTemplate<_PotentialAT1, _PotentialAT2, _Potenti
     // calculate CG forces/velocities and distribute them to AT particles. In contrast, in H-AdResS,
     // we calculate AT forces from intra-molecular interactions and inter-molecular center-of-mass
     // interactions and just update the positions of the center-of-mass CG particles.
-    for (std::set<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
+    for (std::vector<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
     {
         Particle& vp = **it;
 
@@ -312,15 +310,15 @@ template <typename _PotentialAT1, typename _PotentialAT2, typename _PotentialCG>
 inline real VerletListAdressATATCGInteractionTemplate<_PotentialAT1, _PotentialAT2, _PotentialCG>::
     computeEnergy()
 {
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    for (std::set<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
+    std::vector<Particle*>& cgZone = verletList->getCGZone();
+    for (std::vector<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
     {
         Particle& vp = **it;
         vp.lambda() = 0.0;
     }
 
-    std::set<Particle*> adrZone = verletList->getAdrZone();
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    std::vector<Particle*>& adrZone = verletList->getAdrZone();
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {
         Particle& vp = **it;
 
@@ -144,8 +144,8 @@ template <typename _PotentialAT, typename _PotentialCG>
 inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::addForces()
 {
     LOG4ESPP_INFO(theLogger, "add forces computed by the Verlet List");
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    /*for (std::set<Particle*>::iterator it=cgZone.begin();
+    std::vector<Particle*>& cgZone = verletList->getCGZone();
+    /*for (std::vector<Particle*>::iterator it=cgZone.begin();
             it != cgZone.end(); ++it) {
 
         Particle &vp = **it;
@@ -224,8 +224,8 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::add
     // Here we calculate CG forces/velocities and distribute them to AT particles. In contrast, in
     H-AdResS, we calculate AT forces from intra-molecular
     // interactions and inter-molecular center-of-mass interactions and just update the positions of
-    the center-of-mass CG particles. std::set<Particle*> cgZone = verletList->getCGZone(); for
-    (std::set<Particle*>::iterator it=cgZone.begin(); it != cgZone.end(); ++it) {
+    the center-of-mass CG particles. std::vector<Particle*> cgZone = verletList->getCGZone(); for
+    (std::vector<Particle*>::iterator it=cgZone.begin(); it != cgZone.end(); ++it) {
 
           Particle &vp = **it;
 
@@ -256,8 +256,8 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::add
     // Compute center of mass and weights for virtual particles in Adress and CG zone (HY and AT and
     // CG region).
 
-    /*std::set<Particle*> cgZone = verletList->getCGZone();
-    for (std::set<Particle*>::iterator it=cgZone.begin();
+    /*std::vector<Particle*> cgZone = verletList->getCGZone();
+    for (std::vector<Particle*>::iterator it=cgZone.begin();
         it != cgZone.end(); ++it) {
 
     Particle &vp = **it;
@@ -265,8 +265,7 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::add
     //weights.insert(std::make_pair(&vp, 0.0));
     }*/
 
-    std::set<Particle*> adrZone = verletList->getAdrZone();
-    /*for (std::set<Particle*>::iterator it=adrZone.begin();
+    /*for (std::vector<Particle*>::iterator it=adrZone.begin();
             it != adrZone.end(); ++it) {
 
         Particle &vp = **it;
@@ -447,8 +446,8 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::add
     // calculate CG forces/velocities and distribute them to AT particles. In contrast, in H-AdResS,
     // we calculate AT forces from intra-molecular interactions and inter-molecular center-of-mass
     // interactions and just update the positions of the center-of-mass CG particles.
-    // std::set<Particle*> cgZone = verletList->getCGZone();
-    for (std::set<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
+    // std::vector<Particle*> cgZone = verletList->getCGZone();
+    for (std::vector<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
     {
         Particle& vp = **it;
 
@@ -479,7 +478,7 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::add
     }
 
     // distribute forces from VP to AT (HY and AT region)
-    /*for (std::set<Particle*>::iterator it=adrZone.begin();
+    /*for (std::vector<Particle*>::iterator it=adrZone.begin();
               it != adrZone.end(); ++it) {
 
       Particle &vp = **it;
@@ -512,16 +511,16 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::add
 template <typename _PotentialAT, typename _PotentialCG>
 inline real VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::computeEnergy()
 {
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    for (std::set<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
+    std::vector<Particle*>& cgZone = verletList->getCGZone();
+    for (std::vector<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
     {
         Particle& vp = **it;
         vp.lambda() = 0.0;
         // weights.insert(std::make_pair(&vp, 0.0));
     }
 
-    std::set<Particle*> adrZone = verletList->getAdrZone();
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    std::vector<Particle*>& adrZone = verletList->getAdrZone();
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {
         Particle& vp = **it;
 
@@ -794,16 +793,16 @@ inline void VerletListAdressInteractionTemplate<_PotentialAT, _PotentialCG>::com
     // does not work." << std::endl << "Therefore, the corresponding interactions won't be included
     // in calculation." << std::endl;
 
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    for (std::set<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
+    std::vector<Particle*>& cgZone = verletList->getCGZone();
+    for (std::vector<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
     {
         Particle& vp = **it;
         vp.lambda() = 0.0;
         // weights.insert(std::make_pair(&vp, 0.0));
     }
 
-    std::set<Particle*> adrZone = verletList->getAdrZone();
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    std::vector<Particle*>& adrZone = verletList->getAdrZone();
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {
         Particle& vp = **it;
 
@@ -135,8 +135,6 @@ protected:
     boost::unordered_map<Particle*, real>
         energydiff;  // Energydifference V_AA - V_CG map for particles in hybrid region for drift
                      // term calculation in H-AdResS
-    std::set<Particle*> adrZone;  // Virtual particles in AdResS zone (HY and AT region)
-    std::set<Particle*> cgZone;
 };
 
 //////////////////////////////////////////////////
@@ -147,10 +145,9 @@ inline void VerletListHadressATATInteractionTemplate<_Potential1, _Potential2>::
 {
     LOG4ESPP_INFO(theLogger, "add forces computed by the Verlet List");
 
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    std::set<Particle*> adrZone = verletList->getAdrZone();
+    std::vector<Particle*>& adrZone = verletList->getAdrZone();
 
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {
         Particle& p = **it;
         // intitialize energy diff AA-CG
@@ -269,7 +266,7 @@ inline void VerletListHadressATATInteractionTemplate<_Potential1, _Potential2>::
 
     // H-AdResS - Drift Term part 3
     // Iterate over all particles in the hybrid region and calculate drift force
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {  // Iterate over all particles
         Particle& vp = **it;
         real w = vp.lambda();
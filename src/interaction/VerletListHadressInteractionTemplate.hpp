@@ -135,8 +135,6 @@ protected:
     real dex2;                             // dex^2
     std::map<Particle*, real> energydiff;  // Energydifference V_AA - V_CG map for particles in
                                            // hybrid region for drift term calculation in H-AdResS
-    std::set<Particle*> adrZone;           // Virtual particles in AdResS zone (HY and AT region)
-    std::set<Particle*> cgZone;
 };
 
 //////////////////////////////////////////////////
@@ -147,10 +145,9 @@ inline void VerletListHadressInteractionTemplate<_PotentialAT, _PotentialCG>::ad
 {
     LOG4ESPP_INFO(theLogger, "add forces computed by the Verlet List");
 
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    std::set<Particle*> adrZone = verletList->getAdrZone();
+    std::vector<Particle*>& adrZone = verletList->getAdrZone();
 
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {
         Particle& p = **it;
         // intitialize energy diff AA-CG
@@ -293,7 +290,7 @@ inline void VerletListHadressInteractionTemplate<_PotentialAT, _PotentialCG>::ad
 
     // H-AdResS - Drift Term part 3
     // Iterate over all particles in the hybrid region and calculate drift force
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {  // Iterate over all particles
         Particle& vp = **it;
         real w = vp.lambda();
@@ -578,8 +575,8 @@ inline void VerletListHadressInteractionTemplate<_PotentialAT, _PotentialCG>::co
 {
     LOG4ESPP_INFO(theLogger, "compute virial p_xx of the pressure tensor slabwise");
 
-    std::set<Particle*> cgZone = verletList->getCGZone();
-    for (std::set<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
+    std::vector<Particle*>& cgZone = verletList->getCGZone();
+    for (std::vector<Particle*>::iterator it = cgZone.begin(); it != cgZone.end(); ++it)
     {
         Particle& vp = **it;
 
@@ -612,8 +609,8 @@ inline void VerletListHadressInteractionTemplate<_PotentialAT, _PotentialCG>::co
         }
     }
 
-    std::set<Particle*> adrZone = verletList->getAdrZone();
-    for (std::set<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
+    std::vector<Particle*>& adrZone = verletList->getAdrZone();
+    for (std::vector<Particle*>::iterator it = adrZone.begin(); it != adrZone.end(); ++it)
     {
         Particle& vp = **it;
 
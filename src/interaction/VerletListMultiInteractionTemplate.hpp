@@ -0,0 +1,386 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _INTERACTION_VERLETLISTMULTIINTERACTIONTEMPLATE_HPP
+#define _INTERACTION_VERLETLISTMULTIINTERACTIONTEMPLATE_HPP
+
+#include <tuple>
+#include <utility>
+
+#include "types.hpp"
+#include "Interaction.hpp"
+#include "Real3D.hpp"
+#include "Tensor.hpp"
+#include "Particle.hpp"
+#include "VerletList.hpp"
+#include "esutil/Array2D.hpp"
+#include "bc/BC.hpp"
+
+#include "storage/Storage.hpp"
+
+namespace espressopp
+{
+namespace interaction
+{
+/** Evaluates several pair potentials over the same Verlet list in one
+    traversal. Per pair the particles are loaded once, the forces of all
+    potentials are summed and written back once, where separate
+    VerletListInteractionTemplate objects each stream through the whole
+    list. Potential I is set with setPotential<I>, and type pairs without a
+    potential use its default constructed one like the single template.
+*/
+template <typename... _Potentials>
+class VerletListMultiInteractionTemplate : public Interaction
+{
+protected:
+    typedef std::tuple<_Potentials...> Potentials;
+    template <int I>
+    using Potential = typename std::tuple_element<I, Potentials>::type;
+    typedef std::index_sequence_for<_Potentials...> Indices;
+
+public:
+    VerletListMultiInteractionTemplate(std::shared_ptr<VerletList> _verletList)
+        : verletList(_verletList),
+          ntypes(0),
+          potentialArrays(esutil::Array2D<_Potentials, esutil::enlarge>(0, 0, _Potentials())...)
+    {
+    }
+
+    virtual ~VerletListMultiInteractionTemplate(){};
+
+    void setVerletList(std::shared_ptr<VerletList> _verletList) { verletList = _verletList; }
+
+    std::shared_ptr<VerletList> getVerletList() { return verletList; }
+
+    template <int I>
+    void setPotential(int type1, int type2, const Potential<I>& potential)
+    {
+        // typeX+1 because i<ntypes
+        ntypes = std::max(ntypes, std::max(type1 + 1, type2 + 1));
+        std::get<I>(potentialArrays).at(type1, type2) = potential;
+        if (type1 != type2)
+        {  // add potential in the other direction
+            std::get<I>(potentialArrays).at(type2, type1) = potential;
+        }
+        LOG4ESPP_INFO(Potential<I>::theLogger,
+                      "added potential " << I << " for type1=" << type1 << " type2=" << type2);
+    }
+
+    template <int I>
+    Potential<I>& getPotential(int type1, int type2)
+    {
+        return std::get<I>(potentialArrays).at(type1, type2);
+    }
+
+    template <int I>
+    std::shared_ptr<Potential<I> > getPotentialPtr(int type1, int type2)
+    {
+        return std::make_shared<Potential<I> >(std::get<I>(potentialArrays).at(type1, type2));
+    }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeEnergyDeriv();
+    virtual real computeEnergyAA();
+    virtual real computeEnergyCG();
+    virtual real computeEnergyAA(int atomtype);
+    virtual real computeEnergyCG(int atomtype);
+    virtual void computeVirialX(std::vector<real>& p_xx_total, int bins);
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+    virtual void computeVirialTensor(Tensor& w, real z);
+    virtual void computeVirialTensor(Tensor* w, int n);
+    virtual real getMaxCutoff();
+    virtual int bondType() { return Nonbonded; }
+
+protected:
+    std::shared_ptr<VerletList> verletList;
+    int ntypes;
+    std::tuple<esutil::Array2D<_Potentials, esutil::enlarge>...> potentialArrays;
+
+private:
+    // sum of the forces of all potentials on the pair, false if all are beyond their cutoff
+    template <std::size_t... I>
+    bool _computeForce(Real3D& force,
+                       const Particle& p1,
+                       const Particle& p2,
+                       std::index_sequence<I...>) const
+    {
+        int type1 = p1.type();
+        int type2 = p2.type();
+        bool inRange = false;
+        force = 0.0;
+        Real3D f;
+        // evaluated in order of the potentials
+        ((std::get<I>(potentialArrays)(type1, type2)._computeForce(f, p1, p2) &&
+          (force += f, inRange = true)),
+         ...);
+        return inRange;
+    }
+
+    template <std::size_t... I>
+    real _computeEnergy(const Particle& p1, const Particle& p2, std::index_sequence<I...>) const
+    {
+        int type1 = p1.type();
+        int type2 = p2.type();
+        return (0.0 + ... + std::get<I>(potentialArrays)(type1, type2)._computeEnergy(p1, p2));
+    }
+
+    template <std::size_t... I>
+    void resize(int maxtype, std::index_sequence<I...>)
+    {
+        // force a resize
+        (std::get<I>(potentialArrays).at(maxtype, maxtype), ...);
+    }
+
+    template <std::size_t... I>
+    real maxCutoff(int type1, int type2, std::index_sequence<I...>) const
+    {
+        real cutoff = 0.0;
+        ((cutoff = std::max(cutoff, std::get<I>(potentialArrays)(type1, type2).getCutoff())), ...);
+        return cutoff;
+    }
+};
+
+//////////////////////////////////////////////////
+// INLINE IMPLEMENTATION
+//////////////////////////////////////////////////
+template <typename... _Potentials>
+inline void VerletListMultiInteractionTemplate<_Potentials...>::addForces()
+{
+    LOG4ESPP_DEBUG(Interaction::theLogger,
+                   "loop over verlet list pairs and add forces of all potentials");
+
+    resize(verletList->getMaxType(), Indices());
+
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+
+        Real3D force;
+        if (_computeForce(force, p1, p2, Indices()))
+        {
+            p1.force() += force;
+            p2.force() -= force;
+        }
+    }
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeEnergy()
+{
+    LOG4ESPP_DEBUG(Interaction::theLogger,
+                   "loop over verlet list pairs and sum up potential energies of all potentials");
+
+    resize(verletList->getMaxType(), Indices());
+
+    real es = 0.0;
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        es += _computeEnergy(*it->first, *it->second, Indices());
+    }
+
+    // reduce over all CPUs
+    real esum;
+    boost::mpi::all_reduce(*getVerletList()->getSystem()->comm, es, esum, std::plus<real>());
+    return esum;
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeEnergyDeriv()
+{
+    LOG4ESPP_WARN(Interaction::theLogger, "Warning! computeEnergyDeriv() is not yet implemented.");
+    return 0.0;
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeEnergyAA()
+{
+    LOG4ESPP_WARN(Interaction::theLogger, "Warning! computeEnergyAA() is not yet implemented.");
+    return 0.0;
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeEnergyAA(int atomtype)
+{
+    LOG4ESPP_WARN(Interaction::theLogger,
+                  "Warning! computeEnergyAA(int atomtype) is not yet implemented.");
+    return 0.0;
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeEnergyCG()
+{
+    LOG4ESPP_WARN(Interaction::theLogger, "Warning! computeEnergyCG() is not yet implemented.");
+    return 0.0;
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeEnergyCG(int atomtype)
+{
+    LOG4ESPP_WARN(Interaction::theLogger,
+                  "Warning! computeEnergyCG(int atomtype) is not yet implemented.");
+    return 0.0;
+}
+
+template <typename... _Potentials>
+inline void VerletListMultiInteractionTemplate<_Potentials...>::computeVirialX(
+    std::vector<real>& p_xx_total, int bins)
+{
+    LOG4ESPP_WARN(Interaction::theLogger, "Warning! computeVirialX() is not yet implemented.");
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::computeVirial()
+{
+    LOG4ESPP_DEBUG(Interaction::theLogger, "loop over verlet list pairs and sum up virial");
+
+    resize(verletList->getMaxType(), Indices());
+
+    real w = 0.0;
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+
+        Real3D force;
+        if (_computeForce(force, p1, p2, Indices()))
+        {
+            Real3D r21 = p1.position() - p2.position();
+            w = w + r21 * force;
+        }
+    }
+
+    // reduce over all CPUs
+    real wsum;
+    boost::mpi::all_reduce(*mpiWorld, w, wsum, std::plus<real>());
+    return wsum;
+}
+
+template <typename... _Potentials>
+inline void VerletListMultiInteractionTemplate<_Potentials...>::computeVirialTensor(Tensor& w)
+{
+    LOG4ESPP_DEBUG(Interaction::theLogger, "loop over verlet list pairs and sum up virial tensor");
+
+    resize(verletList->getMaxType(), Indices());
+
+    Tensor wlocal(0.0);
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+
+        Real3D force;
+        if (_computeForce(force, p1, p2, Indices()))
+        {
+            Real3D r21 = p1.position() - p2.position();
+            wlocal += Tensor(r21, force);
+        }
+    }
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+// local pressure tensor for layer, plane is defined by z coordinate
+template <typename... _Potentials>
+inline void VerletListMultiInteractionTemplate<_Potentials...>::computeVirialTensor(Tensor& w,
+                                                                                   real z)
+{
+    LOG4ESPP_DEBUG(Interaction::theLogger,
+                   "loop over verlet list pairs and sum up virial tensor over one z-layer");
+
+    System& system = verletList->getSystemRef();
+    Real3D Li = system.bc->getBoxL();
+
+    real rc_cutoff = verletList->getVerletCutoff();
+
+    // boundaries should be taken into account
+    bool ghost_layer = false;
+    real zghost = -100.0;
+    if (z < rc_cutoff)
+    {
+        zghost = z + Li[2];
+        ghost_layer = true;
+    }
+    else if (z >= Li[2] - rc_cutoff)
+    {
+        zghost = z - Li[2];
+        ghost_layer = true;
+    }
+
+    resize(verletList->getMaxType(), Indices());
+
+    Tensor wlocal(0.0);
+    for (PairList::Iterator it(verletList->getPairs()); it.isValid(); ++it)
+    {
+        Particle& p1 = *it->first;
+        Particle& p2 = *it->second;
+        Real3D p1pos = p1.position();
+        Real3D p2pos = p2.position();
+
+        if ((p1pos[2] > z && p2pos[2] < z) || (p1pos[2] < z && p2pos[2] > z) ||
+            (ghost_layer && ((p1pos[2] > zghost && p2pos[2] < zghost) ||
+                             (p1pos[2] < zghost && p2pos[2] > zghost))))
+        {
+            Real3D force;
+            if (_computeForce(force, p1, p2, Indices()))
+            {
+                Real3D r21 = p1pos - p2pos;
+                wlocal += Tensor(r21, force) / fabs(r21[2]);
+            }
+        }
+    }
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+template <typename... _Potentials>
+inline void VerletListMultiInteractionTemplate<_Potentials...>::computeVirialTensor(Tensor* w,
+                                                                                   int n)
+{
+    LOG4ESPP_WARN(Interaction::theLogger,
+                  "Warning! computeVirialTensor(Tensor* w, int n) is not yet implemented.");
+}
+
+template <typename... _Potentials>
+inline real VerletListMultiInteractionTemplate<_Potentials...>::getMaxCutoff()
+{
+    real cutoff = 0.0;
+    for (int i = 0; i < ntypes; i++)
+    {
+        for (int j = 0; j < ntypes; j++)
+        {
+            cutoff = std::max(cutoff, maxCutoff(i, j, Indices()));
+        }
+    }
+    return cutoff;
+}
+}  // namespace interaction
+}  // namespace espressopp
+
+#endif
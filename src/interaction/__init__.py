@@ -83,6 +83,7 @@ except ImportError:
     pass
 
 from espressopp.interaction.CoulombRSpace import *
+from espressopp.interaction.LennardJonesCoulombRSpace import *
 from espressopp.interaction.StillingerWeberPairTerm import *
 from espressopp.interaction.StillingerWeberTripleTerm import *
 from espressopp.interaction.StillingerWeberPairTermCapped import *
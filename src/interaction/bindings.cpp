@@ -75,6 +75,7 @@
 #include "CoulombScafacos.hpp"
 #endif
 #include "CoulombRSpace.hpp"
+#include "LennardJonesCoulombRSpace.hpp"
 #include "StillingerWeberPairTerm.hpp"
 #include "StillingerWeberTripleTerm.hpp"
 #include "StillingerWeberPairTermCapped.hpp"
@@ -150,6 +151,7 @@ void registerPython()
     CoulombScafacos::registerPython();
 #endif
     CoulombRSpace::registerPython();
+    LennardJonesCoulombRSpace::registerPython();
     StillingerWeberPairTerm::registerPython();
     StillingerWeberTripleTerm::registerPython();
     StillingerWeberPairTermCapped::registerPython();
@@ -0,0 +1,424 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "Checkpoint.hpp"
+#include "checks.hpp"
+#include "esutil/RNG.hpp"
+#include "iterator/CellListIterator.hpp"
+#include "storage/Storage.hpp"
+#include "storage/DomainDecomposition.hpp"
+#include "storage/DomainDecompositionAdress.hpp"
+#include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace espressopp
+{
+namespace io
+{
+namespace
+{
+const char checkpointMagic[8] = {'E', 'S', 'P', 'P', 'C', 'H', 'K', '2'};
+
+void writeString(OutBuffer& buf, const std::string& str)
+{
+    buf.write(str.size());
+    for (char c : str) buf.write(c);
+}
+
+std::string readString(InBuffer& buf)
+{
+    size_t size;
+    buf.read(size);
+    std::string str(size, '\0');
+    for (size_t i = 0; i < size; i++) buf.read(str[i]);
+    return str;
+}
+
+/// every section starts with its name, so a mismatching setup is detected on restore
+void expectSection(InBuffer& buf, const std::string& name)
+{
+    std::string found = readString(buf);
+    if (found != name)
+        throw std::runtime_error("Checkpoint: expected section " + name + " but found " + found);
+}
+
+template <class GlobalList, class Writer>
+void saveGlobalList(OutBuffer& buf, const GlobalList& list, Writer writeValue)
+{
+    buf.write(list.size());
+    for (auto& entry : list)
+    {
+        buf.write(entry.first);
+        writeValue(entry.second);
+    }
+}
+
+/// node grid of the storage, all zero for storages without one
+Int3D getNodeGrid(const std::shared_ptr<storage::Storage>& storage)
+{
+    if (auto dd = std::dynamic_pointer_cast<storage::DomainDecomposition>(storage))
+        return dd->getNodeGrid().getGridSize();
+    if (auto dd = std::dynamic_pointer_cast<storage::DomainDecompositionAdress>(storage))
+        return dd->getNodeGrid().getGridSize();
+    return Int3D(0, 0, 0);
+}
+
+// MPI counts are int, so large blocks are read and written in several collective rounds
+const int64_t maxChunk = int64_t(1) << 30;
+
+int64_t chunkRounds(const mpi::communicator& comm, int64_t length)
+{
+    int64_t rounds = (length + maxChunk - 1) / maxChunk;
+    MPI_Allreduce(MPI_IN_PLACE, &rounds, 1, MPI_INT64_T, MPI_MAX, comm);
+    return rounds;
+}
+
+void writeBlock(const mpi::communicator& comm, MPI_File fh, int64_t offset, const char* data,
+                int64_t length)
+{
+    int64_t rounds = chunkRounds(comm, length);
+    for (int64_t r = 0; r < rounds; r++)
+    {
+        int64_t begin = std::min(r * maxChunk, length);
+        int64_t count = std::min(maxChunk, length - begin);
+        CHECK_EQUAL(MPI_File_write_at_all(fh, offset + begin, data + begin, int(count), MPI_BYTE,
+                                          MPI_STATUS_IGNORE),
+                    MPI_SUCCESS);
+    }
+}
+
+void readBlock(const mpi::communicator& comm, MPI_File fh, int64_t offset, char* data,
+               int64_t length)
+{
+    int64_t rounds = chunkRounds(comm, length);
+    for (int64_t r = 0; r < rounds; r++)
+    {
+        int64_t begin = std::min(r * maxChunk, length);
+        int64_t count = std::min(maxChunk, length - begin);
+        CHECK_EQUAL(MPI_File_read_at_all(fh, offset + begin, data + begin, int(count), MPI_BYTE,
+                                         MPI_STATUS_IGNORE),
+                    MPI_SUCCESS);
+    }
+}
+}  // namespace
+
+Checkpoint::Checkpoint(std::shared_ptr<System> _system,
+                       std::shared_ptr<integrator::MDIntegrator> _integrator,
+                       std::string _filename)
+    : system(_system), integrator(_integrator), filename(_filename)
+{
+    if (!system->rng) throw std::runtime_error("Checkpoint: system has no RNG");
+}
+
+void Checkpoint::addComponent(const std::string& name,
+                              std::function<void(OutBuffer&)> save,
+                              std::function<void(InBuffer&)> load,
+                              std::function<void()> clear)
+{
+    components.push_back(Component{name, save, load, clear});
+}
+
+/*******************************************************************************************/
+/* registered components                                                                    */
+/*******************************************************************************************/
+
+void Checkpoint::addFixedPairList(std::shared_ptr<FixedPairList> fpl)
+{
+    addComponent(
+        "FixedPairList",
+        [fpl](OutBuffer& buf)
+        { saveGlobalList(buf, *fpl->getGlobalPairs(), [&](longint pid2) { buf.write(pid2); }); },
+        [fpl](InBuffer& buf)
+        {
+            size_t size;
+            buf.read(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                longint pid1, pid2;
+                buf.read(pid1);
+                buf.read(pid2);
+                fpl->getGlobalPairs()->insert(std::make_pair(pid1, pid2));
+            }
+        },
+        [fpl]() { fpl->getGlobalPairs()->clear(); });
+}
+
+void Checkpoint::addFixedTripleList(std::shared_ptr<FixedTripleList> ftl)
+{
+    addComponent(
+        "FixedTripleList",
+        [ftl](OutBuffer& buf)
+        {
+            saveGlobalList(buf, *ftl->getGlobalTriples(),
+                           [&](const std::pair<longint, longint>& pids)
+                           {
+                               buf.write(pids.first);
+                               buf.write(pids.second);
+                           });
+        },
+        [ftl](InBuffer& buf)
+        {
+            size_t size;
+            buf.read(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                longint pid1, pid2, pid3;
+                buf.read(pid1);
+                buf.read(pid2);
+                buf.read(pid3);
+                ftl->getGlobalTriples()->insert(std::make_pair(pid1, std::make_pair(pid2, pid3)));
+            }
+        },
+        [ftl]() { ftl->getGlobalTriples()->clear(); });
+}
+
+void Checkpoint::addFixedQuadrupleList(std::shared_ptr<FixedQuadrupleList> fql)
+{
+    addComponent(
+        "FixedQuadrupleList",
+        [fql](OutBuffer& buf)
+        {
+            saveGlobalList(buf, *fql->getGlobalQuadruples(),
+                           [&](const Triple<longint, longint, longint>& pids)
+                           {
+                               buf.write(pids.first);
+                               buf.write(pids.second);
+                               buf.write(pids.third);
+                           });
+        },
+        [fql](InBuffer& buf)
+        {
+            size_t size;
+            buf.read(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                longint pid1, pid2, pid3, pid4;
+                buf.read(pid1);
+                buf.read(pid2);
+                buf.read(pid3);
+                buf.read(pid4);
+                fql->getGlobalQuadruples()->insert(
+                    std::make_pair(pid1, Triple<longint, longint, longint>(pid2, pid3, pid4)));
+            }
+        },
+        [fql]() { fql->getGlobalQuadruples()->clear(); });
+}
+
+void Checkpoint::addVerletList(std::shared_ptr<VerletList> vl)
+{
+    // the exclusion list is replicated on all ranks, rank 0 stores it and broadcasts it back
+    std::shared_ptr<System> sys = system;
+    addComponent(
+        "VerletList",
+        [vl, sys](OutBuffer& buf)
+        {
+            const auto& exList = vl->getExcludeList();
+            size_t size = (sys->comm->rank() == 0) ? exList.size() : 0;
+            buf.write(size);
+            if (size == 0) return;
+            for (auto& pids : exList)
+            {
+                buf.write(pids.first);
+                buf.write(pids.second);
+            }
+        },
+        [vl, sys](InBuffer& buf)
+        {
+            size_t size;
+            buf.read(size);
+            std::vector<longint> pids(2 * size);
+            for (auto& pid : pids) buf.read(pid);
+            boost::mpi::broadcast(*sys->comm, pids, 0);
+            for (size_t i = 0; i < pids.size(); i += 2) vl->exclude(pids[i], pids[i + 1]);
+        },
+        [vl]() { vl->clearExcludeList(); });
+}
+
+void Checkpoint::addLatticeBoltzmann(std::shared_ptr<integrator::LatticeBoltzmann> lb)
+{
+    addComponent(
+        "LatticeBoltzmann", [lb](OutBuffer& buf) { lb->writeCheckpoint(buf); },
+        [lb](InBuffer& buf) { lb->readCheckpoint(buf); });
+}
+
+/*******************************************************************************************/
+/* save and restore                                                                         */
+/*******************************************************************************************/
+
+void Checkpoint::save()
+{
+    const mpi::communicator& comm = *system->comm;
+    OutBuffer buf(comm);
+
+    writeString(buf, "Integrator");
+    buf.write(integrator->getStep());
+
+    writeString(buf, "RNG");
+    std::ostringstream rngState;
+    rngState << *system->rng->getBoostRNG();
+    writeString(buf, rngState.str());
+
+    writeString(buf, "Particles");
+    buf.write(size_t(system->storage->getNRealParticles()));
+    for (iterator::CellListIterator cit(system->storage->getRealCells()); !cit.isDone(); ++cit)
+    {
+        buf.write(*cit);  // the whole particle, forces and local data included
+    }
+
+    for (auto& component : components)
+    {
+        writeString(buf, component.name);
+        component.save(buf);
+    }
+
+    // header: magic, number of ranks, node grid and the size of every block
+    int64_t blockSize = buf.getSize();
+    std::vector<int64_t> blockSizes(comm.size());
+    MPI_Allgather(&blockSize, 1, MPI_INT64_T, blockSizes.data(), 1, MPI_INT64_T, comm);
+    const int64_t headerSize = sizeof(checkpointMagic) + sizeof(int64_t) * (4 + comm.size());
+    int64_t offset = headerSize;
+    for (int r = 0; r < comm.rank(); r++) offset += blockSizes[r];
+
+    MPI_File fh;
+    if (MPI_File_open(comm, filename.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL,
+                      &fh) != MPI_SUCCESS)
+        throw std::runtime_error("Checkpoint: cannot open " + filename);
+    CHECK_EQUAL(MPI_File_set_size(fh, 0), MPI_SUCCESS);
+
+    if (comm.rank() == 0)
+    {
+        Int3D nodeGrid = getNodeGrid(system->storage);
+        int64_t layout[4] = {comm.size(), nodeGrid[0], nodeGrid[1], nodeGrid[2]};
+        std::vector<char> header(headerSize);
+        std::memcpy(header.data(), checkpointMagic, sizeof(checkpointMagic));
+        std::memcpy(header.data() + sizeof(checkpointMagic), layout, sizeof(layout));
+        std::memcpy(header.data() + sizeof(checkpointMagic) + sizeof(layout), blockSizes.data(),
+                    sizeof(int64_t) * comm.size());
+        CHECK_EQUAL(MPI_File_write_at(fh, 0, header.data(), int(headerSize), MPI_BYTE,
+                                      MPI_STATUS_IGNORE),
+                    MPI_SUCCESS);
+    }
+    writeBlock(comm, fh, offset, buf.getData(), blockSize);
+    CHECK_EQUAL(MPI_File_close(&fh), MPI_SUCCESS);
+}
+
+void Checkpoint::restore()
+{
+    const mpi::communicator& comm = *system->comm;
+
+    MPI_File fh;
+    if (MPI_File_open(comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh) !=
+        MPI_SUCCESS)
+        throw std::runtime_error("Checkpoint: cannot open " + filename);
+
+    char magic[sizeof(checkpointMagic)];
+    int64_t layout[4];
+    CHECK_EQUAL(MPI_File_read_at_all(fh, 0, magic, sizeof(magic), MPI_BYTE, MPI_STATUS_IGNORE),
+                MPI_SUCCESS);
+    CHECK_EQUAL(MPI_File_read_at_all(fh, sizeof(magic), layout, 4, MPI_INT64_T,
+                                     MPI_STATUS_IGNORE),
+                MPI_SUCCESS);
+    Int3D nodeGrid = getNodeGrid(system->storage);
+    if (std::memcmp(magic, checkpointMagic, sizeof(magic)) != 0 || layout[0] != comm.size() ||
+        layout[1] != nodeGrid[0] || layout[2] != nodeGrid[1] || layout[3] != nodeGrid[2])
+    {
+        MPI_File_close(&fh);
+        throw std::runtime_error("Checkpoint: " + filename +
+                                 " is no checkpoint written on the same number of ranks with"
+                                 " the same node grid");
+    }
+
+    const int64_t numRanks = layout[0];
+    std::vector<int64_t> blockSizes(numRanks);
+    CHECK_EQUAL(MPI_File_read_at_all(fh, sizeof(magic) + sizeof(layout), blockSizes.data(),
+                                     int(numRanks), MPI_INT64_T, MPI_STATUS_IGNORE),
+                MPI_SUCCESS);
+    int64_t offset = sizeof(magic) + sizeof(layout) + sizeof(int64_t) * numRanks;
+    for (int r = 0; r < comm.rank(); r++) offset += blockSizes[r];
+
+    std::vector<char> block(blockSizes[comm.rank()]);
+    readBlock(comm, fh, offset, block.data(), int64_t(block.size()));
+    CHECK_EQUAL(MPI_File_close(&fh), MPI_SUCCESS);
+
+    InBuffer buf(comm);
+    buf.assign(block.data(), block.size());
+    block = std::vector<char>();
+
+    expectSection(buf, "Integrator");
+    long long step;
+    buf.read(step);
+    integrator->setStep(step);
+
+    expectSection(buf, "RNG");
+    std::istringstream rngState(readString(buf));
+    rngState >> *system->rng->getBoostRNG();
+
+    expectSection(buf, "Particles");
+    size_t numParticles;
+    buf.read(numParticles);
+    std::vector<Particle> particles(numParticles);
+    for (auto& part : particles) buf.read(part);
+
+    // lists must not refer to particles while these are replaced
+    for (auto& component : components)
+        if (component.clear) component.clear();
+
+    system->storage->removeAllParticles();
+    for (auto& part : particles)
+    {
+        Particle* p = system->storage->addParticle(part.id(), part.position(), false);
+        CHECK_NOT_NULLPTR(p, "particle creation was rejected!");
+        *p = part;
+    }
+
+    for (auto& component : components)
+    {
+        expectSection(buf, component.name);
+        component.load(buf);
+    }
+
+    // rebuild ghosts and the local pair lists from the restored global lists
+    system->storage->decompose();
+}
+
+/*******************************************************************************************/
+
+void Checkpoint::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<Checkpoint, boost::noncopyable>(
+        "io_Checkpoint", init<std::shared_ptr<System>, std::shared_ptr<integrator::MDIntegrator>,
+                              std::string>())
+        .add_property("filename", &Checkpoint::getFilename, &Checkpoint::setFilename)
+        .def("addFixedPairList", &Checkpoint::addFixedPairList)
+        .def("addFixedTripleList", &Checkpoint::addFixedTripleList)
+        .def("addFixedQuadrupleList", &Checkpoint::addFixedQuadrupleList)
+        .def("addVerletList", &Checkpoint::addVerletList)
+        .def("addLatticeBoltzmann", &Checkpoint::addLatticeBoltzmann)
+        .def("save", &Checkpoint::save)
+        .def("restore", &Checkpoint::restore);
+}
+}  // namespace io
+}  // namespace espressopp
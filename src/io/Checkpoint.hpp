@@ -0,0 +1,102 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _IO_CHECKPOINT_HPP
+#define _IO_CHECKPOINT_HPP
+
+#include "mpi.hpp"
+#include "types.hpp"
+#include "System.hpp"
+#include "Buffer.hpp"
+#include "FixedPairList.hpp"
+#include "FixedTripleList.hpp"
+#include "FixedQuadrupleList.hpp"
+#include "VerletList.hpp"
+#include "integrator/MDIntegrator.hpp"
+#include "integrator/LatticeBoltzmann.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace espressopp
+{
+namespace io
+{
+/**
+ * Collective binary checkpoint of the full simulation state.
+ *
+ * Every rank packs its state into a buffer and all buffers are written into one file with
+ * MPI-IO, behind a header holding the number of ranks, the node grid and the size of every
+ * block; blocks beyond the int range of MPI counts go out in several rounds. The integrator
+ * step, the state of the system RNG and all real particles (including thermostat memories
+ * stored with them, e.g. the extended variable of the GeneralizedLangevinThermostat) are always
+ * saved. Bonded lists, exclusions and the LB fluid are saved if they were registered with the
+ * add* methods.
+ *
+ * A checkpoint is restored on the same number of ranks with the same node grid and the same
+ * components registered in the same order; it then reproduces the saved state exactly.
+ */
+class Checkpoint
+{
+public:
+    Checkpoint(std::shared_ptr<System> system,
+               std::shared_ptr<integrator::MDIntegrator> integrator,
+               std::string filename);
+
+    void addFixedPairList(std::shared_ptr<FixedPairList> fpl);
+    void addFixedTripleList(std::shared_ptr<FixedTripleList> ftl);
+    void addFixedQuadrupleList(std::shared_ptr<FixedQuadrupleList> fql);
+    void addVerletList(std::shared_ptr<VerletList> vl);
+    void addLatticeBoltzmann(std::shared_ptr<integrator::LatticeBoltzmann> lb);
+
+    /// write the state of all ranks into the checkpoint file
+    void save();
+    /// replace the current state by the one in the checkpoint file
+    void restore();
+
+    std::string getFilename() { return filename; }
+    void setFilename(std::string v) { filename = v; }
+
+    static void registerPython();
+
+private:
+    struct Component
+    {
+        std::string name;
+        std::function<void(OutBuffer&)> save;
+        std::function<void(InBuffer&)> load;
+        std::function<void()> clear;  // drop references to particles, may be empty
+    };
+
+    void addComponent(const std::string& name,
+                      std::function<void(OutBuffer&)> save,
+                      std::function<void(InBuffer&)> load,
+                      std::function<void()> clear = nullptr);
+
+    std::shared_ptr<System> system;
+    std::shared_ptr<integrator::MDIntegrator> integrator;
+    std::string filename;
+    std::vector<Component> components;
+};
+}  // namespace io
+}  // namespace espressopp
+
+#endif
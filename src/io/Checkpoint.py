@@ -0,0 +1,87 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+************************
+espressopp.io.Checkpoint
+************************
+
+Collective binary checkpoint of the complete simulation state in one file.
+
+Every process packs its part of the state and all parts are written in
+parallel. Always saved are the integrator step, the state of the random
+number generator of the system and all particles with all their properties
+(forces and thermostat variables stored with the particles included). Bonded
+lists, exclusions and the lattice-Boltzmann fluid are saved once registered.
+
+:py:meth:`restore` replaces particles, bonds and exclusions of the running
+setup by the saved ones, so after a restart nothing but the interactions and
+extensions has to be set up again in Python. A checkpoint can only be restored
+on the same number of processes with the same node grid, and the same
+components have to be registered in the same order.
+
+.. function:: espressopp.io.Checkpoint(system, integrator, filename)
+
+    :param system: system object
+    :param integrator: integrator whose step is saved
+    :param str filename: name of the checkpoint file
+
+.. function:: espressopp.io.Checkpoint.addFixedPairList(fpl)
+.. function:: espressopp.io.Checkpoint.addFixedTripleList(ftl)
+.. function:: espressopp.io.Checkpoint.addFixedQuadrupleList(fql)
+.. function:: espressopp.io.Checkpoint.addVerletList(vl)
+
+    save the exclusion list of the Verlet list
+
+.. function:: espressopp.io.Checkpoint.addLatticeBoltzmann(lb)
+.. function:: espressopp.io.Checkpoint.save()
+.. function:: espressopp.io.Checkpoint.restore()
+
+Example:
+
+>>> checkpoint = espressopp.io.Checkpoint(system, integrator, 'run.chk')
+>>> checkpoint.addFixedPairList(fpl)
+>>> checkpoint.addVerletList(vl)
+>>> ...
+>>> checkpoint.save()
+>>>
+>>> # after a restart with the same setup
+>>> checkpoint.restore()
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from _espressopp import io_Checkpoint
+
+class CheckpointLocal(io_Checkpoint):
+
+    def __init__(self, system, integrator, filename):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, io_Checkpoint, system, integrator, filename)
+
+
+if pmi.isController :
+    class Checkpoint(object, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+          cls =  'espressopp.io.CheckpointLocal',
+          pmicall = [ 'addFixedPairList', 'addFixedTripleList', 'addFixedQuadrupleList',
+                      'addVerletList', 'addLatticeBoltzmann', 'save', 'restore' ],
+          pmiproperty = ['filename']
+        )
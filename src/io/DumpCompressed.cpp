@@ -0,0 +1,247 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <zlib.h>
+#include <boost/filesystem.hpp>
+#include "DumpCompressed.hpp"
+#include "OrderedFrame.hpp"
+#include "FileBackup.hpp"
+#include "checks.hpp"
+#include "esutil/Error.hpp"
+#include "bc/BC.hpp"
+
+namespace espressopp
+{
+namespace io
+{
+namespace
+{
+static_assert(sizeof(DumpCompressed::FrameHeader) == 72, "frame header is part of the format");
+static_assert(sizeof(DumpCompressed::IndexEntry) == 24, "index layout is part of the format");
+
+// small differences of either sign become small unsigned numbers
+inline uint64_t zigzag(int64_t v) { return (uint64_t(v) << 1) ^ uint64_t(v >> 63); }
+
+inline void putVarint(std::string& out, uint64_t v)
+{
+    while (v >= 0x80)
+    {
+        out.push_back(char(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(char(v));
+}
+}  // namespace
+
+DumpCompressed::DumpCompressed(std::shared_ptr<System> system,
+                               std::shared_ptr<integrator::MDIntegrator> _integrator,
+                               std::string _file_name,
+                               real _precision,
+                               bool _unfolded,
+                               int _keyframe_interval,
+                               int _compression,
+                               bool _append)
+    : ParticleAccess(system),
+      integrator(_integrator),
+      file_name(_file_name),
+      unfolded(_unfolded),
+      append(_append),
+      framesSinceKey(-1)
+{
+    setPrecision(_precision);
+    setKeyframeInterval(_keyframe_interval);
+    setCompression(_compression);
+
+    if (system->comm->rank() == 0 && !append)
+    {
+        FileBackup backup(file_name);
+        FileBackup backupIndex(file_name + ".idx");
+    }
+}
+
+void DumpCompressed::setPrecision(real v)
+{
+    esutil::Error err(getSystem()->comm);
+    if (!(v > 0.0))
+    {
+        std::stringstream msg;
+        msg << "DumpCompressed: precision has to be positive, got " << v;
+        err.setException(msg.str());
+    }
+    err.checkException();
+
+    precision = v;
+    resetReference();
+}
+
+void DumpCompressed::setKeyframeInterval(int v)
+{
+    esutil::Error err(getSystem()->comm);
+    if (v < 1)
+    {
+        std::stringstream msg;
+        msg << "DumpCompressed: keyframe_interval has to be at least 1, got " << v;
+        err.setException(msg.str());
+    }
+    err.checkException();
+
+    keyframe_interval = v;
+}
+
+void DumpCompressed::setCompression(int v)
+{
+    esutil::Error err(getSystem()->comm);
+    if (v < 0 || v > 9)
+    {
+        std::stringstream msg;
+        msg << "DumpCompressed: compression level has to be in 0..9, got " << v;
+        err.setException(msg.str());
+    }
+    err.checkException();
+
+    compression = v;
+}
+
+void DumpCompressed::dump()
+{
+    std::shared_ptr<System> system = getSystem();
+    const mpi::communicator& comm = *system->comm;
+    OrderedFrame frame(*system, unfolded, false);
+
+    const int64_t numLocal = frame.getNumLocal();
+    std::vector<longint> ids(numLocal);
+    std::vector<int64_t> coords(numLocal * 3);
+    for (int64_t i = 0; i < numLocal; i++)
+    {
+        ids[i] = frame.getId(i);
+        const real* pos = frame.getPosition(i);
+        for (int d = 0; d < 3; d++) coords[i * 3 + d] = std::llround(pos[d] / precision);
+    }
+
+    // a delta frame needs the same particles in every block as the previous frame
+    int key = framesSinceKey < 0 || framesSinceKey + 1 >= keyframe_interval || ids != refIds;
+    MPI_Allreduce(MPI_IN_PLACE, &key, 1, MPI_INT, MPI_LOR, comm);
+
+    std::string payload;
+    payload.reserve(numLocal * (key ? 8 : 6) + 10);
+    putVarint(payload, zigzag(numLocal));
+    if (key)
+    {
+        longint prev = 0;
+        for (longint id : ids)
+        {
+            putVarint(payload, zigzag(int64_t(id) - prev));
+            prev = id;
+        }
+    }
+    for (int64_t i = 0; i < numLocal * 3; i++)
+    {
+        // key frames refer to the previous particle, which is often a bonded neighbour
+        int64_t ref = key ? (i >= 3 ? coords[i - 3] : 0) : refCoords[i];
+        putVarint(payload, zigzag(coords[i] - ref));
+    }
+
+    uLongf blockSize = compressBound(uLong(payload.size()));
+    std::string block(blockSize, '\0');
+    CHECK_EQUAL(compress2(reinterpret_cast<Bytef*>(&block[0]), &blockSize,
+                          reinterpret_cast<const Bytef*>(payload.data()), uLong(payload.size()),
+                          compression),
+                Z_OK);
+    block.resize(blockSize);
+
+    // rank 0 puts the frame header and the table of block sizes in front of its block
+    int64_t size = int64_t(block.size());
+    std::vector<int64_t> sizes(comm.rank() == 0 ? comm.size() : 0);
+    MPI_Gather(&size, 1, MPI_INT64_T, sizes.data(), 1, MPI_INT64_T, 0, comm);
+
+    IndexEntry entry = {0, integrator->getStep(), key ? KEYFRAME : 0};
+    std::string text;
+    if (comm.rank() == 0)
+    {
+        FrameHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, "ECTR", 4);
+        header.numBlocks = comm.size();
+        header.step = entry.step;
+        header.time = integrator->getStep() * integrator->getTimeStep();
+        Real3D L = system->bc->getBoxL();
+        for (int d = 0; d < 3; d++) header.box[d] = L[d];
+        header.precision = precision;
+        header.numParticles = frame.getNumTotal();
+        header.flags = int32_t(entry.flags);
+
+        text.reserve(sizeof(header) + sizes.size() * sizeof(int64_t) + block.size());
+        text.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        text.append(reinterpret_cast<const char*>(sizes.data()), sizes.size() * sizeof(int64_t));
+        text.append(block);
+
+        if (boost::filesystem::exists(file_name))
+            entry.offset = int64_t(boost::filesystem::file_size(file_name));
+    }
+    else
+    {
+        text.swap(block);
+    }
+
+    if (!appendOrdered(comm, file_name, text))
+    {
+        if (comm.rank() == 0) std::cout << "Unable to open file: " << file_name << std::endl;
+        resetReference();
+        return;
+    }
+
+    if (comm.rank() == 0)
+    {
+        std::ofstream index(file_name + ".idx", std::ios::binary | std::ios::app);
+        index.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+
+    refIds.swap(ids);
+    refCoords.swap(coords);
+    framesSinceKey = key ? 0 : framesSinceKey + 1;
+}
+
+// Python wrapping
+void DumpCompressed::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<DumpCompressed, bases<ParticleAccess>, boost::noncopyable>(
+        "io_DumpCompressed",
+        init<std::shared_ptr<System>, std::shared_ptr<integrator::MDIntegrator>, std::string,
+             real, bool, int, int, bool>())
+        .add_property("filename", &DumpCompressed::getFilename, &DumpCompressed::setFilename)
+        .add_property("precision", &DumpCompressed::getPrecision, &DumpCompressed::setPrecision)
+        .add_property("unfolded", &DumpCompressed::getUnfolded, &DumpCompressed::setUnfolded)
+        .add_property("keyframe_interval", &DumpCompressed::getKeyframeInterval,
+                      &DumpCompressed::setKeyframeInterval)
+        .add_property("compression", &DumpCompressed::getCompression,
+                      &DumpCompressed::setCompression)
+        .add_property("append", &DumpCompressed::getAppend, &DumpCompressed::setAppend)
+        .def("dump", &DumpCompressed::dump);
+}
+}  // namespace io
+}  // namespace espressopp
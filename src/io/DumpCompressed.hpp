@@ -0,0 +1,134 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _IO_DUMPCOMPRESSED_HPP
+#define _IO_DUMPCOMPRESSED_HPP
+
+#include "mpi.hpp"
+#include "types.hpp"
+#include "System.hpp"
+#include "ParticleAccess.hpp"
+#include "integrator/MDIntegrator.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace espressopp
+{
+namespace io
+{
+/**
+ * Lossy compressed trajectory writer.
+ *
+ * Positions are quantized to a fixed precision and, in particle id order, stored as the
+ * difference to the previous frame (or, in key frames, to the previous particle). The
+ * differences are written as zigzag varints and deflated. Every rank encodes its own block of
+ * the id-sorted frame (see OrderedFrame) and all blocks are written collectively.
+ *
+ * A frame in the trajectory file is a FrameHeader, one int64 compressed size per block and the
+ * blocks in rank order. A delta frame has the same number of blocks as its key frame and every
+ * block holds the same particles. For random access, the index file <filename>.idx gets one
+ * IndexEntry per frame. All numbers are little endian.
+ */
+class DumpCompressed : public ParticleAccess
+{
+public:
+    struct FrameHeader
+    {
+        char magic[4];  // "ECTR"
+        int32_t numBlocks;
+        int64_t step;
+        double time;
+        double box[3];
+        double precision;
+        int64_t numParticles;
+        int32_t flags;  // bit 0: key frame
+        int32_t reserved;
+    };
+
+    struct IndexEntry
+    {
+        int64_t offset;  // of the frame header in the trajectory file
+        int64_t step;
+        int64_t flags;
+    };
+
+    static const int32_t KEYFRAME = 1;
+
+    DumpCompressed(std::shared_ptr<System> system,
+                   std::shared_ptr<integrator::MDIntegrator> _integrator,
+                   std::string _file_name,
+                   real _precision,
+                   bool _unfolded,
+                   int _keyframe_interval,
+                   int _compression,
+                   bool _append);
+    ~DumpCompressed() {}
+
+    void perform_action() { dump(); }
+
+    void dump();
+
+    std::string getFilename() { return file_name; }
+    void setFilename(std::string v)
+    {
+        file_name = v;
+        resetReference();
+    }
+    real getPrecision() { return precision; }
+    void setPrecision(real v);
+    bool getUnfolded() { return unfolded; }
+    void setUnfolded(bool v)
+    {
+        unfolded = v;
+        resetReference();
+    }
+    int getKeyframeInterval() { return keyframe_interval; }
+    void setKeyframeInterval(int v);
+    int getCompression() { return compression; }
+    void setCompression(int v);
+    bool getAppend() { return append; }
+    void setAppend(bool v) { append = v; }
+
+    static void registerPython();
+
+private:
+    /// the next frame is written as a key frame
+    void resetReference() { framesSinceKey = -1; }
+
+    std::shared_ptr<integrator::MDIntegrator> integrator;
+
+    std::string file_name;
+    real precision;         // quantization step for the positions
+    bool unfolded;          // folded coordinates jump at the box faces and compress worse
+    int keyframe_interval;  // at most this many frames have to be decoded for random access
+    int compression;        // zlib level 1..9
+    bool append;
+
+    int framesSinceKey;
+    // ids and quantized positions of the local block of the previous frame
+    std::vector<longint> refIds;
+    std::vector<int64_t> refCoords;
+};
+}  // namespace io
+}  // namespace espressopp
+
+#endif
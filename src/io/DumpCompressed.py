@@ -0,0 +1,118 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+****************************
+espressopp.io.DumpCompressed
+****************************
+
+Lossy compressed trajectory of the particle positions.
+
+Positions are rounded to a multiple of ``precision`` and stored, in particle
+id order, as the difference to the same particle in the previous frame. Every
+``keyframe_interval`` frames, and whenever particles were added or removed,
+a key frame is written instead, which stores the particle ids and the
+difference of each position to the previous particle. The small integers are
+varint coded and deflated. Each process encodes its own block of the
+id-sorted frame, and all blocks are written in parallel.
+
+Next to the trajectory, the index file ``filename.idx`` lists the offset,
+step and type of every frame. Frames are read back with
+:py:class:`espressopp.tools.CTRReader`, or for analysis with
+:py:class:`espressopp.io.TrajectoryReader`.
+
+* `dump()`
+
+  append the current configuration to the trajectory
+
+  **Properties**
+
+* `filename`
+  Name of the trajectory file. Default: ``out.ctr``
+
+* `precision`
+  Positions are stored with an error of at most half the precision.
+  Default: 0.001
+
+* `unfolded`
+  True for unfolded coordinates. Folded coordinates jump at the box faces,
+  which costs compression. Default: True
+
+* `keyframe_interval`
+  Reading an arbitrary frame decodes at most this many frames. Default: 100
+
+* `compression`
+  zlib compression level, 0 to 9. Default: 6
+
+* `append`
+  True if frames are appended to an existing trajectory. Otherwise an
+  existing trajectory and its index are moved to a backup. Default: True
+
+Example:
+
+>>> dump_ctr = espressopp.io.DumpCompressed(system, integrator, filename='traj.ctr', precision=0.01)
+>>> ext_analyze = espressopp.integrator.ExtAnalyze(dump_ctr, 100)
+>>> integrator.addExtension(ext_analyze)
+>>> integrator.run(100000)
+>>>
+>>> reader = espressopp.tools.CTRReader('traj.ctr')
+>>> step, time, box, ids, pos = reader.read(500)
+
+.. function:: espressopp.io.DumpCompressed(system, integrator, filename='out.ctr', precision=0.001,\
+                                           unfolded=True, keyframe_interval=100, compression=6,\
+                                           append=True)
+
+        :param system:
+        :param integrator:
+        :param str filename:
+        :param real precision:
+        :param bool unfolded:
+        :param int keyframe_interval:
+        :param int compression:
+        :param bool append:
+
+.. function:: espressopp.io.DumpCompressed.dump()
+
+                :rtype:
+
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from espressopp.ParticleAccess import *
+from _espressopp import io_DumpCompressed
+
+class DumpCompressedLocal(ParticleAccessLocal, io_DumpCompressed):
+
+    def __init__(self, system, integrator, filename='out.ctr', precision=0.001, unfolded=True, keyframe_interval=100, compression=6, append=True):
+        cxxinit(self, io_DumpCompressed, system, integrator, filename, precision, unfolded, keyframe_interval, compression, append)
+
+    def dump(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.dump(self)
+
+
+if pmi.isController :
+    class DumpCompressed(ParticleAccess, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+          cls =  'espressopp.io.DumpCompressedLocal',
+          pmicall = [ 'dump' ],
+          pmiproperty = ['filename', 'precision', 'unfolded', 'keyframe_interval', 'compression', 'append']
+        )
@@ -27,13 +27,13 @@
 
 #include "bc/BC.hpp"
 
-#include "analysis/ConfigurationExt.hpp"
-#include "analysis/ConfigurationsExt.hpp"
+#include "OrderedFrame.hpp"
 
 #include <boost/filesystem.hpp>
+#include <numeric>
+#include <type_traits>
 
 using namespace espressopp;
-using namespace espressopp::analysis;
 using namespace std;
 
 namespace espressopp
@@ -65,72 +65,86 @@ void DumpXTC::close()
 void DumpXTC::dump()
 {
     std::shared_ptr<System> system = getSystem();
-    ConfigurationsExt conf(system);
-    conf.setUnfolded(unfolded);
-    conf.gather();
+    OrderedFrame frame(*system, unfolded, false);
+
+    // the xtc coordinate compression is one bit stream per frame, so rank 0 still encodes it,
+    // but it only receives the id-sorted coordinates in single precision
+    typedef std::remove_extent<rvec>::type coord_t;
+    const MPI_Datatype coordType = mpi::get_mpi_datatype<coord_t>();
+    const MPI_Comm comm = *system->comm;
+    const int nProcs = system->comm->size();
+
+    int numLocal = int(frame.getNumLocal());
+    std::vector<coord_t> localCoords(3 * numLocal);
+    for (int i = 0; i < numLocal; i++)
+    {
+        const real* pos = frame.getPosition(i);
+        for (int d = 0; d < dim; d++) localCoords[3 * i + d] = pos[d] * length_factor;
+    }
 
+    std::vector<int> counts, displs;
     if (system->comm->rank() == 0)
     {
-        t_trxframe frame;
+        counts.resize(nProcs);
+        displs.resize(nProcs, 0);
+    }
+    int localCount = 3 * numLocal;
+    MPI_Gather(&localCount, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+
+    if (system->comm->rank() != 0)
+    {
+        MPI_Gatherv(localCoords.data(), localCount, coordType, nullptr, nullptr, nullptr,
+                    coordType, 0, comm);
+        return;
+    }
 
-        ConfigurationExtPtr conf_real = conf.back();
+    int num_of_particles = int(frame.getNumTotal());
+    rvec* coord = new rvec[num_of_particles];
+    std::partial_sum(counts.begin(), counts.end() - 1, displs.begin() + 1);
+    MPI_Gatherv(localCoords.data(), localCount, coordType, coord, counts.data(), displs.data(),
+                coordType, 0, comm);
 
-        int num_of_particles = conf_real->getSize();
+    t_trxframe trxframe;
 
-        if (this->open("a"))
+    if (this->open("a"))
+    {
+        int step = integrator->getStep();
+        float time = integrator->getTimeStep() * step;
+
+        trxframe.natoms = num_of_particles;
+        trxframe.bTime = true;
+        trxframe.time = time;
+        trxframe.bStep = true;
+        trxframe.step = step;
+        trxframe.x = coord;
+        trxframe.bLambda = false;
+        trxframe.bAtoms = false;
+        trxframe.bPrec = true;
+        trxframe.prec = xtcprec;
+        trxframe.bX = true;
+        trxframe.bF = false;
+        trxframe.bBox = true;
+
+        // HACK: Only valid for orthorhombic BC. Will there be anything else in ESPP?
+        Real3D bl = system->bc->getBoxL();
+
+        for (int i = 0; i < dim; i++)
         {
-            ConfigurationExtIterator cei = conf_real->getIterator();
-            // Real3D *box = new Real3D [dim];
-            rvec* coord = new rvec[num_of_particles];
-            RealND props;
-            props.setDimension(cei.currentProperties().getDimension());
-
-            for (int i = 0; i < num_of_particles; i++)
-            {
-                props = cei.nextProperties();
-                coord[i][0] = props[0] * length_factor;  // We only write coordinates to .xtc
-                coord[i][1] = props[1] * length_factor;
-                coord[i][2] = props[2] * length_factor;
-            }
-
-            int step = integrator->getStep();
-            float time = integrator->getTimeStep() * step;
-
-            frame.natoms = num_of_particles;
-            frame.bTime = true;
-            frame.time = time;
-            frame.bStep = true;
-            frame.step = step;
-            frame.x = coord;
-            frame.bLambda = false;
-            frame.bAtoms = false;
-            frame.bPrec = true;
-            frame.prec = xtcprec;
-            frame.bX = true;
-            frame.bF = false;
-            frame.bBox = true;
-
-            // HACK: Only valid for orthorhombic BC. Will there be anything else in ESPP?
-            Real3D bl = system->bc->getBoxL();
-
-            for (int i = 0; i < dim; i++)
-            {
-                frame.box[i][0] = 0.;
-                frame.box[i][1] = 0.;
-                frame.box[i][2] = 0.;
-
-                frame.box[i][i] = bl[i];
-            }
-
-            write_trxframe(fio, &frame, nullptr);
-
-            delete[] coord;
-
-            this->close();
+            trxframe.box[i][0] = 0.;
+            trxframe.box[i][1] = 0.;
+            trxframe.box[i][2] = 0.;
+
+            trxframe.box[i][i] = bl[i];
         }
-        else
-            cout << "Unable to open file: " << file_name << endl;
+
+        write_trxframe(fio, &trxframe, nullptr);
+
+        this->close();
     }
+    else
+        cout << "Unable to open file: " << file_name << endl;
+
+    delete[] coord;
 
     return;
 }
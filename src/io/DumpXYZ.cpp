@@ -23,17 +23,15 @@
 */
 
 #include "python.hpp"
-#include <fstream>
 #include <iomanip>
 #include <iostream>
-#include "analysis/ConfigurationExt.hpp"
-#include "analysis/ConfigurationsExt.hpp"
+#include <sstream>
 #include "DumpXYZ.hpp"
+#include "OrderedFrame.hpp"
 #include "storage/Storage.hpp"
 #include "bc/BC.hpp"
 
 using namespace espressopp;
-using namespace espressopp::analysis;
 using namespace std;
 
 namespace espressopp
@@ -43,66 +41,51 @@ namespace io
 void DumpXYZ::dump()
 {
     std::shared_ptr<System> system = getSystem();
-    ConfigurationsExt conf(system);
-    conf.setUnfolded(unfolded);
-    conf.gather();
+    OrderedFrame frame(*system, unfolded, store_velocities);
 
+    ostringstream text;
     if (system->comm->rank() == 0)
     {
-        ConfigurationExtPtr conf_real = conf.back();
+        text << frame.getNumTotal() << endl;
 
-        int num_of_particles = conf_real->getSize();
+        Real3D Li = system->bc->getBoxL();
 
-        char* ch_f_name = new char[file_name.length() + 1];
-        strcpy(ch_f_name, file_name.c_str());
-        ofstream myfile(ch_f_name, ios::out | ios::app);
-        if (myfile.is_open())
+        // for noncubic simulation boxes
+        text << Li[0] * length_factor << "  0.0  0.0  0.0  " << Li[1] * length_factor
+             << "  0.0  0.0  0.0  " << Li[2] * length_factor;
+        // additional info to comment line
+        text << "  currentStep " << integrator->getStep() << "  lengthUnit " << length_unit
+             << endl;
+    }
+
+    // every rank formats its block of the id-sorted frame
+    std::streamsize p = text.precision();
+    for (int64_t i = 0; i < frame.getNumLocal(); i++)
+    {
+        longint id = frame.getId(i);
+        const real* pos = frame.getPosition(i);
+        if (store_pids)
         {
-            myfile << num_of_particles << endl;
-
-            Real3D Li = system->bc->getBoxL();
-
-            // for noncubic simulation boxes
-            myfile << Li[0] * length_factor << "  0.0  0.0  0.0  " << Li[1] * length_factor
-                   << "  0.0  0.0  0.0  " << Li[2] * length_factor;
-            // additional info to comment line
-            myfile << "  currentStep " << integrator->getStep() << "  lengthUnit " << length_unit
-                   << endl;
-
-            ConfigurationExtIterator cei = conf_real->getIterator();
-            std::streamsize p = myfile.precision();
-            for (int i = 0; i < num_of_particles; i++)
-            {
-                if (store_pids)
-                {
-                    myfile << cei.currentId() << " ";
-                }
-
-                myfile << particleIDToType.find(cei.currentId())->second << " " << fixed
-                       << setprecision(10) << length_factor * cei.currentProperties()[0] << " "
-                       << length_factor * cei.currentProperties()[1] << " "
-                       << length_factor * cei.currentProperties()[2];
-
-                if (store_velocities)
-                {
-                    myfile << " " << length_factor * cei.currentProperties()[3] << " "
-                           << length_factor * cei.currentProperties()[4] << " "
-                           << length_factor * cei.currentProperties()[5];
-                }
-                myfile << endl;
-                myfile.unsetf(ios_base::fixed);
-                myfile << setprecision(p);
-
-                cei.incrementIterator();
-            }
-
-            myfile.close();
+            text << id << " ";
         }
-        else
-            cout << "Unable to open file: " << file_name << endl;
 
-        delete[] ch_f_name;
+        text << particleIDToType.find(id)->second << " " << fixed << setprecision(10)
+             << length_factor * pos[0] << " " << length_factor * pos[1] << " "
+             << length_factor * pos[2];
+
+        if (store_velocities)
+        {
+            const real* vel = frame.getVelocity(i);
+            text << " " << length_factor * vel[0] << " " << length_factor * vel[1] << " "
+                 << length_factor * vel[2];
+        }
+        text << endl;
+        text.unsetf(ios_base::fixed);
+        text << setprecision(p);
     }
+
+    if (!appendOrdered(*system->comm, file_name, text.str()) && system->comm->rank() == 0)
+        cout << "Unable to open file: " << file_name << endl;
 }
 
 // Python wrapping
@@ -0,0 +1,166 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "OrderedFrame.hpp"
+#include "checks.hpp"
+#include "bc/BC.hpp"
+#include "iterator/CellListIterator.hpp"
+#include "storage/Storage.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace espressopp
+{
+namespace io
+{
+OrderedFrame::OrderedFrame(System& system, bool unfolded, bool velocities)
+    : stride(velocities ? 6 : 3), numTotal(0), offset(0)
+{
+    const MPI_Comm comm = *system.comm;
+    const int nProcs = system.comm->size();
+    const MPI_Datatype idType = mpi::get_mpi_datatype<longint>();
+    const MPI_Datatype realType = mpi::get_mpi_datatype<real>();
+
+    // collect local particles
+    std::vector<longint> localIds;
+    std::vector<real> localValues;
+    localIds.reserve(system.storage->getNRealParticles());
+    localValues.reserve(system.storage->getNRealParticles() * stride);
+
+    Real3D L = system.bc->getBoxL();
+    for (iterator::CellListIterator cit(system.storage->getRealCells()); !cit.isDone(); ++cit)
+    {
+        Real3D pos = cit->position();
+        if (unfolded)
+        {
+            Int3D& img = cit->image();
+            for (int d = 0; d < 3; d++) pos[d] += img[d] * L[d];
+        }
+        localIds.push_back(cit->id());
+        for (int d = 0; d < 3; d++) localValues.push_back(pos[d]);
+        if (velocities)
+            for (int d = 0; d < 3; d++) localValues.push_back(cit->velocity()[d]);
+    }
+
+    // ids are split into equal ranges, one per rank
+    // min id and -max id, reduced in one go
+    longint idRange[2] = {std::numeric_limits<longint>::max(), std::numeric_limits<longint>::max()};
+    for (longint id : localIds)
+    {
+        idRange[0] = std::min(idRange[0], id);
+        idRange[1] = std::min(idRange[1], -id);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, idRange, 2, idType, MPI_MIN, comm);
+    const longint minId = idRange[0];
+    const longint maxId = -idRange[1];
+    const int64_t blockSize = std::max<int64_t>(int64_t(maxId) - minId, 0) / nProcs + 1;
+
+    // bucket the local particles by destination rank
+    std::vector<int> sendCounts(nProcs, 0), recvCounts(nProcs);
+    for (longint id : localIds) sendCounts[(id - minId) / blockSize]++;
+    std::vector<int> sendDispls(nProcs, 0), recvDispls(nProcs, 0);
+    std::partial_sum(sendCounts.begin(), sendCounts.end() - 1, sendDispls.begin() + 1);
+
+    std::vector<longint> sendIds(localIds.size());
+    std::vector<real> sendValues(localValues.size());
+    std::vector<int> fill(sendDispls);
+    for (size_t i = 0; i < localIds.size(); i++)
+    {
+        int dst = fill[(localIds[i] - minId) / blockSize]++;
+        sendIds[dst] = localIds[i];
+        std::copy_n(&localValues[i * stride], stride, &sendValues[size_t(dst) * stride]);
+    }
+    localIds = std::vector<longint>();
+    localValues = std::vector<real>();
+
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+    std::partial_sum(recvCounts.begin(), recvCounts.end() - 1, recvDispls.begin() + 1);
+    const int numRecv = recvDispls.back() + recvCounts.back();
+
+    std::vector<longint> recvIds(numRecv);
+    MPI_Alltoallv(sendIds.data(), sendCounts.data(), sendDispls.data(), idType, recvIds.data(),
+                  recvCounts.data(), recvDispls.data(), idType, comm);
+
+    for (int p = 0; p < nProcs; p++)
+    {
+        sendCounts[p] *= stride;
+        sendDispls[p] *= stride;
+        recvCounts[p] *= stride;
+        recvDispls[p] *= stride;
+    }
+    std::vector<real> recvValues(size_t(numRecv) * stride);
+    MPI_Alltoallv(sendValues.data(), sendCounts.data(), sendDispls.data(), realType,
+                  recvValues.data(), recvCounts.data(), recvDispls.data(), realType, comm);
+
+    // sort the own id range
+    std::vector<int> order(numRecv);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return recvIds[a] < recvIds[b]; });
+
+    ids.resize(numRecv);
+    values.resize(size_t(numRecv) * stride);
+    for (int i = 0; i < numRecv; i++)
+    {
+        ids[i] = recvIds[order[i]];
+        std::copy_n(&recvValues[size_t(order[i]) * stride], stride, &values[size_t(i) * stride]);
+    }
+
+    int64_t numLocal = numRecv;
+    MPI_Allreduce(&numLocal, &numTotal, 1, MPI_INT64_T, MPI_SUM, comm);
+    MPI_Exscan(&numLocal, &offset, 1, MPI_INT64_T, MPI_SUM, comm);
+    if (system.comm->rank() == 0) offset = 0;
+}
+
+bool appendOrdered(const mpi::communicator& comm, const std::string& fileName,
+                   const std::string& text)
+{
+    MPI_File fh;
+    if (MPI_File_open(comm, fileName.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL,
+                      &fh) != MPI_SUCCESS)
+        return false;
+
+    MPI_Offset fileSize;
+    CHECK_EQUAL(MPI_File_get_size(fh, &fileSize), MPI_SUCCESS);
+
+    int64_t length = int64_t(text.size());
+    int64_t position = 0;
+    MPI_Exscan(&length, &position, 1, MPI_INT64_T, MPI_SUM, comm);
+    if (comm.rank() == 0) position = 0;
+
+    // MPI counts are int, so large blocks go out in several collective rounds
+    const int64_t maxChunk = int64_t(1) << 30;
+    int64_t rounds = (length + maxChunk - 1) / maxChunk;
+    MPI_Allreduce(MPI_IN_PLACE, &rounds, 1, MPI_INT64_T, MPI_MAX, comm);
+    for (int64_t r = 0; r < rounds; r++)
+    {
+        int64_t begin = std::min(r * maxChunk, length);
+        int64_t count = std::min(maxChunk, length - begin);
+        CHECK_EQUAL(MPI_File_write_at_all(fh, fileSize + position + begin, text.data() + begin,
+                                          int(count), MPI_CHAR, MPI_STATUS_IGNORE),
+                    MPI_SUCCESS);
+    }
+
+    CHECK_EQUAL(MPI_File_close(&fh), MPI_SUCCESS);
+    return true;
+}
+
+}  // namespace io
+}  // namespace espressopp
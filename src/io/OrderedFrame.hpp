@@ -0,0 +1,79 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _IO_ORDEREDFRAME_HPP
+#define _IO_ORDEREDFRAME_HPP
+
+#include "mpi.hpp"
+#include "types.hpp"
+#include "System.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace espressopp
+{
+namespace io
+{
+/**
+ * One trajectory frame kept distributed over all ranks in particle id order.
+ *
+ * The real particles are redistributed by id range with a single all-to-all, so that rank r
+ * holds the r-th block of ids, sorted. Concatenating the local blocks in rank order gives the
+ * same id-sorted frame ConfigurationsExt::gather() builds on rank 0, without any rank having
+ * to hold more than its share.
+ */
+class OrderedFrame
+{
+public:
+    OrderedFrame(System& system, bool unfolded, bool velocities);
+
+    /// number of particles held by this rank
+    int64_t getNumLocal() const { return int64_t(ids.size()); }
+    /// number of particles in the frame
+    int64_t getNumTotal() const { return numTotal; }
+    /// position of the first local particle in the id-sorted frame
+    int64_t getOffset() const { return offset; }
+
+    longint getId(int64_t i) const { return ids[i]; }
+    const real* getPosition(int64_t i) const { return &values[i * stride]; }
+    /// only valid if the frame was built with velocities
+    const real* getVelocity(int64_t i) const { return &values[i * stride + 3]; }
+
+private:
+    int stride;  // 3 for positions, 6 with velocities
+    int64_t numTotal;
+    int64_t offset;
+    std::vector<longint> ids;
+    std::vector<real> values;
+};
+
+/**
+ * Collectively append the local \p text of every rank to \p fileName, in rank order, with
+ * MPI-IO. Each rank writes at the end of the file plus the prefix sum of the preceding text
+ * lengths. Returns false if the file could not be opened.
+ */
+bool appendOrdered(const mpi::communicator& comm, const std::string& fileName,
+                   const std::string& text);
+
+}  // namespace io
+}  // namespace espressopp
+
+#endif
@@ -20,7 +20,9 @@
 
 #include "RestoreH5MDParallel.hpp"
 
+#include "bc/BC.hpp"
 #include "iterator/CellListIterator.hpp"
+#include "storage/DomainDecomposition.hpp"
 #include "storage/Storage.hpp"
 
 namespace espressopp
@@ -162,37 +164,104 @@ void RestoreH5MDParallel::restore()
         CHECK_EQUAL(id.size() * 3, force.size());
     }
 
+    CHECK_HDF5(H5Fclose(fileId));
+
+    // pack the slab read from the file into records
+    std::vector<Record> records(id.size());
     for (auto i = 0; i < int_c(id.size()); ++i)
     {
-        auto pos = Real3D(position[i * 3 + 0], position[i * 3 + 1], position[i * 3 + 2]);
-        auto particle = system_->storage->addParticle(int_c(id[i]), pos, false);
+        Record& rec = records[i];
+        rec.id = id[i];
+        rec.type = restoreType ? type[i] : 0;
+        rec.mass = restoreMass ? mass[i] : 0.;
+        rec.q = restoreQ ? q[i] : 0.;
+        rec.ghost = restoreGhost ? ghost[i] : 0;
+        for (int d = 0; d < 3; ++d)
+        {
+            rec.position[d] = position[i * 3 + d];
+            rec.velocity[d] = restoreVelocity ? velocity[i * 3 + d] : 0.;
+            rec.force[d] = restoreForce ? force[i * 3 + d] : 0.;
+        }
+    }
+
+    routeRecords(records);
+
+    for (const auto& rec : records)
+    {
+        auto pos = Real3D(rec.position[0], rec.position[1], rec.position[2]);
+        auto particle = system_->storage->addParticle(int_c(rec.id), pos, false);
         CHECK_NOT_NULLPTR(particle, "particle creation was rejected!");
-        if (restoreId) particle->id() = id[i];
-        if (restoreType) particle->type() = type[i];
-        if (restoreMass) particle->mass() = mass[i];
-        if (restoreQ) particle->q() = q[i];
-        if (restoreGhost) particle->ghost() = ghost[i];
+        if (restoreId) particle->id() = rec.id;
+        if (restoreType) particle->type() = rec.type;
+        if (restoreMass) particle->mass() = rec.mass;
+        if (restoreQ) particle->q() = rec.q;
+        if (restoreGhost) particle->ghost() = rec.ghost;
         if (restorePosition)
         {
-            particle->position()[0] = position[i * 3 + 0];
-            particle->position()[1] = position[i * 3 + 1];
-            particle->position()[2] = position[i * 3 + 2];
+            particle->position()[0] = rec.position[0];
+            particle->position()[1] = rec.position[1];
+            particle->position()[2] = rec.position[2];
         }
         if (restoreVelocity)
         {
-            particle->velocity()[0] = velocity[i * 3 + 0];
-            particle->velocity()[1] = velocity[i * 3 + 1];
-            particle->velocity()[2] = velocity[i * 3 + 2];
+            particle->velocity()[0] = rec.velocity[0];
+            particle->velocity()[1] = rec.velocity[1];
+            particle->velocity()[2] = rec.velocity[2];
         }
         if (restoreForce)
         {
-            particle->force()[0] = force[i * 3 + 0];
-            particle->force()[1] = force[i * 3 + 1];
-            particle->force()[2] = force[i * 3 + 2];
+            particle->force()[0] = rec.force[0];
+            particle->force()[1] = rec.force[1];
+            particle->force()[2] = rec.force[2];
         }
     }
+}
 
-    CHECK_HDF5(H5Fclose(fileId));
+void RestoreH5MDParallel::routeRecords(std::vector<Record>& records)
+{
+    // without a domain decomposition there is no owner to route to, the particles stay where
+    // they were read and have to be moved by the next decompose
+    auto dd = std::dynamic_pointer_cast<storage::DomainDecomposition>(system_->storage);
+    if (!dd) return;
+
+    const mpi::communicator& systemComm = *system_->comm;
+    const int numRanks = systemComm.size();
+
+    // bucket records by the rank owning their folded position
+    std::vector<int> destination(records.size());
+    std::vector<int> sendCounts(numRanks, 0);
+    for (auto i = 0; i < int_c(records.size()); ++i)
+    {
+        Real3D pos(records[i].position[0], records[i].position[1], records[i].position[2]);
+        Int3D image(0);
+        system_->bc->foldPosition(pos, image);
+        destination[i] = int_c(dd->mapPositionToNodeClipped(pos));
+        ++sendCounts[destination[i]];
+    }
+    std::vector<int> sendDispls(numRanks, 0);
+    std::partial_sum(sendCounts.begin(), sendCounts.end() - 1, sendDispls.begin() + 1);
+
+    std::vector<Record> sendBuffer(records.size());
+    std::vector<int> fill(sendDispls);
+    for (auto i = 0; i < int_c(records.size()); ++i)
+    {
+        sendBuffer[fill[destination[i]]++] = records[i];
+    }
+
+    std::vector<int> recvCounts(numRanks);
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, systemComm);
+    std::vector<int> recvDispls(numRanks, 0);
+    std::partial_sum(recvCounts.begin(), recvCounts.end() - 1, recvDispls.begin() + 1);
+
+    MPI_Datatype recordType;
+    MPI_Type_contiguous(int_c(sizeof(Record)), MPI_BYTE, &recordType);
+    MPI_Type_commit(&recordType);
+
+    records.resize(recvDispls.back() + recvCounts.back());
+    MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDispls.data(), recordType,
+                  records.data(), recvCounts.data(), recvDispls.data(), recordType, systemComm);
+
+    MPI_Type_free(&recordType);
 }
 
 void RestoreH5MDParallel::registerPython()
@@ -65,7 +65,22 @@ public:
     static void registerPython();
 
 private:
+    /// one particle as read from the file
+    struct Record
+    {
+        int64_t id;
+        int64_t type;
+        double mass;
+        double q;
+        double position[3];
+        double velocity[3];
+        double force[3];
+        int8_t ghost;
+    };
+
     void updateCache();
+    /// send every record to the rank owning its position, with a single all-to-all
+    void routeRecords(std::vector<Record>& records);
 
     template <typename T>
     void readParallel(hid_t fileId, const std::string& name, std::vector<T>& data);
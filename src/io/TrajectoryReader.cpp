@@ -0,0 +1,315 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include <boost/python/numpy.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "TrajectoryReader.hpp"
+#include "checks.hpp"
+#include "bc/BC.hpp"
+#include "esutil/Error.hpp"
+#include "iterator/CellListIterator.hpp"
+#include "storage/Storage.hpp"
+
+namespace espressopp
+{
+namespace io
+{
+namespace
+{
+inline int64_t unzigzag(uint64_t v) { return int64_t(v >> 1) ^ -int64_t(v & 1); }
+
+inline uint64_t getVarint(const unsigned char*& in, const unsigned char* end)
+{
+    uint64_t v = 0;
+    for (int shift = 0; in < end && shift < 64; shift += 7)
+    {
+        unsigned char b = *in++;
+        v |= uint64_t(b & 0x7f) << shift;
+        if (b < 0x80) return v;
+    }
+    throw std::runtime_error("TrajectoryReader: corrupt block");
+}
+}  // namespace
+
+TrajectoryReader::TrajectoryReader(std::string _filename)
+    : filename(_filename), data(nullptr), size(0), frame(-1)
+{
+    std::ifstream indexFile(filename + ".idx", std::ios::binary | std::ios::ate);
+    if (!indexFile) throw std::runtime_error("TrajectoryReader: cannot open " + filename + ".idx");
+    index.resize(size_t(indexFile.tellg()) / sizeof(DumpCompressed::IndexEntry));
+    indexFile.seekg(0);
+    indexFile.read(reinterpret_cast<char*>(index.data()),
+                   index.size() * sizeof(DumpCompressed::IndexEntry));
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("TrajectoryReader: cannot open " + filename);
+    struct stat st;
+    CHECK_EQUAL(fstat(fd, &st), 0);
+    size = size_t(st.st_size);
+    void* mapped = size ? mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0) : nullptr;
+    close(fd);
+    if (mapped == MAP_FAILED) throw std::runtime_error("TrajectoryReader: cannot map " + filename);
+    data = static_cast<const char*>(mapped);
+
+    for (const DumpCompressed::IndexEntry& entry : index)
+        if (entry.offset < 0 || size_t(entry.offset) + sizeof(DumpCompressed::FrameHeader) > size)
+            throw std::runtime_error("TrajectoryReader: " + filename +
+                                     ".idx points behind the end of the trajectory");
+
+    std::memset(&stream, 0, sizeof(stream));
+    CHECK_EQUAL(inflateInit(&stream), Z_OK);
+}
+
+TrajectoryReader::~TrajectoryReader()
+{
+    inflateEnd(&stream);
+    if (data) munmap(const_cast<char*>(data), size);
+}
+
+DumpCompressed::FrameHeader TrajectoryReader::header(int n) const
+{
+    if (n < 0 || n >= getNumFrames())
+    {
+        std::ostringstream msg;
+        msg << "TrajectoryReader: no frame " << n << " in " << filename;
+        throw std::out_of_range(msg.str());
+    }
+    // frames are not aligned in the file
+    DumpCompressed::FrameHeader h;
+    std::memcpy(&h, data + index[n].offset, sizeof(h));
+    if (std::memcmp(h.magic, "ECTR", 4) != 0)
+        throw std::runtime_error("TrajectoryReader: " + filename +
+                                 " is not a DumpCompressed trajectory");
+    return h;
+}
+
+Real3D TrajectoryReader::getBoxL(int n) const
+{
+    DumpCompressed::FrameHeader h = header(n);
+    return Real3D(h.box[0], h.box[1], h.box[2]);
+}
+
+void TrajectoryReader::splitFrames(int first, int last, int rank, int size, int& begin, int& end)
+{
+    int64_t count = std::max(last - first, 0);
+    begin = first + int(count * rank / size);
+    end = first + int(count * (rank + 1) / size);
+}
+
+void TrajectoryReader::readFrame(int n)
+{
+    if (n < 0) n += getNumFrames();
+    header(n);  // range check
+
+    int start = n;
+    while (start > 0 && !(index[start].flags & DumpCompressed::KEYFRAME)) start--;
+    // continue from the current frame if it is on the way
+    if (frame >= start && frame <= n) start = frame + 1;
+    for (int i = start; i <= n; i++) decode(i);
+}
+
+size_t TrajectoryReader::inflateBlock(const char* in, size_t length)
+{
+    CHECK_EQUAL(inflateReset(&stream), Z_OK);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in));
+    stream.avail_in = uInt(length);
+    if (payload.empty()) payload.resize(size_t(1) << 16);
+
+    size_t produced = 0;
+    for (;;)
+    {
+        stream.next_out = payload.data() + produced;
+        stream.avail_out = uInt(payload.size() - produced);
+        int ret = inflate(&stream, Z_NO_FLUSH);
+        produced = payload.size() - stream.avail_out;
+        if (ret == Z_STREAM_END) return produced;
+        if ((ret != Z_OK && ret != Z_BUF_ERROR) || stream.avail_out != 0)
+            throw std::runtime_error("TrajectoryReader: corrupt block in " + filename);
+        payload.resize(payload.size() * 2);
+    }
+}
+
+void TrajectoryReader::decode(int n)
+{
+    DumpCompressed::FrameHeader h = header(n);
+    const bool key = h.flags & DumpCompressed::KEYFRAME;
+    if (!key && (frame != n - 1 || blockCounts.size() != size_t(h.numBlocks)))
+        throw std::runtime_error("TrajectoryReader: delta frame without its key frame");
+
+    const char* sizes = data + index[n].offset + sizeof(h);
+    const char* block = sizes + h.numBlocks * sizeof(int64_t);
+    if (key)
+    {
+        blockCounts.assign(h.numBlocks, 0);
+        ids.resize(h.numParticles);
+        coords.resize(h.numParticles * 3);
+    }
+
+    int64_t first = 0;  // first particle of the block
+    for (int b = 0; b < h.numBlocks; b++)
+    {
+        int64_t blockSize;
+        std::memcpy(&blockSize, sizes + b * sizeof(int64_t), sizeof(blockSize));
+        if (block + blockSize > data + size)
+            throw std::runtime_error("TrajectoryReader: " + filename + " is truncated");
+        size_t length = inflateBlock(block, size_t(blockSize));
+        block += blockSize;
+
+        const unsigned char* in = payload.data();
+        const unsigned char* end = in + length;
+        int64_t num = unzigzag(getVarint(in, end));
+        if (num < 0 || first + num > int64_t(ids.size()) || (!key && num != blockCounts[b]))
+            throw std::runtime_error("TrajectoryReader: corrupt block in " + filename);
+
+        int64_t* q = coords.data() + first * 3;
+        if (key)
+        {
+            blockCounts[b] = num;
+            longint id = 0;
+            for (int64_t i = 0; i < num; i++)
+            {
+                id += longint(unzigzag(getVarint(in, end)));
+                ids[first + i] = id;
+            }
+            for (int64_t i = 0; i < num * 3; i++)
+                q[i] = (i >= 3 ? q[i - 3] : 0) + unzigzag(getVarint(in, end));
+        }
+        else
+        {
+            for (int64_t i = 0; i < num * 3; i++) q[i] += unzigzag(getVarint(in, end));
+        }
+        first += num;
+    }
+    if (first != int64_t(ids.size()))
+        throw std::runtime_error("TrajectoryReader: corrupt frame in " + filename);
+
+    x.resize(ids.size());
+    y.resize(ids.size());
+    z.resize(ids.size());
+    for (size_t i = 0; i < ids.size(); i++)
+    {
+        x[i] = coords[i * 3] * h.precision;
+        y[i] = coords[i * 3 + 1] * h.precision;
+        z[i] = coords[i * 3 + 2] * h.precision;
+    }
+    frame = n;
+}
+
+void TrajectoryReader::loadFrame(std::shared_ptr<System> system, int n)
+{
+    readFrame(n);
+
+    esutil::Error err(system->comm);
+    int64_t missing = 0;
+    CellList realCells = system->storage->getRealCells();
+    for (iterator::CellListIterator cit(realCells); !cit.isDone(); ++cit)
+    {
+        const longint id = cit->id();
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it == ids.end() || *it != id)
+        {
+            missing++;
+            continue;
+        }
+        size_t i = it - ids.begin();
+        Real3D pos(x[i], y[i], z[i]);
+        Int3D image(0, 0, 0);
+        system->bc->foldPosition(pos, image);
+        cit->position() = pos;
+        cit->image() = image;
+    }
+    if (missing)
+    {
+        std::ostringstream msg;
+        msg << "TrajectoryReader: " << missing << " particles of the system are not in frame " << n;
+        err.setException(msg.str());
+    }
+    err.checkException();
+
+    system->storage->decompose();
+}
+
+// Python wrapping
+namespace
+{
+// read-only numpy views of the current frame, valid until the next readFrame()
+template <class T>
+python::object view(python::object owner, const T* ptr, int64_t n)
+{
+    return python::numpy::from_data(ptr, python::numpy::dtype::get_builtin<T>(),
+                                    python::make_tuple(n), python::make_tuple(sizeof(T)), owner);
+}
+
+python::object idsView(python::object self)
+{
+    const TrajectoryReader& r = python::extract<const TrajectoryReader&>(self);
+    return view(self, r.getIds(), r.getNumParticles());
+}
+python::object xView(python::object self)
+{
+    const TrajectoryReader& r = python::extract<const TrajectoryReader&>(self);
+    return view(self, r.getX(), r.getNumParticles());
+}
+python::object yView(python::object self)
+{
+    const TrajectoryReader& r = python::extract<const TrajectoryReader&>(self);
+    return view(self, r.getY(), r.getNumParticles());
+}
+python::object zView(python::object self)
+{
+    const TrajectoryReader& r = python::extract<const TrajectoryReader&>(self);
+    return view(self, r.getZ(), r.getNumParticles());
+}
+}  // namespace
+
+void TrajectoryReader::registerPython()
+{
+    using namespace espressopp::python;
+
+    Real3D (TrajectoryReader::*pyGetBoxL)() const = &TrajectoryReader::getBoxL;
+
+    class_<TrajectoryReader, std::shared_ptr<TrajectoryReader>, boost::noncopyable>(
+        "io_TrajectoryReader", init<std::string>())
+        .add_property("filename", &TrajectoryReader::getFilename)
+        .add_property("num_frames", &TrajectoryReader::getNumFrames)
+        .add_property("frame", &TrajectoryReader::getFrame)
+        .add_property("step", &TrajectoryReader::getCurrentStep)
+        .add_property("time", &TrajectoryReader::getTime)
+        .add_property("box", pyGetBoxL)
+        .add_property("num_particles", &TrajectoryReader::getNumParticles)
+        .add_property("ids", &idsView)
+        .add_property("x", &xView)
+        .add_property("y", &yView)
+        .add_property("z", &zView)
+        .def("getStep", &TrajectoryReader::getStep)
+        .def("readFrame", &TrajectoryReader::readFrame)
+        .def("loadFrame", &TrajectoryReader::loadFrame);
+}
+}  // namespace io
+}  // namespace espressopp
@@ -0,0 +1,112 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef _IO_TRAJECTORYREADER_HPP
+#define _IO_TRAJECTORYREADER_HPP
+
+#include "types.hpp"
+#include "System.hpp"
+#include "DumpCompressed.hpp"
+#include <zlib.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace espressopp
+{
+namespace io
+{
+/**
+ * Reads the frames of a DumpCompressed trajectory from a read-only memory mapping.
+ *
+ * The reader is local to its rank and does not communicate, so every rank can work on its own
+ * range of frames. The current frame is held as structure of arrays (ids, x, y, z) sorted by
+ * id. The blocks are inflated straight from the mapped pages into buffers that are reused from
+ * frame to frame, so reading a frame allocates nothing once the buffers have their size.
+ * Reading the frames in order decodes every frame once; any other frame is decoded from the
+ * preceding key frame on.
+ */
+class TrajectoryReader
+{
+public:
+    TrajectoryReader(std::string _filename);
+    ~TrajectoryReader();
+
+    std::string getFilename() const { return filename; }
+
+    int getNumFrames() const { return int(index.size()); }
+    int64_t getStep(int n) const { return index.at(n).step; }
+
+    /// make frame n the current frame, negative n count from the end
+    void readFrame(int n);
+
+    /// number of the current frame, -1 before the first readFrame()
+    int getFrame() const { return frame; }
+    int64_t getCurrentStep() const { return header().step; }
+    real getTime() const { return header().time; }
+    Real3D getBoxL() const { return getBoxL(frame); }
+    /// box of frame n, read from its header only
+    Real3D getBoxL(int n) const;
+    int64_t getNumParticles() const { return int64_t(ids.size()); }
+
+    const longint* getIds() const { return ids.data(); }
+    const real* getX() const { return x.data(); }
+    const real* getY() const { return y.data(); }
+    const real* getZ() const { return z.data(); }
+
+    /// first and last+1 frame of an even split of [first, last) over size ranks
+    static void splitFrames(int first, int last, int rank, int size, int& begin, int& end);
+
+    /**
+     * Collectively set the positions of the particles of system to frame n and redistribute
+     * them, so that any analysis of the system sees that frame. The particles are looked up by
+     * id and all of them have to be in the frame.
+     */
+    void loadFrame(std::shared_ptr<System> system, int n);
+
+    static void registerPython();
+
+private:
+    DumpCompressed::FrameHeader header() const { return header(frame); }
+    DumpCompressed::FrameHeader header(int n) const;
+    void decode(int n);
+    size_t inflateBlock(const char* in, size_t size);
+
+    std::string filename;
+    const char* data;  // mapped trajectory
+    size_t size;
+    std::vector<DumpCompressed::IndexEntry> index;
+
+    int frame;
+    // current frame, sorted by id
+    std::vector<longint> ids;
+    std::vector<real> x, y, z;
+    // quantized positions and particles per block, the reference of the next delta frame
+    std::vector<int64_t> coords;
+    std::vector<int64_t> blockCounts;
+
+    z_stream stream;
+    std::vector<unsigned char> payload;
+};
+}  // namespace io
+}  // namespace espressopp
+
+#endif
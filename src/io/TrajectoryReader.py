@@ -0,0 +1,106 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+******************************
+espressopp.io.TrajectoryReader
+******************************
+
+Memory-mapped reader for trajectories written by
+:py:class:`espressopp.io.DumpCompressed`, for analysis after the run.
+
+The file is mapped read-only and every process has a reader of its own,
+which does not communicate. The current frame is kept as separate arrays of
+ids and x, y, z coordinates, sorted by id. The buffers are reused from frame
+to frame, so scanning a trajectory does not allocate per frame. Reading the
+frames in order decodes each frame once. Any other frame is decoded from the
+preceding key frame on, see ``keyframe_interval`` of the writer.
+
+The frames can be fed to the analysis classes in three ways:
+
+* :py:meth:`espressopp.analysis.RadialDistrF.computeTrajectory` and
+  :py:meth:`espressopp.analysis.StaticStructF.computeTrajectory` split the
+  frames over the processes and reduce the result once.
+* :py:meth:`espressopp.analysis.ConfigsParticleDecomp.gatherFromTrajectory`
+  takes the snapshots of :py:class:`espressopp.analysis.MeanSquareDispl`
+  straight from the trajectory.
+* :py:meth:`loadFrame` sets the particles of a system to a frame. After that
+  every analysis of the system, e.g. OrderParameter, sees that frame.
+
+.. function:: espressopp.io.TrajectoryReader(filename)
+
+    :param str filename: trajectory file, the index ``filename.idx`` has to exist
+
+.. function:: espressopp.io.TrajectoryReader.readFrame(frame)
+
+    make ``frame`` the current frame, negative numbers count from the end
+
+.. function:: espressopp.io.TrajectoryReader.loadFrame(system, frame)
+
+    Collectively set the positions of the particles of ``system`` to
+    ``frame``. All particles of the system have to be in the frame.
+
+.. function:: espressopp.io.TrajectoryReader.getStep(frame)
+
+    integrator step of ``frame``, taken from the index
+
+**Properties** (read-only, of the current frame)
+
+* `num_frames`, `frame`, `step`, `time`, `box`, `num_particles`
+
+* `ids`, `x`, `y`, `z`
+  read-only numpy views of the buffers of the reader, without a copy. They
+  change with the next ``readFrame``, so copy them to keep a frame.
+
+Example:
+
+>>> reader = espressopp.io.TrajectoryReader('traj.ctr')
+>>> rdf = espressopp.analysis.RadialDistrF(system)
+>>> g = rdf.computeTrajectory(reader, 200)
+>>>
+>>> msd = espressopp.analysis.MeanSquareDispl(system)
+>>> for frame in range(reader.num_frames):
+>>>     msd.gatherFromTrajectory(reader, frame)
+>>> result = msd.compute()
+>>>
+>>> reader.readFrame(-1)
+>>> center = (reader.x.mean(), reader.y.mean(), reader.z.mean())
+"""
+
+from espressopp.esutil import cxxinit
+from espressopp import pmi
+
+from _espressopp import io_TrajectoryReader
+
+class TrajectoryReaderLocal(io_TrajectoryReader):
+
+    def __init__(self, filename):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, io_TrajectoryReader, filename)
+
+
+if pmi.isController :
+    class TrajectoryReader(object, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+          cls =  'espressopp.io.TrajectoryReaderLocal',
+          pmicall = [ 'readFrame', 'loadFrame' ],
+          localcall = [ 'getStep' ],
+          pmiproperty = [ 'filename', 'num_frames', 'frame', 'step', 'time', 'box', 'num_particles',
+                          'ids', 'x', 'y', 'z' ]
+        )
@@ -41,5 +41,8 @@ except ImportError:
 from espressopp.io.DumpH5MD import *
 from espressopp.io.DumpH5MDParallel import *
 from espressopp.io.DumpTopology import *
+from espressopp.io.DumpCompressed import *
+from espressopp.io.TrajectoryReader import *
 
 from espressopp.io.RestoreH5MDParallel import *
+from espressopp.io.Checkpoint import *
@@ -25,6 +25,8 @@
 */
 
 #include "bindings.hpp"
+#include "Checkpoint.hpp"
+#include "DumpCompressed.hpp"
 #include "DumpXYZ.hpp"
 #include "DumpGRO.hpp"
 #include "DumpGROAdress.hpp"
@@ -33,6 +35,7 @@
 #include "DumpTopology.hpp"
 #include "FileBackup.hpp"
 #include "RestoreH5MDParallel.hpp"
+#include "TrajectoryReader.hpp"
 
 #ifdef HAS_GROMACS
 #include "DumpXTC.hpp"
@@ -51,11 +54,14 @@ void registerPython()
     DumpH5MD::registerPython();
     DumpH5MDParallel::registerPython();
     DumpTopology::registerPython();
+    DumpCompressed::registerPython();
 #ifdef HAS_GROMACS
     DumpXTC::registerPython();
     DumpXTCAdress::registerPython();
 #endif
     RestoreH5MDParallel::registerPython();
+    Checkpoint::registerPython();
+    TrajectoryReader::registerPython();
 }
 }  // namespace io
 }  // namespace espressopp
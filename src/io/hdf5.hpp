@@ -23,6 +23,9 @@
 #include "checks.hpp"
 #include <hdf5.h>
 #include <hdf5_hl.h>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 namespace espressopp
 {
@@ -70,5 +73,199 @@ auto CHECK_HDF5(const T& status)
     return status;
 }
 
+inline hid_t createParallelFile(const std::string& filename, MPI_Comm comm)
+{
+    auto plist = CHECK_HDF5(H5Pcreate(H5P_FILE_ACCESS));
+    CHECK_HDF5(H5Pset_fapl_mpio(plist, comm, MPI_INFO_NULL));
+    auto fileId = CHECK_HDF5(H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist));
+    CHECK_HDF5(H5Pclose(plist));
+    return fileId;
+}
+
+inline hid_t openParallelFile(const std::string& filename, MPI_Comm comm)
+{
+    auto plist = CHECK_HDF5(H5Pcreate(H5P_FILE_ACCESS));
+    CHECK_HDF5(H5Pset_fapl_mpio(plist, comm, MPI_INFO_NULL));
+    auto fileId = CHECK_HDF5(H5Fopen(filename.c_str(), H5F_ACC_RDONLY, plist));
+    CHECK_HDF5(H5Pclose(plist));
+    return fileId;
+}
+
+/// dimensions of an existing dataset
+inline std::vector<hsize_t> getDatasetDims(hid_t fileId, const std::string& name)
+{
+    auto dataset = CHECK_HDF5(H5Dopen(fileId, name.c_str(), H5P_DEFAULT));
+    auto space = CHECK_HDF5(H5Dget_space(dataset));
+    std::vector<hsize_t> dims(CHECK_HDF5(H5Sget_simple_extent_ndims(space)));
+    CHECK_HDF5(H5Sget_simple_extent_dims(space, dims.data(), nullptr));
+    CHECK_HDF5(H5Sclose(space));
+    CHECK_HDF5(H5Dclose(dataset));
+    return dims;
+}
+
+/**
+ * Collectively create dataset \p name of shape \p globalDims and write the local block
+ * \p data of shape \p localDims at \p offset. Every rank has to take part, ranks without
+ * data pass empty blocks. A \p compression level > 0 stores the dataset deflated in
+ * chunks of \p chunkDims.
+ */
+template <typename T>
+void writeHyperslab(hid_t fileId,
+                    const std::string& name,
+                    const std::vector<hsize_t>& globalDims,
+                    const std::vector<hsize_t>& offset,
+                    const std::vector<hsize_t>& localDims,
+                    const std::vector<T>& data,
+                    int compression = 0,
+                    const std::vector<hsize_t>& chunkDims = {})
+{
+    CHECK_EQUAL(globalDims.size(), localDims.size());
+    CHECK_EQUAL(globalDims.size(), offset.size());
+    hsize_t localSize = 1;
+    hsize_t globalSize = 1;
+    for (size_t i = 0; i < globalDims.size(); ++i)
+    {
+        CHECK_LESS_EQUAL(localDims[i] + offset[i], globalDims[i], "i = " << i);
+        localSize *= localDims[i];
+        globalSize *= globalDims[i];
+    }
+    CHECK_EQUAL(data.size(), localSize);
+
+    auto createList = CHECK_HDF5(H5Pcreate(H5P_DATASET_CREATE));
+    if (compression > 0 && globalSize > 0)
+    {
+        CHECK_EQUAL(chunkDims.size(), globalDims.size());
+        CHECK_HDF5(H5Pset_chunk(createList, int(chunkDims.size()), chunkDims.data()));
+        CHECK_HDF5(H5Pset_deflate(createList, unsigned(compression)));
+    }
+
+    auto dataspace =
+        CHECK_HDF5(H5Screate_simple(int(globalDims.size()), globalDims.data(), nullptr));
+    auto dataset = CHECK_HDF5(H5Dcreate(fileId, name.c_str(), typeToHDF5<T>(), dataspace,
+                                        H5P_DEFAULT, createList, H5P_DEFAULT));
+
+    auto dstSpace = CHECK_HDF5(H5Dget_space(dataset));
+    auto srcSpace =
+        CHECK_HDF5(H5Screate_simple(int(localDims.size()), localDims.data(), nullptr));
+    if (localSize > 0)
+    {
+        CHECK_HDF5(H5Sselect_hyperslab(dstSpace, H5S_SELECT_SET, offset.data(), nullptr,
+                                       localDims.data(), nullptr));
+    }
+    else
+    {
+        CHECK_HDF5(H5Sselect_none(dstSpace));
+        CHECK_HDF5(H5Sselect_none(srcSpace));
+    }
+
+    auto datawrite = CHECK_HDF5(H5Pcreate(H5P_DATASET_XFER));
+    CHECK_HDF5(H5Pset_dxpl_mpio(datawrite, H5FD_MPIO_COLLECTIVE));
+    CHECK_HDF5(H5Dwrite(dataset, typeToHDF5<T>(), srcSpace, dstSpace, datawrite, data.data()));
+
+    CHECK_HDF5(H5Pclose(datawrite));
+    CHECK_HDF5(H5Sclose(srcSpace));
+    CHECK_HDF5(H5Sclose(dstSpace));
+    CHECK_HDF5(H5Dclose(dataset));
+    CHECK_HDF5(H5Sclose(dataspace));
+    CHECK_HDF5(H5Pclose(createList));
+}
+
+/**
+ * Read the block of shape \p localDims at \p offset of dataset \p name into \p data.
+ * Uses independent I/O, so ranks may call it any number of times.
+ */
+template <typename T>
+void readHyperslab(hid_t fileId,
+                   const std::string& name,
+                   const std::vector<hsize_t>& offset,
+                   const std::vector<hsize_t>& localDims,
+                   std::vector<T>& data)
+{
+    CHECK_EQUAL(offset.size(), localDims.size());
+    hsize_t localSize = 1;
+    for (auto dim : localDims) localSize *= dim;
+    data.resize(localSize);
+    if (localSize == 0) return;
+
+    auto dataset = CHECK_HDF5(H5Dopen(fileId, name.c_str(), H5P_DEFAULT));
+    auto dstSpace = CHECK_HDF5(H5Dget_space(dataset));
+    CHECK_HDF5(H5Sselect_hyperslab(dstSpace, H5S_SELECT_SET, offset.data(), nullptr,
+                                   localDims.data(), nullptr));
+    auto srcSpace =
+        CHECK_HDF5(H5Screate_simple(int(localDims.size()), localDims.data(), nullptr));
+    CHECK_HDF5(H5Dread(dataset, typeToHDF5<T>(), srcSpace, dstSpace, H5P_DEFAULT, data.data()));
+
+    CHECK_HDF5(H5Sclose(srcSpace));
+    CHECK_HDF5(H5Sclose(dstSpace));
+    CHECK_HDF5(H5Dclose(dataset));
+}
+
+/**
+ * Append one frame of shape \p frameDims to dataset \p name, growing it along an unlimited
+ * leading dimension. The dataset is created on the first call. Meant for a single writer,
+ * so the file may be opened without an MPI-IO driver.
+ */
+template <typename T>
+void appendFrame(hid_t fileId,
+                 const std::string& name,
+                 const std::vector<hsize_t>& frameDims,
+                 const std::vector<T>& data,
+                 int compression = 0)
+{
+    hsize_t frameSize = 1;
+    for (auto dim : frameDims) frameSize *= dim;
+    CHECK_EQUAL(data.size(), frameSize);
+
+    std::vector<hsize_t> dims(1, 0);
+    dims.insert(dims.end(), frameDims.begin(), frameDims.end());
+    const int rank = int(dims.size());
+
+    hid_t dataset;
+    if (CHECK_HDF5(H5Lexists(fileId, name.c_str(), H5P_DEFAULT)) > 0)
+    {
+        dataset = CHECK_HDF5(H5Dopen(fileId, name.c_str(), H5P_DEFAULT));
+        auto space = CHECK_HDF5(H5Dget_space(dataset));
+        CHECK_EQUAL(CHECK_HDF5(H5Sget_simple_extent_ndims(space)), rank);
+        CHECK_HDF5(H5Sget_simple_extent_dims(space, dims.data(), nullptr));
+        CHECK_HDF5(H5Sclose(space));
+    }
+    else
+    {
+        std::vector<hsize_t> maxDims(dims);
+        maxDims[0] = H5S_UNLIMITED;
+        // bundle small frames so that a chunk holds at least ~1k values
+        std::vector<hsize_t> chunkDims(dims);
+        chunkDims[0] = std::max<hsize_t>(1, 1024 / std::max<hsize_t>(1, frameSize));
+        for (size_t i = 1; i < chunkDims.size(); ++i)
+            chunkDims[i] = std::max<hsize_t>(1, dims[i]);
+
+        auto createList = CHECK_HDF5(H5Pcreate(H5P_DATASET_CREATE));
+        CHECK_HDF5(H5Pset_chunk(createList, rank, chunkDims.data()));
+        if (compression > 0) CHECK_HDF5(H5Pset_deflate(createList, unsigned(compression)));
+        auto space = CHECK_HDF5(H5Screate_simple(rank, dims.data(), maxDims.data()));
+        dataset = CHECK_HDF5(H5Dcreate(fileId, name.c_str(), typeToHDF5<T>(), space,
+                                       H5P_DEFAULT, createList, H5P_DEFAULT));
+        CHECK_HDF5(H5Sclose(space));
+        CHECK_HDF5(H5Pclose(createList));
+    }
+
+    std::vector<hsize_t> offset(rank, 0);
+    offset[0] = dims[0];
+    dims[0] += 1;
+    CHECK_HDF5(H5Dset_extent(dataset, dims.data()));
+
+    std::vector<hsize_t> count(dims);
+    count[0] = 1;
+    auto dstSpace = CHECK_HDF5(H5Dget_space(dataset));
+    CHECK_HDF5(H5Sselect_hyperslab(dstSpace, H5S_SELECT_SET, offset.data(), nullptr,
+                                   count.data(), nullptr));
+    auto srcSpace = CHECK_HDF5(H5Screate_simple(rank, count.data(), nullptr));
+    CHECK_HDF5(H5Dwrite(dataset, typeToHDF5<T>(), srcSpace, dstSpace, H5P_DEFAULT, data.data()));
+
+    CHECK_HDF5(H5Sclose(srcSpace));
+    CHECK_HDF5(H5Sclose(dstSpace));
+    CHECK_HDF5(H5Dclose(dataset));
+}
+
 }  // namespace io
 }  // namespace espressopp
\ No newline at end of file
@@ -79,9 +79,6 @@ DomainDecompositionAdress::DomainDecompositionAdress(std::shared_ptr<System> _sy
 
 void DomainDecompositionAdress::createCellGrid(const Int3D& _nodeGrid, const Int3D& _cellGrid)
 {
-    real myLeft[3];
-    real myRight[3];
-
     nodeGrid = NodeGrid(_nodeGrid, getSystem()->comm->rank(), getSystem()->bc->getBoxL());
 
     if (nodeGrid.getNumberOfCells() != getSystem()->comm->size())
@@ -101,6 +98,14 @@ void DomainDecompositionAdress::createCellGrid(const Int3D& _nodeGrid, const Int
                                             << nodeGrid.getNodeNeighborIndex(4) << "<->"
                                             << nodeGrid.getNodeNeighborIndex(5));
 
+    createCellGrid(_cellGrid);
+}
+
+void DomainDecompositionAdress::createCellGrid(const Int3D& _cellGrid)
+{
+    real myLeft[3];
+    real myRight[3];
+
     for (int i = 0; i < 3; ++i)
     {
         myLeft[i] = nodeGrid.getMyLeft(i);
@@ -239,6 +244,93 @@ void DomainDecompositionAdress::cellAdjust(bool withShear = false)
     onParticlesChanged();
 }
 
+void DomainDecompositionAdress::setNodeBoundaries(int axis, const std::vector<real>& bounds)
+{
+    if (axis < 0 || axis > 2)
+    {
+        throw std::invalid_argument("setNodeBoundaries: axis has to be 0, 1 or 2");
+    }
+    if (bounds.size() != static_cast<size_t>(nodeGrid.getGridSize(axis) + 1))
+    {
+        throw std::invalid_argument("setNodeBoundaries: need node grid size + 1 boundaries");
+    }
+
+    real boxL = getSystem()->bc->getBoxL()[axis];
+    real rc_skin = getSystem()->maxCutoff + getSystem()->getSkin();
+    real tol = 1e-6 * boxL;
+    if (std::fabs(bounds.front()) > tol || std::fabs(bounds.back() - boxL) > tol)
+    {
+        throw std::invalid_argument("setNodeBoundaries: boundaries have to span the box");
+    }
+    for (size_t k = 1; k < bounds.size(); ++k)
+    {
+        if (bounds[k] - bounds[k - 1] < rc_skin)
+        {
+            throw std::invalid_argument(
+                "setNodeBoundaries: domains have to be at least cutoff + skin wide");
+        }
+    }
+
+    std::vector<real> newBounds(bounds);
+    newBounds.front() = 0.0;
+    newBounds.back() = boxL;
+    Int3D _newCellGrid = getInt3DCellGrid();
+
+    // save all particles to temporary vector
+    std::vector<ParticleList> tmp_pl;
+    tmp_pl.reserve(realCells.size());
+    for (CellList::Iterator it(realCells); it.isValid(); ++it)
+    {
+        tmp_pl.push_back((*it)->particles);
+    }
+
+    // reset all cells info
+    invalidateGhosts();
+    cells.clear();
+    localCells.clear();
+    realCells.clear();
+    ghostCells.clear();
+    for (int i = 0; i < 6; i++)
+    {
+        commCells[i].reals.clear();
+        commCells[i].ghosts.clear();
+    }
+
+    // only the cell count along axis changes, so neighbouring domains still share faces;
+    // it is sized like tools.decomp.cellGrid does for the constructor, honouring halfCellInt
+    nodeGrid.setBoundaries(axis, newBounds);
+    int nCells = static_cast<int>(nodeGrid.getLocalBoxSize(axis) * halfCellInt / rc_skin);
+    _newCellGrid[axis] = std::max(1, nCells);
+    if (nodeGrid.getGridSize(axis) * _newCellGrid[axis] == 1)
+    {
+        // same adjustment as the Python constructor makes for a single cell along axis
+        _newCellGrid[axis] = 2;
+    }
+
+    createCellGrid(_newCellGrid);
+    initCellInteractions();
+    prepareGhostCommunication();
+
+    // particles outside the new domain are parked in the border cells and handed on below
+    for (size_t i = 0; i < tmp_pl.size(); i++)
+    {
+        for (size_t p = 0; p < tmp_pl[i].size(); ++p)
+        {
+            Particle& part = tmp_pl[i][p];
+            Cell* sortCell = mapPositionToCellClipped(part.position());
+            appendUnindexedParticle(sortCell->particles, part);
+        }
+    }
+
+    for (CellList::Iterator it(realCells); it.isValid(); ++it)
+    {
+        updateLocalParticles((*it)->particles);
+    }
+
+    // moves outliers with their tuples and rebuilds tuples, ghosts and verlet lists
+    decompose();
+}
+
 Int3D DomainDecompositionAdress::getInt3DCellGrid()
 {
     return Int3D(cellGrid.getGridSize(0), cellGrid.getGridSize(1), cellGrid.getGridSize(2));
@@ -1300,6 +1392,24 @@ public:
 //////////////////////////////////////////////////
 // REGISTRATION WITH PYTHON
 //////////////////////////////////////////////////
+namespace
+{
+python::list getNodeBoundariesPy(DomainDecompositionAdress& dd, int axis)
+{
+    python::list bounds;
+    std::vector<real> b = dd.getNodeBoundaries(axis);
+    for (size_t k = 0; k < b.size(); ++k) bounds.append(b[k]);
+    return bounds;
+}
+
+void setNodeBoundariesPy(DomainDecompositionAdress& dd, int axis, python::list bounds)
+{
+    std::vector<real> b(python::len(bounds));
+    for (size_t k = 0; k < b.size(); ++k) b[k] = python::extract<real>(bounds[k]);
+    dd.setNodeBoundaries(axis, b);
+}
+}  // namespace
+
 void DomainDecompositionAdress::registerPython()
 {
     using namespace espressopp::python;
@@ -1308,7 +1418,9 @@ void DomainDecompositionAdress::registerPython()
         init<std::shared_ptr<System>, const Int3D&, const Int3D&, int>())
         .def("mapPositionToNodeClipped", &DomainDecompositionAdress::mapPositionToNodeClipped)
         .def("getCellGrid", &DomainDecompositionAdress::getInt3DCellGrid)
-        .def("cellAdjust", &DomainDecompositionAdress::cellAdjust);
+        .def("cellAdjust", &DomainDecompositionAdress::cellAdjust)
+        .def("getNodeBoundaries", &getNodeBoundariesPy)
+        .def("setNodeBoundaries", &setNodeBoundariesPy);
 }
 
 }  // namespace storage
@@ -59,6 +59,14 @@ public:
     // as a consequence of the system resizing
     virtual void cellAdjust(bool withShear);
 
+    /** Move the node boundaries along axis (nodeGrid size + 1 values from 0
+        to the box length) and regrid the local cells accordingly. Particles
+        that end up in another domain are handed over together with their
+        AT particles by a regular decompose(). Every slab has to be at least
+        one cutoff + skin wide. cellAdjust() restores the even split. */
+    void setNodeBoundaries(int axis, const std::vector<real>& bounds);
+    std::vector<real> getNodeBoundaries(int axis) const { return nodeGrid.getBoundaries(axis); }
+
     virtual Cell* mapPositionToCell(const Real3D& pos);
     virtual Cell* mapPositionToCellClipped(const Real3D& pos);
     virtual Cell* mapPositionToCellChecked(const Real3D& pos);
@@ -137,6 +145,8 @@ protected:
     void remapNeighbourCells(int cell_shift);
     /// set the grids and allocate space accordingly
     void createCellGrid(const Int3D& nodeGrid, const Int3D& cellGrid);
+    /// set up the local cells for cellGrid on the current node grid
+    void createCellGrid(const Int3D& cellGrid);
     /// sort cells into local/ghost cell arrays
     void markCells();
     /// fill a list of cells with the cells from a certain region of the domain grid
@@ -47,6 +47,25 @@ Example - setting DomainDecompositionAdress:
                 :type nodeGrid:
                 :type cellGrid:
                 :type halfCellInt: int
+
+.. function:: espressopp.storage.DomainDecompositionAdress.getNodeBoundaries(axis)
+
+                :param axis: 0, 1 or 2
+                :type axis: int
+                :rtype: list of the nodeGrid[axis]+1 domain boundaries along axis
+
+.. function:: espressopp.storage.DomainDecompositionAdress.setNodeBoundaries(axis, bounds)
+
+                Moves the domain boundaries along axis at runtime and migrates
+                particles (together with their AT particles) to their new owners.
+                The first and last value have to be 0 and the box length, and each
+                domain has to be at least cutoff + skin wide. A later cellAdjust()
+                restores the even split. See also :class:`espressopp.integrator.AdressLoadBalance`.
+
+                :param axis: 0, 1 or 2
+                :param bounds: nodeGrid[axis]+1 increasing positions
+                :type axis: int
+                :type bounds: list of real
 """
 
 from espressopp import pmi
@@ -70,7 +89,7 @@ if pmi.isController:
     class DomainDecompositionAdress(Storage):
         pmiproxydefs = dict(
             cls = 'espressopp.storage.DomainDecompositionAdressLocal',
-            pmicall = ['getCellGrid', 'cellAdjust']
+            pmicall = ['getCellGrid', 'cellAdjust', 'getNodeBoundaries', 'setNodeBoundaries']
             )
         def __init__(self, system, nodeGrid='auto', cellGrid='auto', halfCellInt='auto', nocheck=False):
             if nocheck:
@@ -22,6 +22,7 @@
 
 #include "log4espp.hpp"
 
+#include <algorithm>
 #include "Real3D.hpp"
 #include "Int3D.hpp"
 #include "NodeGrid.hpp"
@@ -61,6 +62,15 @@ longint NodeGrid::mapPositionToNodeClipped(const Real3D& pos) const
 
     for (int i = 0; i < 3; ++i)
     {
+        if (!nodeBounds[i].empty())
+        {
+            // inner boundaries only, so that positions outside are clipped to the outer nodes
+            std::vector<real>::const_iterator first = nodeBounds[i].begin() + 1;
+            std::vector<real>::const_iterator last = nodeBounds[i].end() - 1;
+            cpos[i] = static_cast<int>(std::upper_bound(first, last, pos[i]) - first);
+            continue;
+        }
+
         cpos[i] = static_cast<int>(pos[i] * invLocalBoxSize[i]);
         if (cpos[i] < 0)
         {
@@ -74,6 +84,39 @@ longint NodeGrid::mapPositionToNodeClipped(const Real3D& pos) const
     return mapPositionToIndex(cpos);
 }
 
+void NodeGrid::setBoundaries(int axis, const std::vector<real>& bounds)
+{
+    if (bounds.size() != static_cast<size_t>(getGridSize(axis) + 1))
+    {
+        throw std::invalid_argument("node boundaries need one entry more than nodes");
+    }
+    for (size_t k = 1; k < bounds.size(); ++k)
+    {
+        if (bounds[k] <= bounds[k - 1])
+        {
+            throw std::invalid_argument("node boundaries have to be strictly increasing");
+        }
+    }
+
+    nodeBounds[axis] = bounds;
+    localBoxSize[axis] = bounds[nodePos[axis] + 1] - bounds[nodePos[axis]];
+    invLocalBoxSize[axis] = 1.0 / localBoxSize[axis];
+    smallestLocalBoxDiameter =
+        std::min(std::min(localBoxSize[0], localBoxSize[1]), localBoxSize[2]);
+
+    LOG4ESPP_DEBUG(logger, "node boundaries along " << axis << " set, local box "
+                                                    << getMyLeft(axis) << "-" << getMyRight(axis));
+}
+
+std::vector<real> NodeGrid::getBoundaries(int axis) const
+{
+    if (!nodeBounds[axis].empty()) return nodeBounds[axis];
+
+    std::vector<real> bounds(getGridSize(axis) + 1);
+    for (int k = 0; k <= getGridSize(axis); ++k) bounds[k] = k * localBoxSize[axis];
+    return bounds;
+}
+
 void NodeGrid::calcNodeNeighbors(longint node)
 {
     Int3D nPos;
@@ -29,6 +29,7 @@
 */
 
 #include <stdexcept>
+#include <vector>
 #include "types.hpp"
 #include "logging.hpp"
 #include "esutil/Grid.hpp"
@@ -84,11 +85,19 @@ public:
     real getInverseLocalBoxSize(int axis) const { return invLocalBoxSize[axis]; }
 
     /// calculate start of local box
-    real getMyLeft(int axis) const { return nodePos[axis] * localBoxSize[axis]; }
+    real getMyLeft(int axis) const
+    {
+        return nodeBounds[axis].empty() ? nodePos[axis] * localBoxSize[axis]
+                                        : nodeBounds[axis][nodePos[axis]];
+    }
     Real3D getMyLeft() const { return Real3D(getMyLeft(0), getMyLeft(1), getMyLeft(2)); }
 
     /// calculate end of local box
-    real getMyRight(int axis) const { return (nodePos[axis] + 1) * localBoxSize[axis]; }
+    real getMyRight(int axis) const
+    {
+        return nodeBounds[axis].empty() ? (nodePos[axis] + 1) * localBoxSize[axis]
+                                        : nodeBounds[axis][nodePos[axis] + 1];
+    }
     Real3D getMyRight() const { return Real3D(getMyRight(0), getMyRight(1), getMyRight(2)); }
 
     Real3D getMyCenter() const
@@ -112,6 +121,13 @@ public:
 
     static const int numNodeNeighbors = Back + 1;
 
+    /** use uneven node boundaries along axis. bounds holds getGridSize(axis)+1
+        increasing positions starting at 0 and ending at the box length; node i
+        owns [bounds[i], bounds[i+1]). All nodes have to agree on the bounds. */
+    void setBoundaries(int axis, const std::vector<real>& bounds);
+    /// node boundaries along axis, getGridSize(axis)+1 values
+    std::vector<real> getBoundaries(int axis) const;
+
     void scaleVolume(real s)
     {
         if (s > 0)
@@ -120,6 +136,7 @@ public:
             {
                 localBoxSize[i] *= s;
                 invLocalBoxSize[i] /= s;
+                for (size_t k = 0; k < nodeBounds[i].size(); ++k) nodeBounds[i][k] *= s;
             }
             smallestLocalBoxDiameter *= s;
         }
@@ -137,6 +154,7 @@ public:
             {
                 localBoxSize[i] *= s[i];
                 invLocalBoxSize[i] /= s[i];
+                for (size_t k = 0; k < nodeBounds[i].size(); ++k) nodeBounds[i][k] *= s[i];
             }
             smallestLocalBoxDiameter =
                 std::min(std::min(localBoxSize[0], localBoxSize[1]), localBoxSize[2]);
@@ -166,6 +184,9 @@ private:
     /// smallest diameter of the local box
     real smallestLocalBoxDiameter;
 
+    /// uneven node boundaries per axis, empty if the box is split evenly
+    std::vector<real> nodeBounds[3];
+
     static LOG4ESPP_DECL_LOGGER(logger);
 };
 }  // namespace storage
@@ -24,6 +24,7 @@ import espressopp.tools.init_cfg
 
 from espressopp.tools.loadbal import *
 from espressopp.tools.analyse import *
+from espressopp.tools.ctr import *
 from espressopp.tools.decomp import *
 from espressopp.tools.DumpConfigurations import *
 from espressopp.tools.energy import *
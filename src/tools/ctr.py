@@ -0,0 +1,121 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+****************************************************
+ctr - read trajectories written by io.DumpCompressed
+****************************************************
+
+.. function:: espressopp.tools.CTRReader(filename)
+
+  Random access to the frames of a compressed trajectory. The frame offsets
+  are taken from the index file ``filename.idx``. Reading a frame decodes it
+  from the preceding key frame on; reading the frames in order decodes every
+  frame once.
+
+  :param filename: trajectory file name
+  :type filename: string
+
+  ``len(reader)`` is the number of frames, ``reader.steps`` the integrator
+  step of each frame.
+
+.. function:: espressopp.tools.CTRReader.read(frame)
+
+  Returns step, time, box, ids, positions of the frame, where ids is an
+  integer array sorted by particle id and positions an array of shape (N, 3).
+  The positions are unfolded if the trajectory was written unfolded and
+  accurate up to half the precision.
+
+>>> reader = espressopp.tools.CTRReader('traj.ctr')
+>>> step, time, box, ids, pos = reader.read(len(reader) - 1)
+>>> for step, time, box, ids, pos in reader:
+>>>     ...
+"""
+
+import zlib
+import numpy as np
+
+_header_dtype = np.dtype([('magic', 'S4'), ('numBlocks', '<i4'), ('step', '<i8'),
+                          ('time', '<f8'), ('box', '<f8', 3), ('precision', '<f8'),
+                          ('numParticles', '<i8'), ('flags', '<i4'), ('reserved', '<i4')])
+_index_dtype = np.dtype([('offset', '<i8'), ('step', '<i8'), ('flags', '<i8')])
+_KEYFRAME = 1
+
+
+def _varints(data):
+    """Decodes a byte string of zigzag varints into an int64 array."""
+    b = np.frombuffer(data, dtype=np.uint8)
+    ends = np.flatnonzero(b < 0x80)
+    starts = np.concatenate(([0], ends[:-1] + 1))
+    shift = np.arange(len(b)) - np.repeat(starts, ends - starts + 1)
+    v = np.add.reduceat((b & 0x7f).astype(np.uint64) << (7 * shift).astype(np.uint64), starts)
+    return (v >> np.uint64(1)).astype(np.int64) ^ -(v & np.uint64(1)).astype(np.int64)
+
+
+class CTRReader(object):
+
+    def __init__(self, filename):
+        self.filename = filename
+        index = np.fromfile(filename + '.idx', dtype=_index_dtype)
+        self.offsets = index['offset']
+        self.steps = index['step']
+        self.keyframes = (index['flags'] & _KEYFRAME) != 0
+        self._frame = None  # last decoded frame: number, header, ids and quantized positions per block
+
+    def __len__(self):
+        return len(self.offsets)
+
+    def __iter__(self):
+        for frame in range(len(self)):
+            yield self.read(frame)
+
+    def read(self, frame):
+        if frame < 0:
+            frame += len(self)
+        start = frame
+        while not self.keyframes[start]:
+            start -= 1
+        if self._frame is not None and start <= self._frame[0] <= frame:
+            start = self._frame[0] + 1
+        with open(self.filename, 'rb') as f:
+            for n in range(start, frame + 1):
+                self._decode(f, n)
+        header, ids, coords = self._frame[1:]
+        ids = np.concatenate(ids)
+        pos = np.concatenate(coords).astype(np.float64) * header['precision']
+        return int(header['step']), float(header['time']), tuple(header['box']), ids, pos
+
+    def _decode(self, f, n):
+        f.seek(self.offsets[n])
+        header = np.frombuffer(f.read(_header_dtype.itemsize), dtype=_header_dtype)[0]
+        if header['magic'] != b'ECTR':
+            raise IOError('%s: no frame at offset %d' % (self.filename, self.offsets[n]))
+        key = (header['flags'] & _KEYFRAME) != 0
+        nblocks = int(header['numBlocks'])
+        sizes = np.frombuffer(f.read(8 * nblocks), dtype='<i8')
+        ids, coords = [], []
+        for b in range(nblocks):
+            v = _varints(zlib.decompress(f.read(int(sizes[b]))))
+            num = int(v[0])
+            if key:
+                ids.append(np.cumsum(v[1:1 + num]))
+                coords.append(np.cumsum(v[1 + num:].reshape(num, 3), axis=0))
+            else:
+                ids.append(self._frame[2][b])
+                coords.append(self._frame[3][b] + v[1:].reshape(num, 3))
+        self._frame = (n, header, ids, coords)
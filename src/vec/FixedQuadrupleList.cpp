@@ -0,0 +1,282 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "vec/Vectorization.hpp"
+#include "vec/FixedQuadrupleList.hpp"
+#include "vec/storage/StorageVec.hpp"
+
+#include "python.hpp"
+#include "storage/Storage.hpp"
+#include "Buffer.hpp"
+#include "esutil/Error.hpp"
+
+#include <sstream>
+
+namespace espressopp
+{
+namespace vec
+{
+LOG4ESPP_LOGGER(FixedQuadrupleList::theLogger, "FixedQuadrupleList");
+
+FixedQuadrupleList::FixedQuadrupleList(std::shared_ptr<espressopp::storage::Storage> storage)
+    : globalQuadruples()
+{
+    LOG4ESPP_INFO(theLogger, "construct FixedQuadrupleList");
+
+    if (!storage->getSystem()->vectorization)
+    {
+        throw std::runtime_error("system has no vectorization");
+    }
+    vectorization = storage->getSystem()->vectorization;
+
+    if (!(vectorization->storageVec))
+        throw std::runtime_error("vectorization->storageVec cannot be null");
+    auto& storageVec = vectorization->storageVec;
+    storageVec->enableLocalParticles();
+
+    sigBeforeSend = storage->beforeSendParticles.connect(
+        std::bind(&FixedQuadrupleList::beforeSendParticles, this, std::placeholders::_1,
+                  std::placeholders::_2));
+    sigAfterRecv = storage->afterRecvParticles.connect(
+        std::bind(&FixedQuadrupleList::afterRecvParticles, this, std::placeholders::_1,
+                  std::placeholders::_2));
+    sigOnParticlesChanged = storage->onParticlesChanged.connect(
+        std::bind(&FixedQuadrupleList::onParticlesChanged, this));
+}
+
+FixedQuadrupleList::~FixedQuadrupleList()
+{
+    LOG4ESPP_INFO(theLogger, "~FixedQuadrupleList");
+
+    sigBeforeSend.disconnect();
+    sigAfterRecv.disconnect();
+    sigOnParticlesChanged.disconnect();
+}
+
+bool FixedQuadrupleList::add(size_t pid1, size_t pid2, size_t pid3, size_t pid4)
+{
+    bool returnVal = true;
+    auto& system = vectorization->getSystemRef();
+    esutil::Error err(system.comm);
+
+    auto const& storageVec = vectorization->storageVec;
+    size_t const p1 = storageVec->lookupRealParticleVec(pid1);
+    size_t const p2 = storageVec->lookupLocalParticleVec(pid2);
+    size_t const p3 = storageVec->lookupLocalParticleVec(pid3);
+    size_t const p4 = storageVec->lookupLocalParticleVec(pid4);
+
+    // first particle is the reference particle and must exist here
+    if (p1 == VEC_PARTICLE_NOT_FOUND)
+    {
+        // particle does not exists here (some other CPU must have it)
+        returnVal = false;
+    }
+    else
+    {
+        const size_t partners[3] = {p2, p3, p4};
+        const size_t partnerIds[3] = {pid2, pid3, pid4};
+        for (int k = 0; k < 3; k++)
+        {
+            if (partners[k] == VEC_PARTICLE_NOT_FOUND)
+            {
+                std::stringstream msg;
+                msg << "adding error: quadruple particle p" << k + 2 << " " << partnerIds[k]
+                    << " does not exists here and cannot be added";
+                msg << " quadruple: " << pid1 << "-" << pid2 << "-" << pid3 << "-" << pid4;
+                err.setException(msg.str());
+            }
+        }
+    }
+    err.checkException();
+
+    if (returnVal)
+    {
+        // add the quadruple locally
+        this->push_back({p1, p2, p3, p4});
+
+        // ADD THE GLOBAL QUADRUPLE
+        globalQuadruples.insert(std::make_pair(pid1, std::make_tuple(pid2, pid3, pid4)));
+        LOG4ESPP_INFO(theLogger, "added fixed quadruple to global quadruple list");
+    }
+    return returnVal;
+}
+
+python::list FixedQuadrupleList::getQuadruples()
+{
+    python::list quadruples;
+    for (auto it = globalQuadruples.cbegin(); it != globalQuadruples.cend(); it++)
+    {
+        quadruples.append(python::make_tuple(it->first, std::get<0>(it->second),
+                                             std::get<1>(it->second), std::get<2>(it->second)));
+    }
+    return quadruples;
+}
+
+std::vector<size_t> FixedQuadrupleList::getQuadrupleList()
+{
+    std::vector<size_t> ret;
+    for (auto it = globalQuadruples.cbegin(); it != globalQuadruples.cend(); it++)
+    {
+        ret.push_back(it->first);
+        ret.push_back(std::get<0>(it->second));
+        ret.push_back(std::get<1>(it->second));
+        ret.push_back(std::get<2>(it->second));
+    }
+    return ret;
+}
+
+void FixedQuadrupleList::beforeSendParticles(ParticleList& pl, OutBuffer& buf)
+{
+    std::vector<size_t> toSend;
+    // loop over the particle list
+    for (ParticleList::Iterator pit(pl); pit.isValid(); ++pit)
+    {
+        const size_t pid = pit->id();
+
+        // find all quadruples that involve this particle
+        size_t n = globalQuadruples.count(pid);
+
+        if (n > 0)
+        {
+            const auto equalRange = globalQuadruples.equal_range(pid);
+
+            // first write the pid of this particle
+            // then the number of partners (n)
+            // and then the pids of the partners
+            toSend.reserve(toSend.size() + 3 * n + 2);
+            toSend.push_back(pid);
+            toSend.push_back(n);
+            for (auto it = equalRange.first; it != equalRange.second; ++it)
+            {
+                toSend.push_back(std::get<0>(it->second));
+                toSend.push_back(std::get<1>(it->second));
+                toSend.push_back(std::get<2>(it->second));
+            }
+
+            // delete all of these quadruples from the global list
+            globalQuadruples.erase(equalRange.first, equalRange.second);
+        }
+    }
+    // send the list
+    buf.write(toSend);
+    LOG4ESPP_INFO(theLogger, "prepared fixed quadruple list before send particles");
+}
+
+void FixedQuadrupleList::afterRecvParticles(ParticleList& pl, InBuffer& buf)
+{
+    std::vector<size_t> received;
+    auto it = globalQuadruples.begin();
+    // receive the quadruple list
+    buf.read(received);
+    size_t const size = received.size();
+    size_t i = 0;
+    while (i < size)
+    {
+        // unpack the list
+        size_t const pid1 = received[i++];
+        size_t n = received[i++];
+        for (; n > 0; --n)
+        {
+            size_t const pid2 = received[i++];
+            size_t const pid3 = received[i++];
+            size_t const pid4 = received[i++];
+            // add the quadruple to the global list
+            it = globalQuadruples.insert(it,
+                                         std::make_pair(pid1, std::make_tuple(pid2, pid3, pid4)));
+        }
+    }
+    if (i != size)
+    {
+        printf("ATTETNTION:  recv particles might have read garbage\n");
+    }
+    LOG4ESPP_INFO(theLogger, "received fixed quadruple list after receive particles");
+}
+
+void FixedQuadrupleList::onParticlesChanged()
+{
+    auto& system = vectorization->getSystemRef();
+    esutil::Error err(system.comm);
+
+    // (re-)generate the local quadruple list from the global list
+    this->clear();
+    size_t lastpid1 = VEC_PARTICLE_NOT_FOUND;
+    auto const& storageVec = vectorization->storageVec;
+    size_t p1 = VEC_PARTICLE_NOT_FOUND;
+    for (auto it = globalQuadruples.cbegin(); it != globalQuadruples.cend(); ++it)
+    {
+        if (it->first != lastpid1)
+        {
+            p1 = storageVec->lookupRealParticleVec(it->first);
+            if (p1 == VEC_PARTICLE_NOT_FOUND)
+            {
+                std::stringstream msg;
+                msg << "quadruple particle p1 " << it->first << " does not exists here";
+                err.setException(msg.str());
+            }
+            lastpid1 = it->first;
+        }
+        const size_t pids[3] = {std::get<0>(it->second), std::get<1>(it->second),
+                                std::get<2>(it->second)};
+        size_t partners[3];
+        for (int k = 0; k < 3; k++)
+        {
+            partners[k] = storageVec->lookupLocalParticleVec(pids[k]);
+            if (partners[k] == VEC_PARTICLE_NOT_FOUND)
+            {
+                std::stringstream msg;
+                msg << "quadruple particle p" << k + 2 << " " << pids[k] << " does not exists here";
+                err.setException(msg.str());
+            }
+        }
+        this->push_back({p1, partners[0], partners[1], partners[2]});
+    }
+    err.checkException();
+
+    LOG4ESPP_INFO(theLogger, "regenerated local fixed quadruple list from global list");
+}
+
+void FixedQuadrupleList::remove()
+{
+    this->clear();
+    globalQuadruples.clear();
+    sigBeforeSend.disconnect();
+    sigAfterRecv.disconnect();
+    sigOnParticlesChanged.disconnect();
+}
+/****************************************************
+** REGISTRATION WITH PYTHON
+****************************************************/
+
+void FixedQuadrupleList::registerPython()
+{
+    using namespace espressopp::python;
+
+    bool (FixedQuadrupleList::*pyAdd)(size_t pid1, size_t pid2, size_t pid3, size_t pid4) =
+        &FixedQuadrupleList::add;
+
+    class_<FixedQuadrupleList, std::shared_ptr<FixedQuadrupleList> >(
+        "vec_FixedQuadrupleList", init<std::shared_ptr<espressopp::storage::Storage> >())
+        .def("add", pyAdd)
+        .def("size", &FixedQuadrupleList::size)
+        .def("remove", &FixedQuadrupleList::remove)
+        .def("getQuadruples", &FixedQuadrupleList::getQuadruples);
+}
+}  // namespace vec
+}  // namespace espressopp
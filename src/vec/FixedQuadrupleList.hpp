@@ -0,0 +1,79 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_FIXEDQUADRUPLELIST_HPP
+#define VEC_FIXEDQUADRUPLELIST_HPP
+
+#include "vec/include/types.hpp"
+#include "vec/include/simdconfig.hpp"
+
+#include "log4espp.hpp"
+
+#include "esutil/ESPPIterator.hpp"
+#include <boost/unordered_map.hpp>
+#include <boost/signals2.hpp>
+
+namespace espressopp
+{
+namespace vec
+{
+typedef std::tuple<size_t, size_t, size_t, size_t> Quadruple;
+typedef AlignedVector<Quadruple> QuadrupleList;
+
+class FixedQuadrupleList : public QuadrupleList
+{
+protected:
+    boost::signals2::connection sigAfterRecv, sigOnParticlesChanged, sigBeforeSend;
+    typedef boost::unordered_multimap<size_t, std::tuple<size_t, size_t, size_t> >
+        GlobalQuadruples;
+    GlobalQuadruples globalQuadruples;
+    std::shared_ptr<Vectorization> vectorization;
+
+public:
+    FixedQuadrupleList(std::shared_ptr<espressopp::storage::Storage>);
+    virtual ~FixedQuadrupleList();
+
+    /// Add the given particle quadruple to the list on this processor if the
+    /// first particle belongs to this processor.  Note that this routine does
+    /// not check whether the quadruple is inserted on another processor as well.
+    /// \return whether the quadruple was inserted on this processor.
+    virtual bool add(size_t pid1, size_t pid2, size_t pid3, size_t pid4);
+
+    virtual void beforeSendParticles(ParticleList& pl, class OutBuffer& buf);
+    void afterRecvParticles(ParticleList& pl, class InBuffer& buf);
+    virtual void onParticlesChanged();
+
+    virtual std::vector<size_t> getQuadrupleList();
+    python::list getQuadruples();
+
+    /** Get the number of quadruples in the GlobalQuadruples list */
+    int size() { return globalQuadruples.size(); }
+
+    void remove();
+    static void registerPython();
+
+private:
+    static LOG4ESPP_DECL_LOGGER(theLogger);
+};
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_FIXEDQUADRUPLELIST_HPP
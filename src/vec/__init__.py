@@ -21,7 +21,11 @@ pmiimport('espressopp.vec')
 
 from espressopp.vec.FixedPairList import *
 from espressopp.vec.FixedTripleList import *
+from espressopp.vec.FixedQuadrupleList import *
 from espressopp.vec.Vectorization import *
 from espressopp.vec.VerletList import *
 
 from espressopp.vec import storage, integrator, interaction, standard_system
+
+# True if the pair kernels were built with ESPP_MIXED_PRECISION
+from _espressopp import vec_mixed_precision as mixedPrecision
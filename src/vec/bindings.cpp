@@ -23,8 +23,10 @@
 
 #include "vec/FixedPairList.hpp"
 #include "vec/FixedTripleList.hpp"
+#include "vec/FixedQuadrupleList.hpp"
 #include "vec/Vectorization.hpp"
 #include "vec/VerletList.hpp"
+#include "vec/include/simdconfig.hpp"
 
 #include "vec/storage/bindings.hpp"
 #include "vec/integrator/bindings.hpp"
@@ -38,12 +40,15 @@ void registerPython()
 {
     vec::FixedPairList::registerPython();
     vec::FixedTripleList::registerPython();
+    vec::FixedQuadrupleList::registerPython();
     vec::Vectorization::registerPython();
     vec::VerletList::registerPython();
 
     vec::storage::registerPython();
     vec::integrator::registerPython();
     vec::interaction::registerPython();
+
+    python::scope().attr("vec_mixed_precision") = mixed_precision;
 }
 
 }  // namespace vec
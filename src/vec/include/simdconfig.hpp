@@ -24,6 +24,7 @@
 #include <vector>
 #include <cstdint>
 #include <boost/align/aligned_allocator.hpp>
+#include "acconfig.hpp"
 #include "include/esconfig.hpp"
 
 #ifdef __INTEL_COMPILER
@@ -52,12 +53,23 @@ constexpr size_t ESPP_FIT_TO_VECTOR_WIDTH(size_t SIZE)
 template <typename T, std::size_t Alignment = ESPP_VECTOR_ALIGNMENT>
 using AlignedVector = std::vector<T, boost::alignment::aligned_allocator<T, Alignment>>;
 
+/// Floating point type of the pair kernels. With ESPP_MIXED_PRECISION, pair distances and force
+/// factors are evaluated in float, while positions, force sums, energies and virials stay real.
+#ifdef ESPP_MIXED_PRECISION
+typedef float simdreal;
+#else
+typedef real simdreal;
+#endif
+
+constexpr bool mixed_precision = !std::is_same<simdreal, real>::value;
+
 static_assert(std::is_same<real, double>::value || std::is_same<real, float>::value,
               "Only float and double are allowed for espressopp::real. Otherwise, manually choose "
               "a value for large_pos.");
 
 /// Represents a very large number for padding positions of "fake" particles = sqrt(max/3).
-constexpr real large_pos = std::is_same<real, double>::value ? 7.74099e150 : 7.74099e15;
+/// Distances to them must stay finite in simdreal as well.
+constexpr real large_pos = std::is_same<simdreal, double>::value ? 7.74099e150 : 7.74099e15;
 
 }  // namespace vec
 }  // namespace espressopp
@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_FIXEDPAIRLISTHARMONIC_HPP
+#define VEC_INTERACTION_FIXEDPAIRLISTHARMONIC_HPP
+
+#include "types.hpp"
+#include "interaction/Harmonic.hpp"
+#include "FixedPairListInteractionTemplate.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Harmonic bonds (espressopp.interaction.Harmonic)
+    on the vectorized FixedPairList. */
+class FixedPairListHarmonic
+    : public FixedPairListInteractionTemplate<espressopp::interaction::Harmonic>
+{
+public:
+    FixedPairListHarmonic(std::shared_ptr<System> _system,
+                          std::shared_ptr<FixedPairList> _list,
+                          std::shared_ptr<Potential> _potential)
+        : FixedPairListInteractionTemplate<espressopp::interaction::Harmonic>(
+              _system, _list, _potential)
+    {
+    }
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_FIXEDPAIRLISTHARMONIC_HPP
@@ -0,0 +1,77 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+**************************************************
+espressopp.vec.interaction.FixedPairListHarmonic
+**************************************************
+
+Harmonic bonds on a :class:`espressopp.vec.FixedPairList`.
+The potential is the usual :class:`espressopp.interaction.Harmonic` object.
+
+>>> bonds = espressopp.vec.FixedPairList(system.storage)
+>>> bonds.addBonds([(1, 2), (2, 3)])
+>>> pot = espressopp.interaction.Harmonic(K=100.0, r0=1.0)
+>>> interHarmonic = espressopp.vec.interaction.FixedPairListHarmonic(system, bonds, pot)
+>>> system.addInteraction(interHarmonic)
+
+.. function:: espressopp.vec.interaction.FixedPairListHarmonic(system, pairlist, potential)
+
+                :param system:
+                :param pairlist:
+                :param potential:
+                :type system:
+                :type pairlist: :class:`espressopp.vec.FixedPairList`
+                :type potential: :class:`espressopp.interaction.Harmonic`
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+from _espressopp import vec_interaction_FixedPairListHarmonic
+
+class FixedPairListHarmonicLocal(InteractionLocal, vec_interaction_FixedPairListHarmonic):
+
+    def __init__(self, system, pairlist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedPairListHarmonic, system, pairlist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedPairList(self, pairlist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedPairList(self, pairlist)
+
+    def getFixedPairList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedPairList(self)
+
+if pmi.isController:
+    class FixedPairListHarmonic(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedPairListHarmonicLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedPairList', 'getFixedPairList']
+            )
@@ -0,0 +1,77 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+***************************************************************
+espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonic
+***************************************************************
+
+Harmonic dihedrals on a :class:`espressopp.vec.FixedQuadrupleList`.
+The potential is the usual :class:`espressopp.interaction.DihedralHarmonic` object.
+
+>>> dihedrals = espressopp.vec.FixedQuadrupleList(system.storage)
+>>> dihedrals.addQuadruples([(1, 2, 3, 4)])
+>>> pot = espressopp.interaction.DihedralHarmonic(K=10.0, phi0=0.0)
+>>> interDihedral = espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonic(system, dihedrals, pot)
+>>> system.addInteraction(interDihedral)
+
+.. function:: espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonic(system, quadruplelist, potential)
+
+                :param system:
+                :param quadruplelist:
+                :param potential:
+                :type system:
+                :type quadruplelist: :class:`espressopp.vec.FixedQuadrupleList`
+                :type potential: :class:`espressopp.interaction.DihedralHarmonic`
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+from _espressopp import vec_interaction_FixedQuadrupleListDihedralHarmonic
+
+class FixedQuadrupleListDihedralHarmonicLocal(InteractionLocal, vec_interaction_FixedQuadrupleListDihedralHarmonic):
+
+    def __init__(self, system, quadruplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedQuadrupleListDihedralHarmonic, system, quadruplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedQuadrupleList(self, quadruplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedQuadrupleList(self, quadruplelist)
+
+    def getFixedQuadrupleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedQuadrupleList(self)
+
+if pmi.isController:
+    class FixedQuadrupleListDihedralHarmonic(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonicLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedQuadrupleList', 'getFixedQuadrupleList']
+            )
@@ -0,0 +1,51 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "vec/Vectorization.hpp"
+
+#include "python.hpp"
+#include "FixedQuadrupleListDihedralRB.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void FixedQuadrupleListDihedralRB::registerPython()
+{
+    using namespace espressopp::python;
+    using espressopp::interaction::Interaction;
+
+    class_<FixedQuadrupleListDihedralRB, bases<Interaction> >(
+        "vec_interaction_FixedQuadrupleListDihedralRB",
+        init<std::shared_ptr<System>, std::shared_ptr<FixedQuadrupleList>,
+             std::shared_ptr<espressopp::interaction::DihedralRB> >())
+        .def("setPotential", &FixedQuadrupleListDihedralRB::setPotential)
+        .def("getPotential", &FixedQuadrupleListDihedralRB::getPotential)
+        .def("setFixedQuadrupleList", &FixedQuadrupleListDihedralRB::setFixedQuadrupleList)
+        .def("getFixedQuadrupleList", &FixedQuadrupleListDihedralRB::getFixedQuadrupleList);
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
@@ -0,0 +1,324 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_FIXEDQUADRUPLELISTINTERACTIONTEMPLATE_HPP
+#define VEC_INTERACTION_FIXEDQUADRUPLELISTINTERACTIONTEMPLATE_HPP
+
+#include "vec/FixedQuadrupleList.hpp"
+
+#include "mpi.hpp"
+#include "interaction/Interaction.hpp"
+#include "Real3D.hpp"
+#include "Tensor.hpp"
+#include "Particle.hpp"
+#include "bc/BC.hpp"
+#include "SystemAccess.hpp"
+#include "types.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+template <typename _DihedralPotential>
+class FixedQuadrupleListInteractionTemplate : public espressopp::interaction::Interaction,
+                                              SystemAccess
+{
+protected:
+    typedef _DihedralPotential Potential;
+
+public:
+    FixedQuadrupleListInteractionTemplate(
+        std::shared_ptr<System> _system,
+        std::shared_ptr<vec::FixedQuadrupleList> _fixedquadrupleList,
+        std::shared_ptr<Potential> _potential)
+        : SystemAccess(_system),
+          vectorization(getSystem()->vectorization),
+          fixedquadrupleList(_fixedquadrupleList),
+          potential(_potential)
+    {
+        if (!potential)
+        {
+            LOG4ESPP_ERROR(theLogger, "NULL potential");
+        }
+    }
+
+    virtual ~FixedQuadrupleListInteractionTemplate(){};
+
+    void setFixedQuadrupleList(std::shared_ptr<FixedQuadrupleList> _fixedquadrupleList)
+    {
+        fixedquadrupleList = _fixedquadrupleList;
+    }
+
+    std::shared_ptr<FixedQuadrupleList> getFixedQuadrupleList() { return fixedquadrupleList; }
+
+    void setPotential(std::shared_ptr<Potential> _potential)
+    {
+        if (_potential)
+        {
+            potential = _potential;
+        }
+        else
+        {
+            LOG4ESPP_ERROR(theLogger, "NULL potential");
+        }
+    }
+
+    std::shared_ptr<Potential> getPotential() { return potential; }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeEnergyDeriv();
+    virtual real computeEnergyAA();
+    virtual real computeEnergyCG();
+    virtual real computeEnergyAA(int atomtype);
+    virtual real computeEnergyCG(int atomtype);
+    virtual void computeVirialX(std::vector<real>& p_xx_total, int bins);
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+    virtual void computeVirialTensor(Tensor& w, real z);
+    virtual void computeVirialTensor(Tensor* w, int n);
+    virtual real getMaxCutoff();
+    virtual int bondType() { return espressopp::interaction::Dihedral; }
+
+protected:
+    /// bond vectors p2-p1, p3-p2 and p4-p3 of one quadruple
+    inline void getBondVectors(const Quadruple& quadruple,
+                               Real3D& dist21,
+                               Real3D& dist32,
+                               Real3D& dist43) const
+    {
+        auto const& bc = *getSystemRef().bc;
+        auto const& particles = vectorization->particles;
+        const Real3D pos1 = particles.getPosition(std::get<0>(quadruple));
+        const Real3D pos2 = particles.getPosition(std::get<1>(quadruple));
+        const Real3D pos3 = particles.getPosition(std::get<2>(quadruple));
+        const Real3D pos4 = particles.getPosition(std::get<3>(quadruple));
+        bc.getMinimumImageVectorBox(dist21, pos2, pos1);
+        bc.getMinimumImageVectorBox(dist32, pos3, pos2);
+        bc.getMinimumImageVectorBox(dist43, pos4, pos3);
+    }
+
+    int ntypes;
+    std::shared_ptr<vec::Vectorization> vectorization;
+    std::shared_ptr<FixedQuadrupleList> fixedquadrupleList;
+    std::shared_ptr<Potential> potential;
+};
+
+//////////////////////////////////////////////////
+// INLINE IMPLEMENTATION
+//////////////////////////////////////////////////
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::addForces()
+{
+    LOG4ESPP_INFO(theLogger, "add forces computed by FixedQuadrupleList");
+
+    auto const& bc = *getSystemRef().bc;
+    auto& particles = vectorization->particles;
+    auto& pot = *potential;
+
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        getBondVectors(quadruple, dist21, dist32, dist43);
+
+        Real3D force1, force2, force3, force4;
+        pot.computeColVarWeights(dist21, dist32, dist43, bc);
+        pot._computeForce(force1, force2, force3, force4, dist21, dist32, dist43);
+
+        particles.addForce(std::get<0>(quadruple), force1);
+        particles.addForce(std::get<1>(quadruple), force2);
+        particles.addForce(std::get<2>(quadruple), force3);
+        particles.addForce(std::get<3>(quadruple), force4);
+    }
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergy()
+{
+    LOG4ESPP_INFO(theLogger, "compute energy of the quadruples");
+
+    auto const& bc = *getSystemRef().bc;
+    auto& pot = *potential;
+
+    real e = 0.0;
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        getBondVectors(quadruple, dist21, dist32, dist43);
+
+        pot.computeColVarWeights(dist21, dist32, dist43, bc);
+        e += pot._computeEnergy(dist21, dist32, dist43);
+    }
+
+    real esum;
+    boost::mpi::all_reduce(*mpiWorld, e, esum, std::plus<real>());
+    return esum;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyDeriv()
+{
+    std::cout << "Warning! At the moment computeEnergyDeriv() in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyAA()
+{
+    std::cout << "Warning! At the moment computeEnergyAA() in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyAA(
+    int atomtype)
+{
+    std::cout << "Warning! At the moment computeEnergyAA(int atomtype) in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyCG()
+{
+    std::cout << "Warning! At the moment computeEnergyCG() in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeEnergyCG(
+    int atomtype)
+{
+    std::cout << "Warning! At the moment computeEnergyCG(int atomtype) in "
+                 "FixedQuadrupleListInteractionTemplate does not work."
+              << std::endl;
+    return 0.0;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialX(
+    std::vector<real>& p_xx_total, int bins)
+{
+    std::cout << "Warning! At the moment computeVirialX in FixedQuadrupleListInteractionTemplate "
+                 "does not work."
+              << std::endl
+              << "Therefore, the corresponding interactions won't be included in calculation."
+              << std::endl;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirial()
+{
+    LOG4ESPP_INFO(theLogger, "compute scalar virial of the quadruples");
+
+    auto const& bc = *getSystemRef().bc;
+    auto& pot = *potential;
+
+    real w = 0.0;
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        getBondVectors(quadruple, dist21, dist32, dist43);
+
+        Real3D force1, force2, force3, force4;
+        pot.computeColVarWeights(dist21, dist32, dist43, bc);
+        pot._computeForce(force1, force2, force3, force4, dist21, dist32, dist43);
+
+        // positions relative to p1, the forces of a quadruple sum up to zero
+        const Real3D r31 = dist21 + dist32;
+        const Real3D r41 = r31 + dist43;
+        w += dist21 * force2 + r31 * force3 + r41 * force4;
+    }
+
+    real wsum;
+    boost::mpi::all_reduce(*mpiWorld, w, wsum, std::plus<real>());
+    return wsum;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialTensor(
+    Tensor& w)
+{
+    LOG4ESPP_INFO(theLogger, "compute the virial tensor of the quadruples");
+
+    auto const& bc = *getSystemRef().bc;
+    auto& pot = *potential;
+
+    Tensor wlocal(0.0);
+    for (const auto& quadruple : *fixedquadrupleList)
+    {
+        Real3D dist21, dist32, dist43;
+        getBondVectors(quadruple, dist21, dist32, dist43);
+
+        Real3D force1, force2, force3, force4;
+        pot.computeColVarWeights(dist21, dist32, dist43, bc);
+        pot._computeForce(force1, force2, force3, force4, dist21, dist32, dist43);
+
+        const Real3D r31 = dist21 + dist32;
+        const Real3D r41 = r31 + dist43;
+        wlocal += Tensor(dist21, force2) + Tensor(r31, force3) + Tensor(r41, force4);
+    }
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialTensor(
+    Tensor& w, real z)
+{
+    LOG4ESPP_INFO(theLogger, "compute the virial tensor of the quadruples");
+
+    std::cout << "Warning! At the moment IK computeVirialTensor for fixed quadruples does'n work"
+              << std::endl;
+}
+
+template <typename _DihedralPotential>
+inline void FixedQuadrupleListInteractionTemplate<_DihedralPotential>::computeVirialTensor(
+    Tensor* w, int n)
+{
+    LOG4ESPP_INFO(theLogger, "compute the virial tensor of the quadruples");
+
+    std::cout << "Warning! At the moment IK computeVirialTensor for fixed quadruples does'n work"
+              << std::endl;
+}
+
+template <typename _DihedralPotential>
+inline real FixedQuadrupleListInteractionTemplate<_DihedralPotential>::getMaxCutoff()
+{
+    return potential->getCutoff();
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_FIXEDQUADRUPLELISTINTERACTIONTEMPLATE_HPP
@@ -0,0 +1,51 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "vec/Vectorization.hpp"
+
+#include "python.hpp"
+#include "FixedTripleListAngularHarmonic.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void FixedTripleListAngularHarmonic::registerPython()
+{
+    using namespace espressopp::python;
+    using espressopp::interaction::Interaction;
+
+    class_<FixedTripleListAngularHarmonic, bases<Interaction> >(
+        "vec_interaction_FixedTripleListAngularHarmonic",
+        init<std::shared_ptr<System>, std::shared_ptr<FixedTripleList>,
+             std::shared_ptr<espressopp::interaction::AngularHarmonic> >())
+        .def("setPotential", &FixedTripleListAngularHarmonic::setPotential)
+        .def("getPotential", &FixedTripleListAngularHarmonic::getPotential)
+        .def("setFixedTripleList", &FixedTripleListAngularHarmonic::setFixedTripleList)
+        .def("getFixedTripleList", &FixedTripleListAngularHarmonic::getFixedTripleList);
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
@@ -0,0 +1,77 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+r"""
+***********************************************************
+espressopp.vec.interaction.FixedTripleListAngularHarmonic
+***********************************************************
+
+Harmonic angles on a :class:`espressopp.vec.FixedTripleList`.
+The potential is the usual :class:`espressopp.interaction.AngularHarmonic` object.
+
+>>> angles = espressopp.vec.FixedTripleList(system.storage)
+>>> angles.addTriples([(1, 2, 3)])
+>>> pot = espressopp.interaction.AngularHarmonic(K=50.0, theta0=math.pi)
+>>> interAngle = espressopp.vec.interaction.FixedTripleListAngularHarmonic(system, angles, pot)
+>>> system.addInteraction(interAngle)
+
+.. function:: espressopp.vec.interaction.FixedTripleListAngularHarmonic(system, triplelist, potential)
+
+                :param system:
+                :param triplelist:
+                :param potential:
+                :type system:
+                :type triplelist: :class:`espressopp.vec.FixedTripleList`
+                :type potential: :class:`espressopp.interaction.AngularHarmonic`
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Interaction import *
+from _espressopp import vec_interaction_FixedTripleListAngularHarmonic
+
+class FixedTripleListAngularHarmonicLocal(InteractionLocal, vec_interaction_FixedTripleListAngularHarmonic):
+
+    def __init__(self, system, triplelist, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_FixedTripleListAngularHarmonic, system, triplelist, potential)
+
+    def setPotential(self, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, potential)
+
+    def getPotential(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self)
+
+    def setFixedTripleList(self, triplelist):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setFixedTripleList(self, triplelist)
+
+    def getFixedTripleList(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getFixedTripleList(self)
+
+if pmi.isController:
+    class FixedTripleListAngularHarmonic(Interaction, metaclass=pmi.Proxy):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.FixedTripleListAngularHarmonicLocal',
+            pmicall = ['setPotential', 'getPotential', 'setFixedTripleList', 'getFixedTripleList']
+            )
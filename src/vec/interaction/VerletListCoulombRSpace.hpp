@@ -0,0 +1,61 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_VERLETLISTCOULOMBRSPACE_HPP
+#define VEC_INTERACTION_VERLETLISTCOULOMBRSPACE_HPP
+
+#include "types.hpp"
+#include "interaction/CoulombRSpace.hpp"
+#include "VerletListInteractionTemplate.hpp"
+#include "vec/VerletList.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Real-space Ewald pairs (espressopp.interaction.CoulombRSpace) on the
+    vectorized Verlet list. The potential is evaluated for unit charges and
+    scaled with the charges read from the particle arrays. */
+class VerletListCoulombRSpace
+    : public VerletListInteractionTemplate<espressopp::interaction::CoulombRSpace>
+{
+public:
+    VerletListCoulombRSpace(std::shared_ptr<VerletList> _verletList)
+        : VerletListInteractionTemplate<espressopp::interaction::CoulombRSpace>(_verletList)
+    {
+    }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+    virtual void computeVirialTensor(Tensor& w, real z);
+    virtual void computeVirialTensor(Tensor* w, int n);
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_VERLETLISTCOULOMBRSPACE_HPP
@@ -0,0 +1,64 @@
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+**************************************************
+espressopp.vec.interaction.VerletListCoulombRSpace
+**************************************************
+
+Real-space part of the Ewald sum on a :class:`espressopp.vec.VerletList`, with the usual
+:class:`espressopp.interaction.CoulombRSpace` potentials. The charges are read from the
+vectorized particle arrays. The vectorized Verlet list has no exclusions.
+
+>>> pot = espressopp.interaction.CoulombRSpace(prefactor=1.0, alpha=alpha, cutoff=rc)
+>>> interCoulomb = espressopp.vec.interaction.VerletListCoulombRSpace(vl)
+>>> interCoulomb.setPotential(type1=0, type2=0, potential=pot)
+"""
+
+from espressopp import pmi
+from espressopp.esutil import *
+
+from espressopp.interaction.Potential import *
+from espressopp.interaction.Interaction import *
+
+from _espressopp import vec_interaction_VerletListCoulombRSpace
+
+class VerletListCoulombRSpaceLocal(InteractionLocal, vec_interaction_VerletListCoulombRSpace):
+
+    def __init__(self, vl):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            cxxinit(self, vec_interaction_VerletListCoulombRSpace, vl)
+
+    def setPotential(self, type1, type2, potential):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            self.cxxclass.setPotential(self, type1, type2, potential)
+
+    def getPotential(self, type1, type2):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getPotential(self, type1, type2)
+
+    def getVerletListLocal(self):
+        if not (pmi._PMIComm and pmi._PMIComm.isActive()) or pmi._MPIcomm.rank in pmi._PMIComm.getMPIcpugroup():
+            return self.cxxclass.getVerletList(self)
+
+if pmi.isController:
+    class VerletListCoulombRSpace(Interaction):
+        pmiproxydefs = dict(
+            cls =  'espressopp.vec.interaction.VerletListCoulombRSpaceLocal',
+            pmicall = ['setPotential', 'getPotential', 'getVerletList']
+            )
@@ -58,9 +58,9 @@ protected:
 public:
     struct LJCoefficients
     {
-        LJCoefficients(real const& ff1, real const& ff2) : ff1(ff1), ff2(ff2) {}
+        LJCoefficients(simdreal ff1, simdreal ff2) : ff1(ff1), ff2(ff2) {}
         LJCoefficients() {}
-        real ff1, ff2;
+        simdreal ff1, ff2;
     };
 
     VerletListLennardJones(std::shared_ptr<VerletList> _verletList)
@@ -73,7 +73,7 @@ public:
         np_types = potentialArray.size_n();
         p_types = potentialArray.size_m();
         ffs = AlignedVector<LJCoefficients>(np_types * p_types);
-        cutoffSqr = AlignedVector<real>(np_types * p_types);
+        cutoffSqr = AlignedVector<simdreal>(np_types * p_types);
         auto it1 = ffs.begin();
         auto it2 = cutoffSqr.begin();
         for (auto& p : potentialArray)
@@ -90,13 +90,13 @@ public:
                                ParticleArray& particlesNbr,
                                VerletList::NeighborList const& neighborList,
                                AlignedVector<LJCoefficients> const& ffs,
-                               AlignedVector<real> const& cutoffSqr,
+                               AlignedVector<simdreal> const& cutoffSqr,
                                size_t np_types);
 
 protected:
     size_t np_types, p_types;
     AlignedVector<LJCoefficients> ffs;
-    AlignedVector<real> cutoffSqr;
+    AlignedVector<simdreal> cutoffSqr;
     bool needRebuildPotential = true;
 };
 
@@ -132,11 +132,11 @@ inline void VerletListLennardJones::addForces_impl(ParticleArray& particles,
                                                    ParticleArray& particlesNbr,
                                                    VerletList::NeighborList const& neighborList,
                                                    AlignedVector<LJCoefficients> const& ffs,
-                                                   AlignedVector<real> const& cutoffSqr,
+                                                   AlignedVector<simdreal> const& cutoffSqr,
                                                    size_t np_types)
 {
     {
-        real ff1_, ff2_, cutoffSqr_;
+        simdreal ff1_, ff2_, cutoffSqr_;
         if (ONETYPE)
         {
             ff1_ = ffs[0].ff1;
@@ -190,7 +190,7 @@ inline void VerletListLennardJones::addForces_impl(ParticleArray& particles,
                 auto np_ii = nplist[in];
                 {
                     int np_lookup;
-                    real dist_x, dist_y, dist_z;
+                    simdreal dist_x, dist_y, dist_z;
                     {
                         dist_x = p_x - pa_p_x_nbr[np_ii];
                         dist_y = p_y - pa_p_y_nbr[np_ii];
@@ -198,7 +198,7 @@ inline void VerletListLennardJones::addForces_impl(ParticleArray& particles,
                         if (!ONETYPE) np_lookup = pa_type_nbr[np_ii] + p_lookup;
                     }
 
-                    real distSqr = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
+                    simdreal distSqr = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
                     if (!ONETYPE)
                     {
                         cutoffSqr_ = cutoffSqr[np_lookup];
@@ -206,9 +206,9 @@ inline void VerletListLennardJones::addForces_impl(ParticleArray& particles,
 
                     if (distSqr <= cutoffSqr_)
                     {
-                        real frac2 = 1.0 / distSqr;
-                        real frac6 = frac2 * frac2 * frac2;
-                        real ffactor;
+                        simdreal frac2 = simdreal(1.0) / distSqr;
+                        simdreal frac6 = frac2 * frac2 * frac2;
+                        simdreal ffactor;
 
                         if (ONETYPE)
                             ffactor = ff1_ * frac6 - ff2_;
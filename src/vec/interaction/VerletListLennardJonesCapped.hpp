@@ -64,19 +64,19 @@ protected:
               capradSqr(p.getCaprad() * p.getCaprad()),
               sigma(p.getSigma()),
               epsilon(p.getEpsilon()),
-              cfrac2((sigma / caprad) * (sigma / caprad)),
+              cfrac2((p.getSigma() / p.getCaprad()) * (p.getSigma() / p.getCaprad())),
               cfrac6(cfrac2 * cfrac2 * cfrac2)
         {
         }
 
-        const real ff1;
-        const real ff2;
-        const real caprad;
-        const real capradSqr;
-        const real sigma;
-        const real epsilon;
-        const real cfrac2;
-        const real cfrac6;
+        const simdreal ff1;
+        const simdreal ff2;
+        const simdreal caprad;
+        const simdreal capradSqr;
+        const simdreal sigma;
+        const simdreal epsilon;
+        const simdreal cfrac2;
+        const simdreal cfrac6;
     };
 
 public:
@@ -108,7 +108,7 @@ protected:
 
     size_t np_types, p_types;
     AlignedVector<LJCoefficients> ffs;
-    AlignedVector<real> cutoffSqr;
+    AlignedVector<simdreal> cutoffSqr;
     bool needRebuildPotential = true;
 };
 
@@ -146,7 +146,7 @@ inline void VerletListLennardJonesCapped::addForces_impl(
     using namespace vec::storage;
 
     {
-        real ff1_, ff2_, caprad_, capradSqr_, epsilon_, cutoffSqr_, cfrac6_;
+        simdreal ff1_, ff2_, caprad_, capradSqr_, epsilon_, cutoffSqr_, cfrac6_;
         if (ONETYPE)
         {
             ff1_ = ffs[0].ff1;
@@ -196,7 +196,7 @@ inline void VerletListLennardJonesCapped::addForces_impl(
                 auto np_ii = nplist[in];
                 {
                     int np_lookup;
-                    real dist_x, dist_y, dist_z;
+                    simdreal dist_x, dist_y, dist_z;
 
                     {
                         dist_x = p_x - pa_p_x[np_ii];
@@ -205,7 +205,7 @@ inline void VerletListLennardJonesCapped::addForces_impl(
                         if (!ONETYPE) np_lookup = pa_type[np_ii] + p_lookup;
                     }
 
-                    real distSqr = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
+                    simdreal distSqr = dist_x * dist_x + dist_y * dist_y + dist_z * dist_z;
                     if (!ONETYPE)
                     {
                         cutoffSqr_ = cutoffSqr[np_lookup];
@@ -223,11 +223,11 @@ inline void VerletListLennardJonesCapped::addForces_impl(
                             NO_CAP = distSqr > ffs[np_lookup].capradSqr;
                         }
 
-                        real ffactor;
+                        simdreal ffactor;
                         if (NO_CAP)
                         {
-                            const real frac2 = 1.0 / distSqr;
-                            const real frac6 = frac2 * frac2 * frac2;
+                            const simdreal frac2 = simdreal(1.0) / distSqr;
+                            const simdreal frac6 = frac2 * frac2 * frac2;
                             if (ONETYPE)
                                 ffactor = ff1_ * frac6 - ff2_;
                             else
@@ -237,12 +237,13 @@ inline void VerletListLennardJonesCapped::addForces_impl(
                         else
                         {
                             if (ONETYPE)
-                                ffactor = 48.0 * epsilon_ * cfrac6_ * (cfrac6_ - 0.5) /
-                                          (caprad_ * sqrt(distSqr));
+                                ffactor = simdreal(48.0) * epsilon_ * cfrac6_ *
+                                          (cfrac6_ - simdreal(0.5)) / (caprad_ * std::sqrt(distSqr));
                             else
-                                ffactor = 48.0 * ffs[np_lookup].epsilon * ffs[np_lookup].cfrac6 *
-                                          (ffs[np_lookup].cfrac6 - 0.5) /
-                                          (ffs[np_lookup].caprad * sqrt(distSqr));
+                                ffactor = simdreal(48.0) * ffs[np_lookup].epsilon *
+                                          ffs[np_lookup].cfrac6 *
+                                          (ffs[np_lookup].cfrac6 - simdreal(0.5)) /
+                                          (ffs[np_lookup].caprad * std::sqrt(distSqr));
                         }
 
                         f_x += dist_x * ffactor;
@@ -0,0 +1,209 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "python.hpp"
+#include "VerletListLennardJonesCoulombRSpace.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+void VerletListLennardJonesCoulombRSpace::addForces()
+{
+    auto& particles = verletList->getVectorization()->particles;
+    const auto& neighborList = verletList->getNeighborList();
+    const auto* __restrict plist = neighborList.plist.data();
+    const auto* __restrict prange = neighborList.prange.data();
+    const auto* __restrict nplist = neighborList.nplist.data();
+    const auto* __restrict q = particles.q.data();
+
+    const auto vlmaxtype = neighborList.max_type;
+    Potential max_pot = potentialArray.at(vlmaxtype, vlmaxtype);  // force a resize
+
+    const int ip_max = neighborList.plist.size();
+    for (int ip = 0; ip < ip_max; ip++)
+    {
+        const int p1 = plist[ip];
+        const auto type1 = particles.getType(p1);
+        const auto pos1 = particles.getPosition(p1);
+        const real q1 = q[p1];
+
+        const int in_min = prange[ip].first;
+        const int in_max = prange[ip].second;
+        for (int in = in_min; in < in_max; in++)
+        {
+            const int p2 = nplist[in];
+            const Potential& potential = potentialArray(type1, particles.getType(p2));
+
+            const Real3D r21 = pos1 - particles.getPosition(p2);
+            const real ffactor = potential._computePairForceFactor(r21.sqr(), q1 * q[p2]);
+            if (ffactor != 0.0)
+            {
+                const Real3D force = r21 * ffactor;
+                particles.addForce(p1, force);
+                particles.subForce(p2, force);
+            }
+        }
+    }
+}
+
+real VerletListLennardJonesCoulombRSpace::computeEnergy()
+{
+    real es = 0.0;
+
+    const auto& particles = verletList->getVectorization()->particles;
+    const auto& neighborList = verletList->getNeighborList();
+    const auto* __restrict plist = neighborList.plist.data();
+    const auto* __restrict prange = neighborList.prange.data();
+    const auto* __restrict nplist = neighborList.nplist.data();
+    const auto* __restrict q = particles.q.data();
+
+    const int ip_max = neighborList.plist.size();
+    for (int ip = 0; ip < ip_max; ip++)
+    {
+        const int p1 = plist[ip];
+        const auto type1 = particles.getType(p1);
+        const auto pos1 = particles.getPosition(p1);
+        const real q1 = q[p1];
+
+        const int in_min = prange[ip].first;
+        const int in_max = prange[ip].second;
+        for (int in = in_min; in < in_max; in++)
+        {
+            const int p2 = nplist[in];
+            const Potential& potential = getPotential(type1, particles.getType(p2));
+
+            const Real3D r21 = pos1 - particles.getPosition(p2);
+            es += potential._computePairEnergy(r21.sqr(), q1 * q[p2]);
+        }
+    }
+
+    // reduce over all CPUs
+    real esum;
+    boost::mpi::all_reduce(*getVerletList()->getSystem()->comm, es, esum, std::plus<real>());
+    return esum;
+}
+
+real VerletListLennardJonesCoulombRSpace::computeVirial()
+{
+    real w = 0.0;
+
+    const auto& particles = verletList->getVectorization()->particles;
+    const auto& neighborList = verletList->getNeighborList();
+    const auto* __restrict plist = neighborList.plist.data();
+    const auto* __restrict prange = neighborList.prange.data();
+    const auto* __restrict nplist = neighborList.nplist.data();
+    const auto* __restrict q = particles.q.data();
+
+    const int ip_max = neighborList.plist.size();
+    for (int ip = 0; ip < ip_max; ip++)
+    {
+        const int p1 = plist[ip];
+        const auto type1 = particles.getType(p1);
+        const auto pos1 = particles.getPosition(p1);
+        const real q1 = q[p1];
+
+        const int in_min = prange[ip].first;
+        const int in_max = prange[ip].second;
+        for (int in = in_min; in < in_max; in++)
+        {
+            const int p2 = nplist[in];
+            const Potential& potential = getPotential(type1, particles.getType(p2));
+
+            const Real3D r21 = pos1 - particles.getPosition(p2);
+            const real distSqr = r21.sqr();
+            w += distSqr * potential._computePairForceFactor(distSqr, q1 * q[p2]);
+        }
+    }
+
+    // reduce over all CPUs
+    real wsum;
+    boost::mpi::all_reduce(*mpiWorld, w, wsum, std::plus<real>());
+    return wsum;
+}
+
+void VerletListLennardJonesCoulombRSpace::computeVirialTensor(Tensor& w)
+{
+    Tensor wlocal(0.0);
+
+    const auto& particles = verletList->getVectorization()->particles;
+    const auto& neighborList = verletList->getNeighborList();
+    const auto* __restrict plist = neighborList.plist.data();
+    const auto* __restrict prange = neighborList.prange.data();
+    const auto* __restrict nplist = neighborList.nplist.data();
+    const auto* __restrict q = particles.q.data();
+
+    const int ip_max = neighborList.plist.size();
+    for (int ip = 0; ip < ip_max; ip++)
+    {
+        const int p1 = plist[ip];
+        const auto type1 = particles.getType(p1);
+        const auto pos1 = particles.getPosition(p1);
+        const real q1 = q[p1];
+
+        const int in_min = prange[ip].first;
+        const int in_max = prange[ip].second;
+        for (int in = in_min; in < in_max; in++)
+        {
+            const int p2 = nplist[in];
+            const Potential& potential = getPotential(type1, particles.getType(p2));
+
+            const Real3D r21 = pos1 - particles.getPosition(p2);
+            const real ffactor = potential._computePairForceFactor(r21.sqr(), q1 * q[p2]);
+            if (ffactor != 0.0) wlocal += Tensor(r21, r21 * ffactor);
+        }
+    }
+
+    // reduce over all CPUs
+    Tensor wsum(0.0);
+    boost::mpi::all_reduce(*mpiWorld, (double*)&wlocal, 6, (double*)&wsum, std::plus<double>());
+    w += wsum;
+}
+
+void VerletListLennardJonesCoulombRSpace::computeVirialTensor(Tensor& w, real z)
+{
+    LOG4ESPP_WARN(Potential::theLogger,
+                  "Warning! computeVirialTensor(Tensor& w, real z) is not yet implemented.");
+}
+
+void VerletListLennardJonesCoulombRSpace::computeVirialTensor(Tensor* w, int n)
+{
+    LOG4ESPP_WARN(Potential::theLogger,
+                  "Warning! computeVirialTensor(Tensor* w, int n) is not yet implemented.");
+}
+
+//////////////////////////////////////////////////
+// REGISTRATION WITH PYTHON
+//////////////////////////////////////////////////
+void VerletListLennardJonesCoulombRSpace::registerPython()
+{
+    using namespace espressopp::python;
+
+    class_<VerletListLennardJonesCoulombRSpace, bases<Interaction> >(
+        "vec_interaction_VerletListLennardJonesCoulombRSpace", init<std::shared_ptr<VerletList> >())
+        .def("getVerletList", &VerletListLennardJonesCoulombRSpace::getVerletList)
+        .def("setPotential", &VerletListLennardJonesCoulombRSpace::setPotential)
+        .def("getPotential", &VerletListLennardJonesCoulombRSpace::getPotentialPtr);
+}
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
@@ -0,0 +1,64 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_VERLETLISTLENNARDJONESCOULOMBRSPACE_HPP
+#define VEC_INTERACTION_VERLETLISTLENNARDJONESCOULOMBRSPACE_HPP
+
+#include "types.hpp"
+#include "interaction/LennardJonesCoulombRSpace.hpp"
+#include "VerletListInteractionTemplate.hpp"
+#include "vec/VerletList.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Lennard-Jones plus real-space Coulomb pairs
+    (espressopp.interaction.LennardJonesCoulombRSpace) on the vectorized
+    Verlet list, with the charges read from the particle arrays. The
+    vectorized Verlet list has no exclusions, so there is no exclusion
+    correction here. */
+class VerletListLennardJonesCoulombRSpace
+    : public VerletListInteractionTemplate<espressopp::interaction::LennardJonesCoulombRSpace>
+{
+public:
+    VerletListLennardJonesCoulombRSpace(std::shared_ptr<VerletList> _verletList)
+        : VerletListInteractionTemplate<espressopp::interaction::LennardJonesCoulombRSpace>(
+              _verletList)
+    {
+    }
+
+    virtual void addForces();
+    virtual real computeEnergy();
+    virtual real computeVirial();
+    virtual void computeVirialTensor(Tensor& w);
+    virtual void computeVirialTensor(Tensor& w, real z);
+    virtual void computeVirialTensor(Tensor* w, int n);
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_VERLETLISTLENNARDJONESCOULOMBRSPACE_HPP
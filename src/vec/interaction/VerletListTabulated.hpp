@@ -0,0 +1,54 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ESPP_CLASS
+#ifndef VEC_INTERACTION_VERLETLISTTABULATED_HPP
+#define VEC_INTERACTION_VERLETLISTTABULATED_HPP
+
+#include "types.hpp"
+#include "interaction/Tabulated.hpp"
+#include "VerletListInteractionTemplate.hpp"
+#include "vec/VerletList.hpp"
+
+namespace espressopp
+{
+namespace vec
+{
+namespace interaction
+{
+/** Tabulated pair potentials (espressopp.interaction.Tabulated) on the
+    vectorized Verlet list. The potential is evaluated inline from its
+    r^2 table, so the pair loop has no sqrt and no virtual call. */
+class VerletListTabulated
+    : public VerletListInteractionTemplate<espressopp::interaction::Tabulated>
+{
+public:
+    VerletListTabulated(std::shared_ptr<VerletList> _verletList)
+        : VerletListInteractionTemplate<espressopp::interaction::Tabulated>(_verletList)
+    {
+    }
+
+    static void registerPython();
+};
+}  // namespace interaction
+}  // namespace vec
+}  // namespace espressopp
+
+#endif  // VEC_INTERACTION_VERLETLISTTABULATED_HPP
@@ -23,3 +23,11 @@ from espressopp.vec.interaction.LennardJones import *
 from espressopp.vec.interaction.LennardJonesCapped import *
 from espressopp.vec.interaction.FENE import *
 from espressopp.vec.interaction.Cosine import *
+from espressopp.vec.interaction.VerletListTabulated import *
+from espressopp.vec.interaction.VerletListLennardJonesCoulombRSpace import *
+from espressopp.vec.interaction.FixedPairListHarmonic import *
+from espressopp.vec.interaction.FixedPairListTabulated import *
+from espressopp.vec.interaction.FixedTripleListAngularHarmonic import *
+from espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonic import *
+from espressopp.vec.interaction.FixedQuadrupleListDihedralRB import *
+from espressopp.vec.interaction.VerletListCoulombRSpace import *
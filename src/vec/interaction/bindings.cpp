@@ -25,6 +25,14 @@
 #include "LennardJonesCapped.hpp"
 #include "FENE.hpp"
 #include "Cosine.hpp"
+#include "VerletListTabulated.hpp"
+#include "VerletListLennardJonesCoulombRSpace.hpp"
+#include "FixedPairListHarmonic.hpp"
+#include "FixedPairListTabulated.hpp"
+#include "FixedTripleListAngularHarmonic.hpp"
+#include "FixedQuadrupleListDihedralHarmonic.hpp"
+#include "FixedQuadrupleListDihedralRB.hpp"
+#include "VerletListCoulombRSpace.hpp"
 
 namespace espressopp
 {
@@ -38,6 +46,14 @@ void registerPython()
     LennardJonesCapped::registerPython();
     FENE::registerPython();
     Cosine::registerPython();
+    VerletListTabulated::registerPython();
+    VerletListLennardJonesCoulombRSpace::registerPython();
+    FixedPairListHarmonic::registerPython();
+    FixedPairListTabulated::registerPython();
+    FixedTripleListAngularHarmonic::registerPython();
+    FixedQuadrupleListDihedralHarmonic::registerPython();
+    FixedQuadrupleListDihedralRB::registerPython();
+    VerletListCoulombRSpace::registerPython();
 }
 }  // namespace interaction
 }  // namespace vec
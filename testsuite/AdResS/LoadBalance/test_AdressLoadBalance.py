@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+#
+
+import espressopp
+import mpi4py.MPI as MPI
+import unittest
+
+class TestAdressLoadBalance(unittest.TestCase):
+    halfCellInt = 1
+
+    def setUp(self):
+        # same slab setup as in ForceAdResS
+        system = espressopp.System()
+        box = (10, 10, 10)
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = 0.3
+        system.comm = MPI.COMM_WORLD
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size,box,rc=1.5,skin=system.skin)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=1.5, skin=system.skin,
+                                                    halfCellInt=self.halfCellInt)
+        system.storage = espressopp.storage.DomainDecompositionAdress(system, nodeGrid, cellGrid,
+                                                                      halfCellInt=self.halfCellInt)
+
+        particle_list = [
+            (1,  1, espressopp.Real3D(5.5, 5.0, 5.0), 1.0, 0),
+            (2,  1, espressopp.Real3D(6.5, 5.0, 5.0), 1.0, 0),
+            (3,  1, espressopp.Real3D(7.5, 5.0, 5.0), 1.0, 0),
+            (4,  1, espressopp.Real3D(8.5, 5.0, 5.0), 1.0, 0),
+            (5,  1, espressopp.Real3D(9.5, 5.0, 5.0), 1.0, 0),
+            (6,  0, espressopp.Real3D(5.5, 5.0, 5.0), 1.0, 1),
+            (7,  0, espressopp.Real3D(6.5, 5.0, 5.0), 1.0, 1),
+            (8,  0, espressopp.Real3D(7.5, 5.0, 5.0), 1.0, 1),
+            (9,  0, espressopp.Real3D(8.5, 5.0, 5.0), 1.0, 1),
+            (10, 0, espressopp.Real3D(9.5, 5.0, 5.0), 1.0, 1),
+        ]
+        tuples = [(1,6),(2,7),(3,8),(4,9),(5,10)]
+        system.storage.addParticles(particle_list, 'id', 'type', 'pos', 'mass','adrat')
+        ftpl = espressopp.FixedTupleListAdress(system.storage)
+        ftpl.addTuples(tuples)
+        system.storage.setFixedTuplesAdress(ftpl)
+        system.storage.decompose()
+
+        vl = espressopp.VerletListAdress(system, cutoff=1.5, adrcut=1.5,
+                                dEx=2.0, dHy=1.0, adrCenter=[5.0, 5.0, 5.0], sphereAdr=False)
+        interNB = espressopp.interaction.VerletListAdressLennardJones2(vl, ftpl)
+        potWCA1  = espressopp.interaction.LennardJones(epsilon=1.0, sigma=1.0, shift='auto', cutoff=1.4)
+        potWCA2 = espressopp.interaction.LennardJones(epsilon=0.5, sigma=1.0, shift='auto', cutoff=1.4)
+        interNB.setPotentialAT(type1=0, type2=0, potential=potWCA1) # AT
+        interNB.setPotentialCG(type1=1, type2=1, potential=potWCA2) # CG
+        system.addInteraction(interNB)
+
+        integrator = espressopp.integrator.VelocityVerlet(system)
+        integrator.dt = 0.01
+        adress = espressopp.integrator.Adress(system,vl,ftpl)
+        integrator.addExtension(adress)
+        espressopp.tools.AdressDecomp(system, integrator)
+
+        self.system = system
+        self.integrator = integrator
+        self.interNB = interNB
+
+    def check_trajectory(self):
+        # reference values of ForceAdResS test_slab after ten steps
+        after = [self.system.storage.getParticle(i).pos[0] for i in range(1,6)]
+        for x, ref in zip(after, [5.413171, 6.500459, 7.522099, 8.512569, 9.551701]):
+            self.assertAlmostEqual(x, ref, places=5)
+        self.assertAlmostEqual(self.interNB.computeEnergy(), -0.209015, places=5)
+
+    def test_set_boundaries(self):
+        bounds = self.system.storage.getNodeBoundaries(0)
+        self.assertAlmostEqual(bounds[0], 0.0)
+        self.assertAlmostEqual(bounds[-1], 10.0)
+
+        # regridding in the middle of the run must not change the trajectory
+        self.integrator.run(5)
+        self.system.storage.setNodeBoundaries(0, bounds)
+        self.integrator.run(5)
+        self.check_trajectory()
+
+    def test_invalid_boundaries(self):
+        bounds = self.system.storage.getNodeBoundaries(0)
+        bounds[-1] = 5.0
+        with self.assertRaises(Exception):
+            self.system.storage.setNodeBoundaries(0, bounds)
+
+    def test_extension(self):
+        lb = espressopp.integrator.AdressLoadBalance(self.system, interval=2, axis=0)
+        self.integrator.addExtension(lb)
+        self.integrator.run(10)
+        self.check_trajectory()
+        self.assertGreaterEqual(lb.imbalance, 1.0)
+
+class TestAdressLoadBalanceHalfCells(TestAdressLoadBalance):
+    halfCellInt = 2
+
+    def expected_cells(self, width):
+        # what tools.decomp.cellGrid hands the constructor for a domain of this width
+        rc_skin = self.system.maxCutoff + self.system.skin
+        return max(1, int(width * self.halfCellInt / rc_skin))
+
+    def test_cell_grid(self):
+        storage = self.system.storage
+        bounds = storage.getNodeBoundaries(0)
+        before = storage.getCellGrid()
+        storage.setNodeBoundaries(0, bounds)
+        self.assertEqual(storage.getCellGrid(), before)
+        self.assertEqual(storage.getCellGrid()[0], self.expected_cells(bounds[1] - bounds[0]))
+
+        if len(bounds) > 2:
+            # shift the first boundary and check the controller's domain is regridded alike
+            shifted = list(bounds)
+            shifted[1] += 0.5 * (shifted[2] - shifted[1] - 1.8)
+            storage.setNodeBoundaries(0, shifted)
+            self.assertEqual(storage.getCellGrid()[0],
+                             self.expected_cells(shifted[1] - shifted[0]))
+
+if __name__ == '__main__':
+    unittest.main()
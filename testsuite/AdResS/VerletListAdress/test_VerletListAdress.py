@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+#
+
+# Compares the zones and pair lists of VerletListAdress with the set based classification it
+# replaced, written out in Python.
+
+import random
+import espressopp
+import mpi4py.MPI as MPI
+import unittest
+
+box = (10.0, 10.0, 10.0)
+skin = 0.3
+cutoff = 1.5
+dEx = 2.0
+dHy = 1.0
+center = (5.0, 5.0, 5.0)
+
+
+def min_image(d):
+    return [x - L*round(x/L) for x, L in zip(d, box)]
+
+
+def reference(positions, sphereAdr, exclusions):
+    adrsq = (dEx + dHy + skin)**2
+    cutsq = (cutoff + skin)**2
+    adrZone = set()
+    for pid, pos in positions.items():
+        d = min_image([pos[k] - center[k] for k in range(3)])
+        distsq = d[0]*d[0] + d[1]*d[1] + d[2]*d[2] if sphereAdr else d[0]*d[0]
+        if distsq <= adrsq:
+            adrZone.add(pid)
+
+    pairs = set()
+    adrPairs = set()
+    pids = sorted(positions)
+    for i, pid1 in enumerate(pids):
+        for pid2 in pids[i+1:]:
+            if (pid1, pid2) in exclusions or (pid2, pid1) in exclusions:
+                continue
+            d = min_image([positions[pid1][k] - positions[pid2][k] for k in range(3)])
+            if d[0]*d[0] + d[1]*d[1] + d[2]*d[2] > cutsq:
+                continue
+            if pid1 in adrZone or pid2 in adrZone:
+                adrPairs.add((pid1, pid2))
+            else:
+                pairs.add((pid1, pid2))
+    return adrZone, pairs, adrPairs
+
+
+def merged(lists):
+    # pairs of all CPUs, every pair must be found only once
+    pairs = [tuple(sorted(p)) for l in lists for p in l]
+    return len(pairs), set(pairs)
+
+
+class TestVerletListAdress(unittest.TestCase):
+    def setUp(self):
+        system = espressopp.System()
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = skin
+        system.comm = MPI.COMM_WORLD
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size, box,
+                                                    rc=cutoff, skin=system.skin)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=cutoff, skin=system.skin)
+        system.storage = espressopp.storage.DomainDecompositionAdress(system, nodeGrid, cellGrid)
+        self.system = system
+
+        # one atom per virtual particle
+        rnd = random.Random(31)
+        self.nvp = 400
+        self.positions = {}
+        particle_list = []
+        tuples = []
+        for pid in range(1, self.nvp + 1):
+            pos = [rnd.uniform(0.0, L) for L in box]
+            self.positions[pid] = pos
+            particle_list.append((pid, 1, espressopp.Real3D(pos), 1.0, 0))
+            particle_list.append((pid + self.nvp, 0, espressopp.Real3D(pos), 1.0, 1))
+            tuples.append((pid, pid + self.nvp))
+        self.system.storage.addParticles(particle_list, 'id', 'type', 'pos', 'mass', 'adrat')
+        self.ftpl = espressopp.FixedTupleListAdress(self.system.storage)
+        self.ftpl.addTuples(tuples)
+        self.system.storage.setFixedTuplesAdress(self.ftpl)
+        self.system.storage.decompose()
+
+    def check(self, sphereAdr, exclusions=[]):
+        vl = espressopp.VerletListAdress(self.system, cutoff=cutoff, adrcut=cutoff, dEx=dEx,
+                                         dHy=dHy, adrCenter=list(center),
+                                         exclusionlist=exclusions, sphereAdr=sphereAdr)
+        adrZone, pairs, adrPairs = reference(self.positions, sphereAdr, set(exclusions))
+
+        zone = [pid for l in vl.getAdrZone() for pid in l]
+        self.assertEqual(len(zone), len(set(zone)))
+        self.assertEqual(set(zone), adrZone)
+        self.assertGreater(len(adrZone), 0)
+        self.assertLess(len(adrZone), self.nvp)
+
+        n, vlPairs = merged(vl.getAllPairs())
+        self.assertEqual(n, len(vlPairs))
+        self.assertEqual(vlPairs, pairs)
+        self.assertEqual(vl.totalSize(), len(pairs))
+
+        n, vlAdrPairs = merged(vl.getAllAdrPairs())
+        self.assertEqual(n, len(vlAdrPairs))
+        self.assertEqual(vlAdrPairs, adrPairs)
+
+    def test_sphere(self):
+        self.check(True)
+
+    def test_slab(self):
+        self.check(False)
+
+    def test_exclusions(self):
+        # exclude some pairs in both zones
+        adrZone, pairs, adrPairs = reference(self.positions, True, set())
+        exclusions = sorted(pairs)[::3] + sorted(adrPairs)[::3]
+        self.check(True, exclusions)
+
+
+if __name__ == '__main__':
+    unittest.main()
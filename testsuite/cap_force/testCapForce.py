@@ -212,5 +212,60 @@ class TestCaseCapForce(unittest.TestCase):
         self.assertTrue(math.fabs(particle1.f[0]) == 1.0, "The force of particle 1 is not capped.")
         self.assertTrue(math.fabs(particle2.f[0]) > 1.0, "The force of particle 2 is capped.")
 
+    def test_cap_force_after_thermostats(self):
+        # set up normal domain decomposition
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size)
+        cellGrid = espressopp.tools.decomp.cellGrid(self.box, nodeGrid, 1.5, 0.3)
+        self.system.storage = espressopp.storage.DomainDecomposition(self.system, nodeGrid, cellGrid)
+
+        # add some particles (normal, coarse-grained particles only)
+        particle_list = [
+            (1, 0, 0, espressopp.Real3D(4.95, 5.0, 5.0), 1.0, 0, 1.),
+            (2, 0, 0, espressopp.Real3D(5.05, 5.0, 5.0), 1.0, 0, 1.),
+        ]
+        self.system.storage.addParticles(particle_list, 'id', 'type', 'q', 'pos', 'mass','adrat', 'radius')
+        self.system.storage.decompose()
+
+        # integrator
+        integrator = espressopp.integrator.VelocityVerlet(self.system)
+        integrator.dt = 0.005
+
+        # Lennard-Jones with Verlet list
+        rc_lj   = pow(2.0, 1.0/6.0)
+        vl      = espressopp.VerletList(self.system, cutoff = rc_lj)
+        potLJ   = espressopp.interaction.LennardJones(epsilon=1., sigma=1., cutoff=rc_lj, shift=0)
+        interLJ = espressopp.interaction.VerletListLennardJones(vl)
+        interLJ.setPotential(type1=0, type2=0, potential=potLJ)
+        self.system.addInteraction(interLJ)
+
+        # both thermostats add their forces in aftCalcF before the capping slot
+        langevin = espressopp.integrator.LangevinThermostat(self.system)
+        langevin.gamma = 1.0
+        langevin.temperature = 1.0
+        integrator.addExtension(langevin)
+
+        particle_group = espressopp.ParticleGroup(self.system.storage)
+        particle_group.add(1)
+        particle_group.add(2)
+        hot = espressopp.integrator.LangevinThermostatOnGroup(self.system, particle_group)
+        hot.gamma = 1.0
+        hot.temperature = 1.0e6
+        integrator.addExtension(hot)
+
+        # create a CapForce instance, it has to cap the forces of both thermostats
+        capforce       = espressopp.integrator.CapForce(self.system, 1.0)
+        integrator.addExtension(capforce)
+
+        # run 1 step
+        integrator.run(1)
+
+        particle1 = self.system.storage.getParticle(1)
+        particle2 = self.system.storage.getParticle(2)
+        print(particle1.f, particle2.f)
+
+        # run checks
+        self.assertAlmostEqual(particle1.f.abs(), 1.0, places=10, msg="The force of particle 1 is not capped.")
+        self.assertAlmostEqual(particle2.f.abs(), 1.0, places=10, msg="The force of particle 2 is not capped.")
+
 if __name__ == '__main__':
     unittest.main()
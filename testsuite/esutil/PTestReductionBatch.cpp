@@ -0,0 +1,85 @@
+/*
+  Copyright (C) 2026
+      Max Planck Institute for Polymer Research & JGU Mainz
+
+  This file is part of ESPResSo++.
+
+  ESPResSo++ is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  ESPResSo++ is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define PARALLEL_TEST_MODULE ReductionBatch
+#define BOOST_TEST_MODULE ReductionBatch
+
+#include "include/ut.hpp"
+
+#include "mpi.hpp"
+#include "esutil/Collectives.hpp"
+
+using namespace espressopp;
+using namespace espressopp::esutil;
+
+// Check sums of scalars, vectors and tensors and a maximum in one batch
+BOOST_AUTO_TEST_CASE(sum_and_max)
+{
+    int rank = mpiWorld->rank();
+    int size = mpiWorld->size();
+    real n = size;
+
+    ReductionBatch batch(mpiWorld);
+    ReductionBatch::Handle hScalar = batch.addSum(real(rank + 1));
+    ReductionBatch::Handle hVector = batch.addSum(Real3D(1.0, rank, -2.0 * rank));
+    ReductionBatch::Handle hTensor = batch.addSum(Tensor(1.0, 2.0, 3.0, 4.0, 5.0, rank));
+    ReductionBatch::Handle hMax = batch.addMax(real(rank * rank));
+
+    BOOST_CHECK(!batch.isStarted());
+    BOOST_CHECK_CLOSE(batch.sum(hScalar), 0.5 * n * (n + 1), 1e-10);
+    BOOST_CHECK(batch.isStarted());
+
+    real ranks = 0.5 * n * (n - 1);
+    Real3D v = batch.sumReal3D(hVector);
+    BOOST_CHECK_CLOSE(v[0], n, 1e-10);
+    BOOST_CHECK_SMALL(v[1] - ranks, 1e-10);
+    BOOST_CHECK_SMALL(v[2] + 2.0 * ranks, 1e-10);
+
+    Tensor t = batch.sumTensor(hTensor);
+    for (int i = 0; i < 5; i++) BOOST_CHECK_CLOSE(t[i], (i + 1) * n, 1e-10);
+    BOOST_CHECK_SMALL(t[5] - ranks, 1e-10);
+
+    BOOST_CHECK_EQUAL(batch.max(hMax), real((size - 1) * (size - 1)));
+}
+
+// Check that the batch can be refilled after clear() and that start() can be called early
+BOOST_AUTO_TEST_CASE(clear_and_start)
+{
+    ReductionBatch batch(mpiWorld);
+    ReductionBatch::Handle h = batch.addSum(1.0);
+    BOOST_CHECK_EQUAL(batch.sum(h), real(mpiWorld->size()));
+    BOOST_CHECK_THROW(batch.addSum(1.0), std::runtime_error);
+
+    batch.clear();
+    BOOST_CHECK(!batch.isStarted());
+    h = batch.addMax(real(mpiWorld->rank()));
+    batch.start();
+    batch.wait();
+    BOOST_CHECK_EQUAL(batch.max(h), real(mpiWorld->size() - 1));
+}
+
+// Check an empty batch
+BOOST_AUTO_TEST_CASE(empty)
+{
+    ReductionBatch batch(mpiWorld);
+    batch.wait();
+    BOOST_CHECK(batch.isStarted());
+    batch.clear();
+}
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import math
+import random
+import unittest
+import espressopp
+from espressopp import Real3D
+
+class TestEwaldStructureFactorCache(unittest.TestCase):
+    def setUp(self):
+        self.prefactor, self.alpha, self.kmax = 138.935, 1.1, 5
+        box = (6.0, 6.0, 6.0)
+        self.system, self.integrator = espressopp.standard_system.Default(box=box, rc=2.0, skin=0.3)
+        # a neutral jittered lattice, every third particle uncharged
+        random.seed(4321)
+        n, a = 4, box[0] / 4
+        self.pids = []
+        particles = []
+        for i in range(n**3):
+            site = (i % n, (i // n) % n, i // (n * n))
+            pos = Real3D(*[(s + 0.5) * a + random.uniform(-0.2, 0.2) for s in site])
+            q = 0.0 if i % 3 == 2 else (0.5 if i % 2 == 0 else -0.5)
+            particles.append([i + 1, 0, 1.0, pos, q])
+            self.pids.append(i + 1)
+        self.system.storage.addParticles(particles, 'id', 'type', 'mass', 'pos', 'q')
+        self.system.storage.decompose()
+
+        # kept for the whole test, so its S(k) is reused between the calls
+        self.cached = self.ewald()
+
+    def ewald(self):
+        pot = espressopp.interaction.CoulombKSpaceEwald(self.system, self.prefactor, self.alpha, self.kmax)
+        return espressopp.interaction.CellListCoulombKSpaceEwald(self.system.storage, pot)
+
+    def forces(self, inter):
+        self.system.addInteraction(inter)
+        self.integrator.run(0)
+        self.system.removeInteraction(0)
+        return [self.system.storage.getParticle(pid).f for pid in self.pids]
+
+    def assertSameEnergy(self):
+        fresh = self.ewald()
+        reference = fresh.computeEnergy()
+        self.assertAlmostEqual(self.cached.computeEnergy(), reference, delta=1e-10 * abs(reference))
+
+    def assertSameVirial(self):
+        fresh = self.ewald()
+        reference = fresh.computeVirial()
+        self.assertAlmostEqual(self.cached.computeVirial(), reference, delta=1e-10 * abs(reference))
+
+    def assertSameForces(self):
+        f_cached = self.forces(self.cached)
+        f_ref = self.forces(self.ewald())
+        scale = max(math.sqrt(f.sqr()) for f in f_ref)
+        for f1, f2 in zip(f_cached, f_ref):
+            for k in range(3):
+                self.assertAlmostEqual(f1[k], f2[k], delta=1e-10 * scale)
+
+    def test_move_and_recharge(self):
+        energy = self.cached.computeEnergy()
+        self.assertSameEnergy()
+
+        # move a charge between energy and force, and between force and virial
+        p = self.system.storage.getParticle(1)
+        self.system.storage.modifyParticle(1, 'pos', p.pos + Real3D(0.1, -0.05, 0.07))
+        self.assertSameForces()
+        self.assertNotAlmostEqual(self.cached.computeEnergy(), energy, places=6)
+        p = self.system.storage.getParticle(2)
+        self.system.storage.modifyParticle(2, 'pos', p.pos + Real3D(-0.08, 0.1, 0.0))
+        self.assertSameVirial()
+
+        # change a charge, swap one with an uncharged particle
+        energy = self.cached.computeEnergy()
+        self.system.storage.modifyParticle(4, 'q', 0.8)
+        self.assertSameEnergy()
+        self.assertNotAlmostEqual(self.cached.computeEnergy(), energy, places=6)
+        self.system.storage.modifyParticle(1, 'q', 0.0)
+        self.system.storage.modifyParticle(3, 'q', 0.5)
+        self.assertSameForces()
+        self.assertSameVirial()
+        self.assertSameEnergy()
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import math
+import random
+import unittest
+import espressopp
+from espressopp import Real3D
+
+class TestLennardJonesCoulombRSpace(unittest.TestCase):
+    def setUp(self):
+        self.rc, self.alpha, self.prefactor = 2.5, 1.2, 138.935
+        self.box = (8.0, 8.0, 8.0)
+        # jittered lattice, no close contacts
+        random.seed(12345)
+        self.particles = []
+        n, a = 6, self.box[0] / 6
+        for i in range(n**3):
+            site = (i % n, (i // n) % n, i // (n * n))
+            pos = Real3D(*[(s + 0.5) * a + random.uniform(-0.2, 0.2) for s in site])
+            self.particles.append([i + 1, i % 2, 1.0, pos, 0.4 if i % 2 == 0 else -0.4])
+        self.system, self.integrator = self.build(espressopp.standard_system.Default)
+
+    def build(self, Default):
+        system, integrator = Default(box=self.box, rc=self.rc, skin=0.3)
+        system.storage.addParticles(self.particles, 'id', 'type', 'mass', 'pos', 'q')
+        system.storage.decompose()
+        return system, integrator
+
+    def potential(self):
+        return espressopp.interaction.LennardJonesCoulombRSpace(epsilon=1.0, sigma=0.3, prefactor=self.prefactor,
+                                                                alpha=self.alpha, cutoff=self.rc)
+
+    def fused(self, vl, VerletListLennardJonesCoulombRSpace=None):
+        if VerletListLennardJonesCoulombRSpace is None:
+            VerletListLennardJonesCoulombRSpace = espressopp.interaction.VerletListLennardJonesCoulombRSpace
+        inter = VerletListLennardJonesCoulombRSpace(vl)
+        for t1 in range(2):
+            for t2 in range(t1, 2):
+                inter.setPotential(type1=t1, type2=t2, potential=self.potential())
+        return inter
+
+    def forces(self, system, integrator, interactions):
+        for inter in interactions:
+            system.addInteraction(inter)
+        integrator.run(0)
+        return [system.storage.getParticle(p[0]).f for p in self.particles]
+
+    def assertClose(self, a, b, scale):
+        self.assertAlmostEqual(a, b, delta=1e-5 * scale)
+
+    def test_separate_interactions(self):
+        vl = espressopp.VerletList(self.system, cutoff=self.rc)
+        interLJ = espressopp.interaction.VerletListLennardJones(vl)
+        for t1 in range(2):
+            for t2 in range(t1, 2):
+                interLJ.setPotential(type1=t1, type2=t2, potential=espressopp.interaction.LennardJones(
+                    epsilon=1.0, sigma=0.3, cutoff=self.rc))
+        interC = espressopp.interaction.VerletListCoulombRSpace(vl)
+        potC = espressopp.interaction.CoulombRSpace(prefactor=self.prefactor, alpha=self.alpha, cutoff=self.rc)
+        for t1 in range(2):
+            for t2 in range(t1, 2):
+                interC.setPotential(t1, t2, potC)
+        fused = self.fused(vl)
+
+        reference = interLJ.computeEnergy() + interC.computeEnergy()
+        self.assertClose(fused.computeEnergy(), reference, abs(reference))
+        reference = interLJ.computeVirial() + interC.computeVirial()
+        self.assertClose(fused.computeVirial(), reference, abs(reference))
+
+        f_ref = self.forces(self.system, self.integrator, [interLJ, interC])
+        self.system.removeInteraction(1)
+        self.system.removeInteraction(0)
+        f_fused = self.forces(self.system, self.integrator, [fused])
+        scale = max(math.sqrt(f.sqr()) for f in f_ref)
+        for f1, f2 in zip(f_fused, f_ref):
+            for k in range(3):
+                self.assertClose(f1[k], f2[k], scale)
+
+    def test_vectorized(self):
+        vl = espressopp.VerletList(self.system, cutoff=self.rc)
+        fused = self.fused(vl)
+        energy, virial = fused.computeEnergy(), fused.computeVirial()
+        f_ref = self.forces(self.system, self.integrator, [fused])
+
+        system, integrator = self.build(espressopp.vec.standard_system.Default)
+        vvl = espressopp.vec.VerletList(system, cutoff=self.rc)
+        vfused = self.fused(vvl, espressopp.vec.interaction.VerletListLennardJonesCoulombRSpace)
+        # looser with single precision pair kernels
+        places = 5 if espressopp.vec.mixedPrecision else 8
+        self.assertAlmostEqual(vfused.computeEnergy() / energy, 1.0, places)
+        self.assertAlmostEqual(vfused.computeVirial() / virial, 1.0, places)
+
+        f_vec = self.forces(system, integrator, [vfused])
+        scale = max(math.sqrt(f.sqr()) for f in f_ref)
+        for f1, f2 in zip(f_vec, f_ref):
+            for k in range(3):
+                self.assertAlmostEqual(f1[k] / scale, f2[k] / scale, places)
+
+    def test_exclusion_correction(self):
+        vl = espressopp.VerletList(self.system, cutoff=self.rc)
+        energy = self.fused(vl).computeEnergy()
+        vlex = espressopp.VerletList(self.system, cutoff=self.rc, exclusionlist=[(1, 2)])
+        energyex = self.fused(vlex).computeEnergy()
+
+        p1 = self.system.storage.getParticle(1)
+        p2 = self.system.storage.getParticle(2)
+        d = self.system.bc.getMinimumImageVector(p1.pos, p2.pos)
+        r = math.sqrt(d.sqr())
+        qq = p1.q * p2.q
+        pair = 0.0
+        if r < self.rc:
+            pot = self.potential()
+            frac6 = (0.3 / r)**6
+            pair = 4.0 * (frac6 * frac6 - frac6) - pot.shift + self.prefactor * qq * math.erfc(self.alpha * r) / r
+        correction = -self.prefactor * qq * math.erf(self.alpha * r) / r
+        self.assertAlmostEqual(energyex, energy - pair + correction, delta=1e-4)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+
+import struct
+import unittest
+
+box = (10, 10, 10)
+rc = 1.5
+skin = 0.3
+numParticles = 20
+
+class TestCheckpoint(unittest.TestCase):
+    def setUp(self):
+        system = espressopp.System()
+        system.rng = espressopp.esutil.RNG()
+        system.rng.seed(1)
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = skin
+        system.comm = MPI.COMM_WORLD
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size, box, rc=rc, skin=skin)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=rc, skin=skin)
+        system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+        # a single chain along x
+        particle_list = [(pid, 0, espressopp.Real3D(0.5 + 1.0 * (pid % 10), 5.0 + 1.0 * (pid // 10), 5.0))
+                         for pid in range(1, numParticles + 1)]
+        system.storage.addParticles(particle_list, 'id', 'type', 'pos')
+        system.storage.decompose()
+
+        bonds = [(pid, pid + 1) for pid in range(1, numParticles)]
+        fpl = espressopp.FixedPairList(system.storage)
+        fpl.addBonds(bonds)
+        harmonic = espressopp.interaction.FixedPairListHarmonic(system, fpl,
+                       potential=espressopp.interaction.Harmonic(K=10.0, r0=1.0))
+        system.addInteraction(harmonic)
+
+        vl = espressopp.VerletList(system, cutoff=rc)
+        vl.exclude(bonds)
+        lj = espressopp.interaction.VerletListLennardJones(vl)
+        lj.setPotential(type1=0, type2=0, potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+        system.addInteraction(lj)
+
+        integrator = espressopp.integrator.VelocityVerlet(system)
+        integrator.dt = 0.005
+        langevin = espressopp.integrator.LangevinThermostat(system)
+        langevin.gamma = 1.0
+        langevin.temperature = 1.0
+        integrator.addExtension(langevin)
+
+        self.system = system
+        self.integrator = integrator
+        self.fpl = fpl
+        self.vl = vl
+
+    def positions(self):
+        return [self.system.storage.getParticle(pid).pos[d] for pid in range(1, numParticles + 1) for d in range(3)]
+
+    def test_restart(self):
+        checkpoint = espressopp.io.Checkpoint(self.system, self.integrator, 'checkpoint.chk')
+        checkpoint.addFixedPairList(self.fpl)
+        checkpoint.addVerletList(self.vl)
+
+        self.integrator.run(20)
+        checkpoint.save()
+        savedStep = self.integrator.step
+        savedPositions = self.positions()
+
+        self.integrator.run(20)
+        reference = self.positions()
+
+        # break the setup, the restore has to bring everything back; 1 and 11 are neighbours
+        # within the cutoff, so a surviving exclusion would change the trajectory
+        self.fpl.addBonds([(1, 3)])
+        self.vl.exclude([(1, 11)])
+        self.system.rng.seed(7)
+        checkpoint.restore()
+
+        self.assertEqual(self.integrator.step, savedStep)
+        self.assertEqual(self.fpl.totalSize(), numParticles - 1)
+        self.assertEqual(self.positions(), savedPositions)
+
+        self.integrator.run(20)
+        for restarted, ref in zip(self.positions(), reference):
+            self.assertAlmostEqual(restarted, ref, places=8)
+
+    def test_node_grid_mismatch(self):
+        checkpoint = espressopp.io.Checkpoint(self.system, self.integrator, 'checkpoint_grid.chk')
+        checkpoint.save()
+
+        # the header holds magic, number of ranks and the node grid as 64 bit integers
+        with open('checkpoint_grid.chk', 'r+b') as f:
+            f.seek(16)
+            nx = struct.unpack('<q', f.read(8))[0]
+            f.seek(16)
+            f.write(struct.pack('<q', nx + 1))
+        with self.assertRaises(RuntimeError):
+            checkpoint.restore()
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+import os
+
+import unittest
+
+box = (10, 10, 10)
+rc = 1.5
+skin = 0.3
+precision = 0.01
+
+class TestDumpCompressed(unittest.TestCase):
+    def setUp(self):
+        system = espressopp.System()
+        system.rng = espressopp.esutil.RNG()
+        system.rng.seed(1)
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = skin
+        system.comm = MPI.COMM_WORLD
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size, box, rc=rc, skin=skin)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=rc, skin=skin)
+        system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+        self.pids = list(range(1, 1001))
+        particle_list = [(pid, 0, espressopp.Real3D(0.5 + (pid - 1) % 10, 0.5 + (pid - 1) // 10 % 10, 0.5 + (pid - 1) // 100))
+                         for pid in self.pids]
+        system.storage.addParticles(particle_list, 'id', 'type', 'pos')
+        system.storage.decompose()
+
+        vl = espressopp.VerletList(system, cutoff=rc)
+        lj = espressopp.interaction.VerletListLennardJones(vl)
+        lj.setPotential(type1=0, type2=0, potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+        system.addInteraction(lj)
+
+        integrator = espressopp.integrator.VelocityVerlet(system)
+        integrator.dt = 0.005
+        langevin = espressopp.integrator.LangevinThermostat(system)
+        langevin.gamma = 1.0
+        langevin.temperature = 1.0
+        integrator.addExtension(langevin)
+
+        self.system = system
+        self.integrator = integrator
+
+        for f in ('traj.ctr', 'traj.ctr.idx'):
+            if os.path.exists(f):
+                os.remove(f)
+
+    def unfolded_positions(self):
+        positions = []
+        for pid in self.pids:
+            p = self.system.storage.getParticle(pid)
+            positions.append([p.pos[d] + p.imageBox[d] * box[d] for d in range(3)])
+        return positions
+
+    def test_roundtrip(self):
+        dump = espressopp.io.DumpCompressed(self.system, self.integrator, filename='traj.ctr',
+                                            precision=precision, keyframe_interval=5)
+        reference = []
+        for i in range(12):
+            self.integrator.run(10)
+            dump.dump()
+            reference.append((self.integrator.step, self.unfolded_positions()))
+
+        reader = espressopp.tools.CTRReader('traj.ctr')
+        self.assertEqual(len(reader), len(reference))
+        self.assertEqual([i for i in range(len(reader)) if reader.keyframes[i]], [0, 5, 10])
+
+        # random access and sequential reading decode the same frames
+        frames = [9, 2, 11, 0, 6, 6]
+        for n in frames + list(range(len(reader))):
+            step, time, L, ids, pos = reader.read(n)
+            self.assertEqual(step, reference[n][0])
+            self.assertEqual(list(ids), self.pids)
+            self.assertEqual(L, box)
+            for p, ref in zip(pos, reference[n][1]):
+                for d in range(3):
+                    self.assertLessEqual(abs(p[d] - ref[d]), 0.5 * precision + 1e-9)
+
+        # 3 doubles per particle and frame uncompressed
+        raw = len(reference) * len(self.pids) * 3 * 8
+        self.assertLess(os.path.getsize('traj.ctr'), raw / 4)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import os
+import random
+import unittest
+import espressopp
+from espressopp import Real3D
+
+def old_xyz(particles, box, step, length_factor, length_unit, store_pids, store_velocities):
+    # what the serial DumpXYZ wrote, with C++ stream formatting spelled out
+    lines = ['%d\n' % len(particles),
+             '%g  0.0  0.0  0.0  %g  0.0  0.0  0.0  %g  currentStep %d  lengthUnit %s\n' %
+             (box[0] * length_factor, box[1] * length_factor, box[2] * length_factor, step, length_unit)]
+    for pid, ptype, pos, vel in sorted(particles):
+        line = '%d ' % pid if store_pids else ''
+        line += '%d ' % ptype + ' '.join('%.10f' % (length_factor * x) for x in pos)
+        if store_velocities:
+            line += ' ' + ' '.join('%.10f' % (length_factor * v) for v in vel)
+        lines.append(line + '\n')
+    return ''.join(lines)
+
+def old_gro(particles, box, step, length_factor, length_unit):
+    # what the serial DumpGRO wrote
+    lines = ['system description, current step=%d, length unit=%s\n' % (step, length_unit),
+             '%5d\n' % len(particles)]
+    for i, (pid, ptype, pos, vel) in enumerate(sorted(particles)):
+        line = '%5dT%-4d%5s%5d' % (i + 1, ptype, 'T%d' % ptype, i + 1)
+        line += ''.join('%8.3f' % (length_factor * x) for x in pos)
+        line += ''.join('%8.4f' % (length_factor * v) for v in vel)
+        lines.append(line + '\n')
+    lines.append(''.join('%10.5f' % (length_factor * L) for L in box) + '\n')
+    return ''.join(lines)
+
+class TestDumpOrdered(unittest.TestCase):
+    def setUp(self):
+        self.box = (12.0, 9.0, 15.0)
+        self.system, self.integrator = espressopp.standard_system.Default(box=self.box, rc=1.5, skin=0.3)
+        # spread over all ranks and added in shuffled id order
+        rng = random.Random(4711)
+        self.particles = []
+        for pid in range(1, 301):
+            pos = tuple(rng.uniform(0.0, L) for L in self.box)
+            vel = tuple(rng.gauss(0.0, 1.0) for _ in range(3))
+            self.particles.append((pid, rng.randrange(4), pos, vel))
+        shuffled = list(self.particles)
+        rng.shuffle(shuffled)
+        self.system.storage.addParticles([(pid, ptype, Real3D(*pos), Real3D(*vel)) for pid, ptype, pos, vel in shuffled],
+                                         'id', 'type', 'pos', 'v')
+        self.system.storage.decompose()
+        self.files = []
+
+    def tearDown(self):
+        for f in self.files:
+            if os.path.exists(f):
+                os.remove(f)
+
+    def read(self, filename):
+        with open(filename) as f:
+            return f.read()
+
+    def test_xyz(self):
+        for store_pids, store_velocities in [(False, False), (True, False), (True, True)]:
+            filename = 'test_dump_ordered_%d%d.xyz' % (store_pids, store_velocities)
+            self.files.append(filename)
+            dump = espressopp.io.DumpXYZ(self.system, self.integrator, filename=filename, length_factor=2.5,
+                                         length_unit='nm', store_pids=store_pids,
+                                         store_velocities=store_velocities, append=False)
+            # two frames, the second one is appended behind the first
+            dump.dump()
+            dump.dump()
+            frame = old_xyz(self.particles, self.box, 0, 2.5, 'nm', store_pids, store_velocities)
+            self.assertEqual(self.read(filename), frame + frame)
+
+    def test_gro(self):
+        filename = 'test_dump_ordered.gro'
+        self.files.append(filename)
+        dump = espressopp.io.DumpGRO(self.system, self.integrator, filename=filename, length_factor=0.5,
+                                     length_unit='nm', append=False)
+        dump.dump()
+        dump.dump()
+        frame = old_gro(self.particles, self.box, 0, 0.5, 'nm')
+        self.assertEqual(self.read(filename), frame + frame)
+
+if __name__ == '__main__':
+    unittest.main()
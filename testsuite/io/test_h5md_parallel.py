@@ -86,5 +86,28 @@ class TestH5MD(unittest.TestCase):
         self.compare_hdf5_structure('reference.h5', 'dump2.h5')
 
 
+    def test_restore_particles(self):
+        self.system, self.integrator = espressopp.standard_system.Default((10., 10., 10.))
+        self.system.rng = espressopp.esutil.RNG(42)
+        positions = {}
+        for pid in range(34):
+            pos = self.system.bc.getRandomPos()
+            positions[pid] = pos
+            self.system.storage.addParticle(pid, pos)
+        dump_h5md_parallel = espressopp.io.DumpH5MDParallel(self.system, 'restore.h5')
+        dump_h5md_parallel.dump()
+
+        self.system.storage.removeAllParticles()
+
+        restore_h5md_parallel = espressopp.io.RestoreH5MDParallel(self.system, 'restore.h5')
+        restore_h5md_parallel.restore()
+
+        # every particle arrives on the rank owning its position
+        self.assertEqual(int(espressopp.analysis.NPart(self.system).compute()), 34)
+        for pid, pos in positions.items():
+            restored = self.system.storage.getParticle(pid).pos
+            for d in range(3):
+                self.assertAlmostEqual(restored[d], pos[d], places=10)
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+import os
+
+import unittest
+
+box = (8, 8, 8)
+rc = 1.5
+skin = 0.3
+precision = 0.001
+numFrames = 8
+
+class TestTrajectoryReader(unittest.TestCase):
+    def setUp(self):
+        system = espressopp.System()
+        system.rng = espressopp.esutil.RNG()
+        system.rng.seed(1)
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = skin
+        system.comm = MPI.COMM_WORLD
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size, box, rc=rc, skin=skin)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=rc, skin=skin)
+        system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+        # ids start at 0, as StaticStructF.compute expects
+        self.pids = list(range(200))
+        particle_list = [(pid, 0, espressopp.Real3D(0.5 + 1.25 * (pid % 6), 0.5 + 1.25 * (pid // 6 % 6), 0.5 + 1.25 * (pid // 36)))
+                         for pid in self.pids]
+        system.storage.addParticles(particle_list, 'id', 'type', 'pos')
+        system.storage.decompose()
+
+        vl = espressopp.VerletList(system, cutoff=rc)
+        lj = espressopp.interaction.VerletListLennardJones(vl)
+        lj.setPotential(type1=0, type2=0, potential=espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc))
+        system.addInteraction(lj)
+
+        integrator = espressopp.integrator.VelocityVerlet(system)
+        integrator.dt = 0.005
+        langevin = espressopp.integrator.LangevinThermostat(system)
+        langevin.gamma = 1.0
+        langevin.temperature = 1.0
+        integrator.addExtension(langevin)
+
+        for f in ('reader.ctr', 'reader.ctr.idx'):
+            if os.path.exists(f):
+                os.remove(f)
+
+        dump = espressopp.io.DumpCompressed(system, integrator, filename='reader.ctr',
+                                            precision=precision, keyframe_interval=3)
+        self.reference = []
+        for i in range(numFrames):
+            integrator.run(20)
+            dump.dump()
+            positions = []
+            for pid in self.pids:
+                p = system.storage.getParticle(pid)
+                positions.append([p.pos[d] + p.imageBox[d] * box[d] for d in range(3)])
+            self.reference.append((integrator.step, positions))
+
+        self.system = system
+
+    def test_read(self):
+        reader = espressopp.io.TrajectoryReader('reader.ctr')
+        self.assertEqual(reader.num_frames, numFrames)
+        for n in [5, 1, 7, 7, 0, 4, -1]:
+            reader.readFrame(n)
+            step, positions = self.reference[n]
+            self.assertEqual(reader.frame, n % numFrames)
+            self.assertEqual(reader.step, step)
+            self.assertEqual(reader.getStep(n), step)
+            self.assertEqual(list(reader.ids), self.pids)
+            for i, coords in enumerate((reader.x, reader.y, reader.z)):
+                for c, ref in zip(coords, positions):
+                    self.assertLessEqual(abs(c - ref[i]), 0.5 * precision + 1e-9)
+
+    def test_load_frame(self):
+        reader = espressopp.io.TrajectoryReader('reader.ctr')
+        reader.loadFrame(self.system, 2)
+        for pid, ref in zip(self.pids, self.reference[2][1]):
+            p = self.system.storage.getParticle(pid)
+            for d in range(3):
+                self.assertLessEqual(abs(p.pos[d] + p.imageBox[d] * box[d] - ref[d]), 0.5 * precision + 1e-9)
+
+        # a single frame from the trajectory gives the rdf of the loaded system
+        rdf = espressopp.analysis.RadialDistrF(self.system)
+        rdf.print_progress = False
+        fromSystem = rdf.compute(20)
+        fromTrajectory = rdf.computeTrajectory(reader, 20, 2, 3)
+        for a, b in zip(fromSystem, fromTrajectory):
+            self.assertAlmostEqual(a, b, places=8)
+
+        # the same for the static structure factor
+        sq = espressopp.analysis.StaticStructF(self.system)
+        fromSystem = sq.compute(2, 2, 2, 1.0)
+        fromTrajectory = sq.computeTrajectory(reader, 2, 2, 2, 1.0, 2, 3)
+        self.assertEqual(len(fromTrajectory), len(fromSystem))
+        for a, b in zip(fromSystem, fromTrajectory):
+            self.assertAlmostEqual(a[0], b[0], places=8)
+            self.assertAlmostEqual(a[1], b[1], places=8)
+
+        # averaging over all frames is split over the ranks
+        self.assertEqual(len(rdf.computeTrajectory(reader, 20)), 20)
+        self.assertEqual(len(sq.computeTrajectory(reader, 2, 2, 2, 1.0)), len(fromSystem))
+
+        # empty frame ranges give empty results
+        self.assertEqual(len(rdf.computeTrajectory(reader, 20, 3, 3)), 0)
+        self.assertEqual(len(rdf.computeTrajectory(reader, 20, numFrames)), 0)
+        self.assertEqual(len(sq.computeTrajectory(reader, 2, 2, 2, 1.0, numFrames)), 0)
+
+    def test_msd(self):
+        reader = espressopp.io.TrajectoryReader('reader.ctr')
+        msd = espressopp.analysis.MeanSquareDispl(self.system)
+        msd.print_progress = False
+        for n in range(numFrames):
+            msd.gatherFromTrajectory(reader, n)
+        result = msd.compute()
+        self.assertEqual(len(result), numFrames)
+        self.assertAlmostEqual(result[0], 0.0)
+
+        # the same displacements computed from the reference positions
+        first, last = self.reference[0][1], self.reference[-1][1]
+        expected = sum((a[d] - b[d]) ** 2 for a, b in zip(first, last) for d in range(3)) / (6.0 * len(self.pids))
+        self.assertAlmostEqual(result[-1], expected, places=3)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -166,6 +166,7 @@ class TestLBMDCoupling(makeConf):
 
         self.integrator.run(runSteps)
 
+        self.lb.compression = 4  # restart test below reads the deflated dump
         self.lb.saveLBConf()     # saves current state of the LB fluid
         s = str(self.integrator.step)
         restartmdoutput = 'dump/restart' + s + '.xyz'
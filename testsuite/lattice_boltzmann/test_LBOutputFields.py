@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import espressopp
+import mpi4py.MPI as MPI
+from espressopp import Real3D
+
+import h5py
+import os
+import unittest
+
+Ni = 6
+initDen = 1.
+initVel = 0.01
+filename = "lbFields.h5"
+
+class TestLBOutputFields(unittest.TestCase):
+    def setUp(self):
+        system, integrator = espressopp.standard_system.LennardJones(0, box=(Ni, Ni, Ni), temperature=0.)
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size)
+
+        lb = espressopp.integrator.LatticeBoltzmann(system, nodeGrid)
+        integrator.addExtension(lb)
+
+        initPop = espressopp.integrator.LBInitPopUniform(system,lb)
+        initPop.createDenVel(initDen, Real3D(0., 0., initVel))
+
+        self.integrator = integrator
+        self.fields = espressopp.analysis.LBOutputFields(system, lb, filename)
+
+    def tearDown(self):
+        if MPI.COMM_WORLD.rank == 0 and os.path.exists(filename):
+            os.remove(filename)
+
+    def test_uniform_flow(self):
+        self.fields.addPlanarAverage(0)
+        self.fields.addSlice(2, 3)
+        self.fields.addCoarseGrained(4)   # blocks do not tile the lattice
+        self.fields.compression = 4
+
+        numFrames = 3
+        for frame in range(numFrames):
+            self.integrator.run(10)
+            self.fields.writeOutput()
+
+        if MPI.COMM_WORLD.rank != 0:
+            return
+
+        with h5py.File(filename, "r") as f:
+            steps = list(f["step"][:])
+            self.assertEqual(len(steps), numFrames)
+            self.assertEqual(steps, sorted(set(steps)))
+            self.assertEqual(f["planar_x"].shape, (numFrames, Ni, 4))
+            self.assertEqual(f["slice_z_3"].shape, (numFrames, Ni, Ni, 4))
+            self.assertEqual(f["coarse_4"].shape, (numFrames, 2, 2, 2, 4))
+
+            for name in ["planar_x", "slice_z_3", "coarse_4"]:
+                data = f[name][:].reshape(-1, 4)
+                for rho, ux, uy, uz in data:
+                    self.assertAlmostEqual(rho, initDen, places=8)
+                    self.assertAlmostEqual(ux, 0., places=8)
+                    self.assertAlmostEqual(uy, 0., places=8)
+                    self.assertAlmostEqual(uz, initVel, places=8)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -80,6 +80,46 @@ class TestMinimizeEnergy(unittest.TestCase):
         self.assertLessEqual(minimize_energy.f_max, 1.0)
         self.assertLess(interaction.computeEnergy(), energy_before)
 
+    def _lj_dimer(self, **kwargs):
+        particle_list = [
+            (1, espressopp.Real3D(2.0, 2.0, 2.0), 1.0),
+            (2, espressopp.Real3D(3.5, 2.0, 2.0), 1.0),
+        ]
+        self.system.storage.addParticles(particle_list, 'id', 'pos', 'mass')
+        self.system.storage.decompose()
+        minimize_energy = espressopp.integrator.MinimizeEnergy(
+            self.system, gamma=0.001, ftol=0.001, max_displacement=0.01, **kwargs)
+
+        vl = espressopp.VerletList(self.system, cutoff=2.5)
+        lj = espressopp.interaction.LennardJones(sigma=1.0, epsilon=1.0, cutoff=2.5, shift=0)
+        interaction = espressopp.interaction.VerletListLennardJones(vl)
+        interaction.setPotential(type1=0, type2=0, potential=lj)
+        self.system.addInteraction(interaction)
+        return minimize_energy, interaction
+
+    def _distance(self):
+        p1 = self.system.storage.getParticle(1).pos
+        p2 = self.system.storage.getParticle(2).pos
+        return (p1 - p2).abs()
+
+    def test_fire(self):
+        minimize_energy, interaction = self._lj_dimer(method='fire')
+        self.assertTrue(minimize_energy.run(1000))
+        self.assertLessEqual(minimize_energy.f_max, 0.001)
+        self.assertAlmostEqual(self._distance(), 2.0**(1.0/6.0), places=3)
+
+    def test_lbfgs(self):
+        minimize_energy, interaction = self._lj_dimer(method='lbfgs')
+        self.assertTrue(minimize_energy.run(1000))
+        self.assertLessEqual(minimize_energy.f_max, 0.001)
+        self.assertAlmostEqual(self._distance(), 2.0**(1.0/6.0), places=3)
+        self.assertAlmostEqual(minimize_energy.energy, interaction.computeEnergy(), places=8)
+
+    def test_energy_tolerance(self):
+        minimize_energy, interaction = self._lj_dimer(method='fire', etol=1e-2)
+        self.assertTrue(minimize_energy.run(1000))
+        self.assertGreater(minimize_energy.f_max, 0.001)
+
 
 if __name__ == '__main__':
     unittest.main()
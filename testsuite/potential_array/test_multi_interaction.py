@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import random
+import unittest
+import espressopp
+from espressopp import Real3D
+
+class TestMultiInteraction(unittest.TestCase):
+    def setUp(self):
+        self.rc = 2.5
+        box = (8.0, 8.0, 8.0)
+        self.system, self.integrator = espressopp.standard_system.Default(box=box, rc=self.rc, skin=0.3)
+        # jittered lattice, no close contacts
+        random.seed(4711)
+        particles = []
+        n, a = 6, box[0] / 6
+        for i in range(n**3):
+            site = (i % n, (i // n) % n, i // (n * n))
+            pos = Real3D(*[(s + 0.5) * a + random.uniform(-0.2, 0.2) for s in site])
+            particles.append([i + 1, i % 2, 1.0, pos, 0.4 if i % 2 == 0 else -0.4])
+        self.system.storage.addParticles(particles, 'id', 'type', 'mass', 'pos', 'q')
+        self.system.storage.decompose()
+        self.vl = espressopp.VerletList(self.system, cutoff=self.rc)
+
+    def test_single_pass(self):
+        interLJ = espressopp.interaction.VerletListLennardJones(self.vl)
+        interRF = espressopp.interaction.VerletListReactionFieldGeneralized(self.vl)
+        multi = espressopp.interaction.VerletListLenJonesReacFieldGen(self.vl)
+        potRF = espressopp.interaction.ReactionFieldGeneralized(prefactor=138.935, kappa=0.0, epsilon1=1.0,
+                                                                epsilon2=80.0, cutoff=self.rc)
+        for t1, t2, sigma in [(0, 0, 1.0), (0, 1, 0.8), (1, 1, 0.6)]:
+            potLJ = espressopp.interaction.LennardJones(epsilon=1.0, sigma=sigma, cutoff=self.rc)
+            interLJ.setPotential(type1=t1, type2=t2, potential=potLJ)
+            interRF.setPotential(type1=t1, type2=t2, potential=potRF)
+            multi.setPotential1(type1=t1, type2=t2, potential=potLJ)
+            multi.setPotential2(type1=t1, type2=t2, potential=potRF)
+
+        energy = interLJ.computeEnergy() + interRF.computeEnergy()
+        virial = interLJ.computeVirial() + interRF.computeVirial()
+        self.assertAlmostEqual(multi.computeEnergy(), energy, delta=1e-9 * abs(energy))
+        self.assertAlmostEqual(multi.computeVirial(), virial, delta=1e-9 * abs(virial))
+        self.assertAlmostEqual(multi.getPotential1(0, 1).sigma, 0.8, places=12)
+
+if __name__ == '__main__':
+    unittest.main()
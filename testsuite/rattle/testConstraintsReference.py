@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+# Compares Rattle and Settle against a step by step port of the map based implementations they
+# replaced. The molecules fly freely, so the reference only has to reproduce the integrator's
+# position update and the constraint algorithms.
+
+import math
+import unittest
+import espressopp
+import mpi4py.MPI as MPI
+
+dt = 0.002
+nsteps = 25
+
+
+def add(a, b):
+    return [a[0]+b[0], a[1]+b[1], a[2]+b[2]]
+
+
+def sub(a, b):
+    return [a[0]-b[0], a[1]-b[1], a[2]-b[2]]
+
+
+def scale(a, s):
+    return [a[0]*s, a[1]*s, a[2]*s]
+
+
+def dot(a, b):
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2]
+
+
+def cross(a, b):
+    return [a[1]*b[2]-a[2]*b[1], a[2]*b[0]-a[0]*b[2], a[0]*b[1]-a[1]*b[0]]
+
+
+def unit(a):
+    return scale(a, 1.0/math.sqrt(dot(a, a)))
+
+
+def rattle_step(pos, vel, bonds, tol, rptol, maxit=1000):
+    # bonds are (heavy, light, dist, mass heavy, mass light), the first bond of a light atom wins
+    unique = {}
+    for bond in bonds:
+        unique.setdefault(bond[1], bond)
+    bonds = list(unique.values())
+    old = dict((pid, list(pos[pid])) for pid in pos)
+    for pid in pos:
+        pos[pid] = add(pos[pid], scale(vel[pid], dt))
+
+    moved = set(pos)
+    for it in range(maxit):
+        moving = set()
+        for b, a, d, mb, ma in bonds:
+            if a not in moved and b not in moved:
+                continue
+            pab = sub(pos[a], pos[b])
+            diffsq = dot(pab, pab) - d*d
+            if abs(diffsq) > d*d*tol:
+                rab = sub(old[a], old[b])
+                rab_dot_pab = dot(rab, pab)
+                assert rab_dot_pab >= d*d*rptol
+                gab = diffsq / (2.0 * (1.0/ma + 1.0/mb) * rab_dot_pab)
+                displ = scale(rab, gab)
+                pos[a] = sub(pos[a], scale(displ, 1.0/ma))
+                pos[b] = add(pos[b], scale(displ, 1.0/mb))
+                vel[a] = sub(vel[a], scale(displ, 1.0/(ma*dt)))
+                vel[b] = add(vel[b], scale(displ, 1.0/(mb*dt)))
+                moving.update((a, b))
+        moved = moving
+        if not moving:
+            break
+
+    moved = set(pos)
+    for it in range(maxit):
+        moving = set()
+        for b, a, d, mb, ma in bonds:
+            if a not in moved and b not in moved:
+                continue
+            rab = sub(pos[a], pos[b])
+            gab = -dot(rab, sub(vel[a], vel[b])) / ((1.0/ma + 1.0/mb) * d*d)
+            if abs(gab) > tol:
+                vel[a] = add(vel[a], scale(rab, gab/ma))
+                vel[b] = sub(vel[b], scale(rab, gab/mb))
+                moving.update((a, b))
+        moved = moving
+        if not moving:
+            break
+
+
+def settle_step(pos, vel, waters, mO, mH, distHH, distOH):
+    rmT = 1.0 / (mO + mH + mH)
+    t1 = 0.5 * mO / mH
+    rc = 0.5 * distHH
+    ra = math.sqrt(distOH*distOH - rc*rc) / (1.0 + t1)
+    rb = t1 * ra
+
+    for o, h1, h2 in waters:
+        oldO, oldH1, oldH2 = pos[o], pos[h1], pos[h2]
+        for pid in (o, h1, h2):
+            pos[pid] = add(pos[pid], scale(vel[pid], dt))
+
+        b0 = sub(oldH1, oldO)
+        c0 = sub(oldH2, oldO)
+        d0 = add(scale(pos[o], mO*rmT), scale(add(pos[h1], pos[h2]), mH*rmT))
+        a1 = sub(pos[o], d0)
+        b1 = sub(pos[h1], d0)
+        c1 = sub(pos[h2], d0)
+        n0 = cross(b0, c0)
+        n1 = cross(a1, n0)
+        n2 = cross(n0, n1)
+        n0, n1, n2 = unit(n0), unit(n1), unit(n2)
+        b0 = [dot(n1, b0), dot(n2, b0), dot(n0, b0)]
+        c0 = [dot(n1, c0), dot(n2, c0), dot(n0, c0)]
+        A1Z = dot(n0, a1)
+        b1 = [dot(n1, b1), dot(n2, b1), dot(n0, b1)]
+        c1 = [dot(n1, c1), dot(n2, c1), dot(n0, c1)]
+
+        sinphi = A1Z / ra
+        cosphi = math.sqrt(1.0 - sinphi*sinphi)
+        sinpsi = (b1[2] - c1[2]) / (2.0 * rc * cosphi)
+        cospsi = math.sqrt(1.0 - sinpsi*sinpsi)
+        rbphi = -rb * cosphi
+        tmp1 = rc * sinpsi * sinphi
+        tmp2 = rc * sinpsi * cosphi
+        a2 = [0.0, ra*cosphi, ra*sinphi]
+        b2 = [-rc*cospsi, rbphi - tmp1, -rb*sinphi + tmp2]
+        c2 = [rc*cosphi, rbphi + tmp1, -rb*sinphi - tmp2]
+
+        alpha = b2[0]*(b0[0] - c0[0]) + b0[1]*b2[1] + c0[1]*c2[1]
+        beta = b2[0]*(c0[1] - b0[1]) + b0[0]*b2[1] + c0[0]*c2[1]
+        gama = b0[0]*b1[1] - b1[0]*b0[1] + c0[0]*c1[1] - c1[0]*c0[1]
+        a2b2 = alpha*alpha + beta*beta
+        sintheta = (alpha*gama - beta*math.sqrt(a2b2 - gama*gama)) / a2b2
+        costheta = math.sqrt(1.0 - sintheta*sintheta)
+
+        a3 = [-a2[1]*sintheta, a2[1]*costheta, A1Z]
+        b3 = [b2[0]*costheta - b2[1]*sintheta, b2[0]*sintheta + b2[1]*costheta, b1[2]]
+        c3 = [-b2[0]*costheta - c2[1]*sintheta, -b2[0]*sintheta + c2[1]*costheta, c1[2]]
+        m1 = [n1[0], n2[0], n0[0]]
+        m2 = [n1[1], n2[1], n0[1]]
+        m0 = [n1[2], n2[2], n0[2]]
+        for pid, p3, old in ((o, a3, oldO), (h1, b3, oldH1), (h2, c3, oldH2)):
+            pos[pid] = add([dot(p3, m1), dot(p3, m2), dot(p3, m0)], d0)
+            vel[pid] = scale(sub(pos[pid], old), 1.0/dt)
+
+        # settlev, the velocities above already satisfy the constraints up to round-off
+        vO, vH1, vH2 = vel[o], vel[h1], vel[h2]
+        rab = sub(pos[h1], pos[o])
+        rbc = sub(pos[h2], pos[h1])
+        rca = sub(pos[o], pos[h2])
+        rab2, rbc2, rca2 = dot(rab, rab), dot(rbc, rbc), dot(rca, rca)
+        eab, ebc, eca = unit(rab), unit(rbc), unit(rca)
+        vab0 = dot(eab, sub(vH1, vO))
+        vbc0 = dot(ebc, sub(vH2, vH1))
+        vca0 = dot(eca, sub(vO, vH2))
+        cosA = (rca2 + rab2 - rbc2) / (2*math.sqrt(rca2*rab2))
+        cosB = (rbc2 + rab2 - rca2) / (2*math.sqrt(rbc2*rab2))
+        cosC = (rbc2 + rca2 - rab2) / (2*math.sqrt(rbc2*rca2))
+        mOmH = mO + mH
+        interm1 = (2*mOmH*mOmH + 2*mO*mH*cosA*cosB*cosC - 2*mH*mH*cosA*cosA -
+                   mO*mOmH*(cosB*cosB + cosC*cosC))
+        d = dt * interm1 / (2*mH)
+        tauab = mO * (vab0*(2*mOmH - mO*cosC*cosC) + vbc0*(mH*cosC*cosA - mOmH*cosB) +
+                      vca0*(mO*cosB*cosC - 2*mH*cosA)) / d
+        taubc = (vbc0*(mOmH*mOmH - mH*mH*cosA*cosA) + vca0*mO*(mH*cosA*cosB - mOmH*cosC) +
+                 vab0*mO*(mH*cosC*cosA - mOmH*cosB)) / d
+        tauca = mO * (vca0*(2*mOmH - mO*cosB*cosB) + vab0*(mO*cosB*cosC - 2*mH*cosA) +
+                      vbc0*(mH*cosA*cosB - mOmH*cosC)) / d
+        vel[o] = add(vO, scale(sub(scale(eab, tauab), scale(eca, tauca)), dt/(2*mO)))
+        vel[h1] = add(vH1, scale(sub(scale(ebc, taubc), scale(eab, tauab)), dt/(2*mH)))
+        vel[h2] = add(vH2, scale(sub(scale(eca, tauca), scale(ebc, taubc)), dt/(2*mH)))
+
+
+class TestConstraintsReference(unittest.TestCase):
+    def setUp(self):
+        system = espressopp.System()
+        box = (10, 10, 10)
+        system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+        system.skin = 0.3
+        system.comm = MPI.COMM_WORLD
+        nodeGrid = espressopp.tools.decomp.nodeGrid(espressopp.MPI.COMM_WORLD.size, box,
+                                                    rc=1.5, skin=system.skin)
+        cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc=1.5, skin=system.skin)
+        system.storage = espressopp.storage.DomainDecompositionAdress(system, nodeGrid, cellGrid)
+        self.system = system
+
+    def build(self, particles, tuples, vps):
+        # particles are (pid, pos, v, mass), each molecule gets a virtual particle at its first atom
+        atoms = dict((p[0], p) for p in particles)
+        plist = [(vp, 1, espressopp.Real3D(atoms[t[1]][1]), espressopp.Real3D(0, 0, 0), 1.0, 0)
+                 for vp, t in zip(vps, tuples)]
+        plist += [(p[0], 0, espressopp.Real3D(p[1]), espressopp.Real3D(p[2]), p[3], 1)
+                  for p in particles]
+        self.system.storage.addParticles(plist, 'id', 'type', 'pos', 'v', 'mass', 'adrat')
+        ftpl = espressopp.FixedTupleListAdress(self.system.storage)
+        ftpl.addTuples(tuples)
+        self.system.storage.setFixedTuplesAdress(ftpl)
+        self.system.storage.decompose()
+        vl = espressopp.VerletListAdress(self.system, cutoff=1.5, adrcut=1.5, dEx=2.0, dHy=1.0,
+                                         pids=[vps[0]], sphereAdr=True)
+        integrator = espressopp.integrator.VelocityVerlet(self.system)
+        integrator.dt = dt
+        adress = espressopp.integrator.Adress(self.system, vl, ftpl)
+        integrator.addExtension(adress)
+        espressopp.tools.AdressDecomp(self.system, integrator)
+        return ftpl, integrator
+
+    def compare(self, pos, vel):
+        for pid in pos:
+            part = self.system.storage.getParticle(pid)
+            for k in range(3):
+                self.assertAlmostEqual(part.pos[k], pos[pid][k], places=8)
+                self.assertAlmostEqual(part.v[k], vel[pid][k], places=8)
+
+    def test_chain(self):
+        # zig-zag chain 1-2-3-4-5-6 of equal masses, every atom but the first is the light atom of
+        # one constraint
+        d = 0.15
+        particles = []
+        for i in range(6):
+            pos = [3.0 + 0.12*i, 3.0 + (0.09 if i % 2 else 0.0), 3.0]
+            v = [0.3*math.sin(i+1.0), 0.2*math.cos(2.0*i), 0.25*math.sin(3.0*i+0.5)]
+            particles.append((i+1, pos, v, 1.0))
+        bonds = [[i, i+1, d, 1.0, 1.0] for i in range(1, 6)]
+        # bonds given twice must be applied once, as with the map based storage
+        bonds += [[2, 3, d, 1.0, 1.0], [4, 5, d, 1.0, 1.0]]
+
+        ftpl, integrator = self.build(particles, [(10, 1, 2, 3, 4, 5, 6)], [10])
+        rattle = espressopp.integrator.Rattle(self.system, maxit=1000, tol=1e-12, rptol=1e-6)
+        rattle.addConstrainedBonds(bonds)
+        integrator.addExtension(rattle)
+        integrator.run(nsteps)
+
+        pos = dict((p[0], list(p[1])) for p in particles)
+        vel = dict((p[0], list(p[2])) for p in particles)
+        for step in range(nsteps):
+            rattle_step(pos, vel, bonds, tol=1e-12, rptol=1e-6)
+        self.compare(pos, vel)
+
+    def test_water(self):
+        mO, mH, distHH, distOH = 15.9994, 1.008, 0.1633, 0.1
+        h = 0.5 * distHH
+        y = math.sqrt(distOH*distOH - h*h)
+        particles = []
+        tuples = []
+        for m, (x0, vx) in enumerate(((3.0, 0.4), (3.5, -0.3))):
+            o, h1, h2 = 3*m + 1, 3*m + 2, 3*m + 3
+            particles.append((o, [x0, 3.0, 3.0], [vx, 0.1, -0.2], mO))
+            particles.append((h1, [x0 - h, 3.0 + y, 3.0], [vx + 0.8, -0.5, 0.6], mH))
+            particles.append((h2, [x0 + h, 3.0 + y, 3.0], [vx - 0.7, 0.4, 0.9], mH))
+            tuples.append((10*(m+1), o, h1, h2))
+
+        ftpl, integrator = self.build(particles, tuples, [10, 20])
+        settle = espressopp.integrator.Settle(self.system, ftpl, mO=mO, mH=mH, distHH=distHH,
+                                              distOH=distOH)
+        settle.addMolecules([10, 20])
+        integrator.addExtension(settle)
+        integrator.run(nsteps)
+
+        pos = dict((p[0], list(p[1])) for p in particles)
+        vel = dict((p[0], list(p[2])) for p in particles)
+        waters = [t[1:] for t in tuples]
+        for step in range(nsteps):
+            settle_step(pos, vel, waters, mO, mH, distHH, distOH)
+        self.compare(pos, vel)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+# Runs with several replicas of two CPUs each under mpiexec, e.g. 4 CPUs give 2 replicas. After
+# every exchange the temperatures of the replicas must still be a permutation of the ladder and
+# all CPUs of a replica must agree on the temperature and on the acceptance ratios.
+
+import unittest
+import espressopp
+from espressopp import pmi
+
+nsize = espressopp.MPI.COMM_WORLD.size
+ncpus = 2 if nsize % 2 == 0 and nsize >= 4 else 1
+nreplicas = max(nsize // ncpus, 1)
+
+
+def build_replica(temperature):
+    box = (6.0, 6.0, 6.0)
+    rc = pow(2.0, 1.0/6.0)
+    system = espressopp.System()
+    system.rng = espressopp.esutil.RNG(54321)
+    system.bc = espressopp.bc.OrthorhombicBC(system.rng, box)
+    system.skin = 0.3
+    nodeGrid = espressopp.tools.decomp.nodeGrid(ncpus, box, rc, system.skin)
+    cellGrid = espressopp.tools.decomp.cellGrid(box, nodeGrid, rc, system.skin)
+    system.storage = espressopp.storage.DomainDecomposition(system, nodeGrid, cellGrid)
+
+    pid = 1
+    for i in range(5):
+        for j in range(5):
+            for k in range(5):
+                pos = espressopp.Real3D(0.6 + 1.2*i, 0.6 + 1.2*j, 0.6 + 1.2*k)
+                system.storage.addParticle(pid, pos)
+                pid += 1
+    system.storage.decompose()
+
+    vl = espressopp.VerletList(system, cutoff=rc)
+    lj = espressopp.interaction.VerletListLennardJones(vl)
+    potential = espressopp.interaction.LennardJones(1.0, 1.0, cutoff=rc, shift='auto')
+    lj.setPotential(type1=0, type2=0, potential=potential)
+    system.addInteraction(lj)
+
+    integrator = espressopp.integrator.VelocityVerlet(system)
+    integrator.dt = 0.005
+    thermostat = espressopp.integrator.LangevinThermostat(system)
+    thermostat.gamma = 1.0
+    thermostat.temperature = temperature
+    integrator.addExtension(thermostat)
+    return system, integrator, thermostat
+
+
+class TestReplicaExchange(unittest.TestCase):
+    def test_temperatures_stay_permutation(self):
+        if nreplicas < 2:
+            self.skipTest("needs at least 2 replicas, run with mpiexec -n 4")
+
+        temperatures = [1.0 + 0.05*i for i in range(nreplicas)]
+        rex = espressopp.integrator.ReplicaExchange(temperatures=temperatures, seed=4711)
+        self.replicas = []
+        for i in range(nreplicas):
+            comm = pmi.Communicator(list(range(i*ncpus, (i+1)*ncpus)))
+            pmi.activate(comm)
+            system, integrator, thermostat = build_replica(temperatures[i])
+            rex.setReplica(system, integrator, thermostat)
+            pmi.deactivate(comm)
+            self.replicas.append((comm, system, integrator, thermostat))
+
+        for n in range(100):
+            rex.run(5, 5)
+
+            temps = rex.getTemperature()
+            self.assertEqual(len(temps), nreplicas*ncpus)
+            for i in range(nreplicas):
+                for t in temps[i*ncpus:(i+1)*ncpus]:
+                    self.assertEqual(t, temps[i*ncpus])
+            self.assertEqual(sorted(temps[::ncpus]), temperatures)
+
+            ratios = rex.getAcceptanceRatios()
+            for r in ratios:
+                self.assertEqual(list(r), list(ratios[0]))
+
+
+if __name__ == '__main__':
+    unittest.main()
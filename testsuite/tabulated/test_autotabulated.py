@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import math
+import unittest
+import espressopp
+from espressopp import Real3D
+class TestAutoTabulated(unittest.TestCase):
+    def compare(self, pot, tab, rMin, tolerance):
+        self.assertLessEqual(tab.maxError, tolerance)
+        rc = pot.cutoff
+        for i in range(200):
+            r = rMin + (rc - rMin) * (i + 0.37) / 200
+            e = pot.computeEnergy(r)
+            f = pot.computeForce(Real3D(r, 0.0, 0.0))[0]
+            self.assertAlmostEqual(tab.computeEnergy(r), e, delta=2 * tolerance * max(abs(e), 1.0))
+            self.assertAlmostEqual(tab.computeForce(Real3D(r, 0.0, 0.0))[0], f,
+                                   delta=2 * tolerance * max(abs(f), 1.0))
+
+    def test_morse(self):
+        pot = espressopp.interaction.Morse(epsilon=1.0, alpha=2.0, rMin=1.2, cutoff=3.0)
+        tab = espressopp.interaction.AutoTabulatedMorse(pot, rMin=0.8, tolerance=1e-6)
+        self.compare(pot, tab, 0.8, 1e-6)
+        # shift is taken over, closer pairs are analytic
+        self.assertAlmostEqual(tab.shift, pot.shift, places=12)
+        self.assertAlmostEqual(tab.computeEnergy(0.5), pot.computeEnergy(0.5), places=10)
+        self.assertEqual(tab.computeEnergy(3.1), 0.0)
+
+    def test_coulomb(self):
+        # tabulated for unit charges
+        pot = espressopp.interaction.CoulombRSpace(prefactor=138.935, alpha=3.0, cutoff=1.0)
+        tab = espressopp.interaction.AutoTabulatedCoulombRSpace(pot, rMin=0.1, tolerance=1e-6)
+        self.compare(pot, tab, 0.1, 1e-6)
+
+    def test_coulomb_particles(self):
+        # the table holds the unit charge part, the interaction scales it by q1 q2 per pair
+        rc, alpha, prefactor = 1.0, 3.0, 138.935
+        box = (4.0, 4.0, 4.0)
+        system, integrator = espressopp.standard_system.Default(box=box, rc=rc, skin=0.3)
+        particles = [(1, Real3D(1.0, 1.0, 1.0), 0.5), (2, Real3D(1.6, 1.3, 1.0), -1.0),
+                     (3, Real3D(1.2, 1.8, 1.4), 0.8), (4, Real3D(3.7, 1.1, 0.8), -0.3),
+                     (5, Real3D(2.1, 1.0, 1.1), 1.2)]
+        system.storage.addParticles([(pid, 0, pos, q) for pid, pos, q in particles],
+                                    'id', 'type', 'pos', 'q')
+        system.storage.decompose()
+        pot = espressopp.interaction.CoulombRSpace(prefactor=prefactor, alpha=alpha, cutoff=rc)
+        vl = espressopp.VerletList(system, cutoff=rc)
+        inter = espressopp.interaction.VerletListAutoTabulatedCoulombRSpace(vl)
+        inter.setPotential(0, 0, espressopp.interaction.AutoTabulatedCoulombRSpace(
+            pot, rMin=0.1, tolerance=1e-8))
+        system.addInteraction(inter)
+        integrator.run(0)
+
+        energy = 0.0
+        forces = {pid: Real3D(0.0) for pid, pos, q in particles}
+        for i, (pid1, pos1, q1) in enumerate(particles):
+            for pid2, pos2, q2 in particles[i + 1:]:
+                d = system.bc.getMinimumImageVector(pos1, pos2)
+                r = math.sqrt(d.sqr())
+                if r >= rc:
+                    continue
+                energy += prefactor * q1 * q2 * math.erfc(alpha * r) / r
+                ff = prefactor * q1 * q2 * (2.0 * alpha / math.sqrt(math.pi) * math.exp(-(alpha * r)**2)
+                                            + math.erfc(alpha * r) / r) / (r * r)
+                forces[pid1] += d * ff
+                forces[pid2] -= d * ff
+        self.assertAlmostEqual(inter.computeEnergy(), energy, delta=1e-6 * abs(energy))
+        for pid, f in forces.items():
+            fp = system.storage.getParticle(pid).f
+            for k in range(3):
+                self.assertAlmostEqual(fp[k], f[k], delta=1e-6 * max(abs(f[k]), 1.0))
+
+if __name__ == '__main__':
+    unittest.main()
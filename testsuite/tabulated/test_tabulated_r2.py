@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -*- coding: utf-8 -*-
+
+import os
+import tempfile
+import unittest
+import espressopp
+from espressopp import Real3D
+
+class TestTabulatedR2(unittest.TestCase):
+    def setUp(self):
+        # Lennard-Jones table; only the controller runs this script
+        self.potLJ = espressopp.interaction.LennardJones(epsilon=1.0, sigma=1.0, shift=False, cutoff=2.5)
+        self.tabfile = os.path.join(tempfile.gettempdir(), 'test_tabulated_r2.tab')
+        with open(self.tabfile, 'w') as f:
+            N, low, high = 257, 0.01, 2.5
+            for i in range(N):
+                r = low + i * (high - low) / (N - 1)
+                f.write('%15.8g %15.8g %15.8g\n' % (r, self.potLJ.computeEnergy(r),
+                                                   self.potLJ.computeForce(Real3D(r, 0.0, 0.0))[0]))
+
+    def test_r2_table(self):
+        # the r^2 resampling must keep the fourth order accuracy of the cubic spline: with
+        # 257 points it stays within 1e-5, a second order scheme is off by about 1e-2
+        potTab = espressopp.interaction.Tabulated(itype=3, filename=self.tabfile, cutoff=2.5)
+        for r in [0.9, 1.0, 1.12, 1.5, 2.0, 2.49]:
+            e = self.potLJ.computeEnergy(r)
+            f = self.potLJ.computeForce(Real3D(r, 0.0, 0.0))[0]
+            self.assertAlmostEqual(potTab.computeEnergy(r), e, delta=1e-5 * (abs(e) + 1.0))
+            self.assertAlmostEqual(potTab.computeForce(Real3D(r, 0.0, 0.0))[0], f,
+                                   delta=1e-5 * (abs(f) + 1.0))
+        # beyond the cutoff
+        self.assertEqual(potTab.computeEnergy(2.6), 0.0)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+#  Copyright (C) 2026
+#      Max Planck Institute for Polymer Research & JGU Mainz
+#
+#  This file is part of ESPResSo++.
+#
+#  ESPResSo++ is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ESPResSo++ is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import tempfile
+import unittest
+import espressopp
+import math
+
+def write_bond_table():
+    # harmonic bond table
+    tabfile = os.path.join(tempfile.gettempdir(), 'test_vec_bonded.tab')
+    with open(tabfile, 'w') as f:
+        N, low, high, K, r0 = 201, 0.5, 1.5, 10.0, 1.0
+        for i in range(N):
+            r = low + i * (high - low) / (N - 1)
+            f.write('%15.8g %15.8g %15.8g\n' % (r, K * (r - r0)**2, -2.0 * K * (r - r0)))
+    return tabfile
+
+def generate_md(use_vec=True):
+    print('{}USING VECTORIZATION'.format('NOT ' if not use_vec else ''))
+
+    if use_vec:
+        Default = espressopp.vec.standard_system.Default
+        VerletList = espressopp.vec.VerletList
+        VerletListCoulombRSpace = espressopp.vec.interaction.VerletListCoulombRSpace
+        FixedPairList = espressopp.vec.FixedPairList
+        FixedPairListHarmonic = espressopp.vec.interaction.FixedPairListHarmonic
+        FixedPairListTabulated = espressopp.vec.interaction.FixedPairListTabulated
+        FixedTripleList = espressopp.vec.FixedTripleList
+        FixedTripleListAngularHarmonic = espressopp.vec.interaction.FixedTripleListAngularHarmonic
+        FixedQuadrupleList = espressopp.vec.FixedQuadrupleList
+        FixedQuadrupleListDihedralHarmonic = espressopp.vec.interaction.FixedQuadrupleListDihedralHarmonic
+        FixedQuadrupleListDihedralRB = espressopp.vec.interaction.FixedQuadrupleListDihedralRB
+    else:
+        Default = espressopp.standard_system.Default
+        VerletList = espressopp.VerletList
+        VerletListCoulombRSpace = espressopp.interaction.VerletListCoulombRSpace
+        FixedPairList = espressopp.FixedPairList
+        FixedPairListHarmonic = espressopp.interaction.FixedPairListHarmonic
+        FixedPairListTabulated = espressopp.interaction.FixedPairListTabulated
+        FixedTripleList = espressopp.FixedTripleList
+        FixedTripleListAngularHarmonic = espressopp.interaction.FixedTripleListAngularHarmonic
+        FixedQuadrupleList = espressopp.FixedQuadrupleList
+        FixedQuadrupleListDihedralHarmonic = espressopp.interaction.FixedQuadrupleListDihedralHarmonic
+        FixedQuadrupleListDihedralRB = espressopp.interaction.FixedQuadrupleListDihedralRB
+
+    isteps      = 10
+    rc          = 1.5
+    skin        = 0.4
+    timestep    = 0.002
+
+    # ensure deterministic trajectories
+    temperature = None
+
+    bonds, angles, x, y, z, Lx, Ly, Lz = espressopp.tools.lammps.read('polymer_melt.lammps')
+    box = (Lx, Ly, Lz)
+    num_particles = len(x)
+    system, integrator = Default(box=box, rc=rc, skin=skin, dt=timestep, temperature=temperature)
+
+    # dihedrals along the chains, built from consecutive angles
+    angleEnds = {}
+    for a, b, c in angles:
+        angleEnds.setdefault((a, b), []).append(c)
+    dihedrals = [(a, b, c, d) for a, b, c in angles for d in angleEnds.get((b, c), []) if d != a]
+
+    props = ['id', 'type', 'mass', 'pos', 'q']
+    new_particles = []
+    for i in range(num_particles):
+        q = 0.5 if i % 2 == 0 else -0.5
+        new_particles.append([i + 1, 0, 1.0, espressopp.Real3D(x[i], y[i], z[i]), q])
+    system.storage.addParticles(new_particles, *props)
+    system.storage.decompose()
+
+    interactions = []
+
+    # real-space Coulomb with Verlet list
+    vl = VerletList(system, cutoff = rc)
+    interCoulomb = VerletListCoulombRSpace(vl)
+    interCoulomb.setPotential(type1=0, type2=0,
+        potential=espressopp.interaction.CoulombRSpace(prefactor=1.0, alpha=1.5, cutoff=rc))
+    interactions.append(interCoulomb)
+
+    fpl = FixedPairList(system.storage)
+    fpl.addBonds(bonds)
+    interactions.append(FixedPairListHarmonic(system, fpl,
+        espressopp.interaction.Harmonic(K=30.0, r0=0.97)))
+    interactions.append(FixedPairListTabulated(system, fpl,
+        espressopp.interaction.Tabulated(itype=3, filename=write_bond_table(), cutoff=1.5)))
+
+    ftl = FixedTripleList(system.storage)
+    ftl.addTriples(angles)
+    interactions.append(FixedTripleListAngularHarmonic(system, ftl,
+        espressopp.interaction.AngularHarmonic(K=5.0, theta0=0.6*math.pi)))
+
+    fql = FixedQuadrupleList(system.storage)
+    fql.addQuadruples(dihedrals)
+    interactions.append(FixedQuadrupleListDihedralHarmonic(system, fql,
+        espressopp.interaction.DihedralHarmonic(K=2.0, phi0=0.3)))
+    interactions.append(FixedQuadrupleListDihedralRB(system, fql,
+        espressopp.interaction.DihedralRB(K0=0.5, K1=1.0, K2=-0.5, K3=0.25)))
+
+    for inter in interactions:
+        system.addInteraction(inter)
+
+    energies = [inter.computeEnergy() for inter in interactions]
+
+    integrator.run(isteps)
+
+    # retrieve particle positions after run
+    configurations = espressopp.analysis.Configurations(system, pos=True, vel=True, force=True)
+    configurations.gather()
+
+    return energies, [configurations[0][i] for i in range(num_particles)]
+
+class TestVectorizationBonded(unittest.TestCase):
+
+    def test1(self):
+        ''' Ensure that energies and positions after integration are the same for vec and non-vec bonded and Coulomb interactions '''
+        print('-'*70)
+        e0, pos0 = generate_md(True)
+        print('-'*70)
+        e1, pos1 = generate_md(False)
+        print('-'*70)
+
+        self.assertEqual(len(e0), len(e1))
+        for a, b in zip(e0, e1):
+            self.assertAlmostEqual(a, b, places=8)
+
+        self.assertEqual(len(pos0), len(pos1))
+        for i in range(len(pos1)):
+            self.assertAlmostEqual((pos0[i]-pos1[i]).sqr(), 0.0, 8)
+
+if __name__ == "__main__":
+    unittest.main()
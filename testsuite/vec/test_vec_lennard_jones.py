@@ -120,8 +120,10 @@ class TestVectorization(unittest.TestCase):
 
             self.assertEqual(len(pos0), len(pos1))
             diff = [(pos0[i]-pos1[i]).sqr() for i in range(len(pos1))]
+            # looser with single precision pair kernels
+            places = 6 if espressopp.vec.mixedPrecision else 8
             for d in diff:
-                self.assertAlmostEqual(d,0.0,8)
+                self.assertAlmostEqual(d,0.0,places)
 
 if __name__ == "__main__":
     unittest.main()